@@ -0,0 +1,859 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Batch engine: steps many calculators together, one instruction for all
+ * lanes that share a PC, with every lane's digit i processed by one vector
+ * operation. Lanes at other PCs wait and are issued in later steps.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45batch.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Private types -------------------------------------------------------------*/
+/* One byte per lane. A register of all lanes is lanes_t[14], one row per digit. */
+typedef uint8_t lanes_t[HP45_BATCH_LANES];
+
+/* One bit per lane */
+typedef uint64_t lanebits_t;
+
+/* Lanes executing the current instruction and the digits selected in each */
+typedef struct{
+  lanes_t mask;     // 0xFF for lanes executing the instruction, 0 otherwise
+  lanes_t lo, hi;   // first and last digit of the field, per lane
+  lanes_t act[14];  // 0xFF where the digit lies in the field of an executing lane
+  int dlo, dhi;     // union of the fields of all executing lanes
+} group_t;
+
+/* Lanes waiting at the same PC */
+typedef struct{
+  uint16_t pc;
+  lanebits_t bits;
+} pcgroup_t;
+
+/* Scheduling state of one hp45batch_run_cycles call */
+typedef struct{
+  pcgroup_t grp[HP45_BATCH_LANES];
+  int n;
+  lanes_t budget;                  // cycles left in the current chunk, per lane
+  uint32_t rest[HP45_BATCH_LANES]; // cycles left after the current chunk, per lane
+  lanebits_t done;                 // lanes whose chunk ran out at the current instruction
+} sched_t;
+
+/* Private macros ------------------------------------------------------------*/
+/* Byte vectors. Masks are 0xFF/0x00 per byte; digits are small enough for
+ * signed compares. VBLEND(a, b, m) selects b where m is set.
+ */
+#if defined(__AVX2__)
+typedef __m256i vec_t;
+#define VEC_WIDTH       32
+#define VLOAD(p)        _mm256_loadu_si256((const __m256i*)(p))
+#define VSTORE(p, v)    _mm256_storeu_si256((__m256i*)(p), v)
+#define VSET(x)         _mm256_set1_epi8((char)(x))
+#define VADD(a, b)      _mm256_add_epi8(a, b)
+#define VSUB(a, b)      _mm256_sub_epi8(a, b)
+#define VAND(a, b)      _mm256_and_si256(a, b)
+#define VOR(a, b)       _mm256_or_si256(a, b)
+#define VANDNOT(a, b)   _mm256_andnot_si256(a, b)   // ~a & b
+#define VGT(a, b)       _mm256_cmpgt_epi8(a, b)
+#define VEQ(a, b)       _mm256_cmpeq_epi8(a, b)
+#define VBLEND(a, b, m) _mm256_blendv_epi8(a, b, m)
+#define VMOVEMASK(m)    ((uint32_t)_mm256_movemask_epi8(m))
+#elif defined(__SSE2__)
+typedef __m128i vec_t;
+#define VEC_WIDTH       16
+#define VLOAD(p)        _mm_loadu_si128((const __m128i*)(p))
+#define VSTORE(p, v)    _mm_storeu_si128((__m128i*)(p), v)
+#define VSET(x)         _mm_set1_epi8((char)(x))
+#define VADD(a, b)      _mm_add_epi8(a, b)
+#define VSUB(a, b)      _mm_sub_epi8(a, b)
+#define VAND(a, b)      _mm_and_si128(a, b)
+#define VOR(a, b)       _mm_or_si128(a, b)
+#define VANDNOT(a, b)   _mm_andnot_si128(a, b)
+#define VGT(a, b)       _mm_cmpgt_epi8(a, b)
+#define VEQ(a, b)       _mm_cmpeq_epi8(a, b)
+#define VBLEND(a, b, m) _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a))
+#define VMOVEMASK(m)    ((uint32_t)_mm_movemask_epi8(m))
+#else
+typedef uint8_t vec_t;
+#define VEC_WIDTH       1
+#define VLOAD(p)        (*(const uint8_t*)(p))
+#define VSTORE(p, v)    (*(uint8_t*)(p) = (v))
+#define VSET(x)         ((uint8_t)(x))
+#define VADD(a, b)      ((uint8_t)((a) + (b)))
+#define VSUB(a, b)      ((uint8_t)((a) - (b)))
+#define VAND(a, b)      ((uint8_t)((a) & (b)))
+#define VOR(a, b)       ((uint8_t)((a) | (b)))
+#define VANDNOT(a, b)   ((uint8_t)(~(a) & (b)))
+#define VGT(a, b)       ((int8_t)(a) > (int8_t)(b) ? 0xFF : 0x00)
+#define VEQ(a, b)       ((a) == (b) ? 0xFF : 0x00)
+#define VBLEND(a, b, m) ((uint8_t)(((a) & ~(m)) | ((b) & (m))))
+#define VMOVEMASK(m)    ((uint32_t)((m) & 1))
+#endif
+
+#if HP45_BATCH_LANES != 32 && HP45_BATCH_LANES != 64
+#error "HP45_BATCH_LANES must be 32 or 64"
+#endif
+
+#define OPCODE_TEST_KEY     0x014 // if s0 = 1, polled by the idle keyboard loop
+#define IDLE_SKIP_MIN       32    // fewer cycles left are cheaper to execute than to probe
+#define CHUNK               255   // largest per lane budget held in a lanes_t
+
+#define FOR_VEC(v)          for(v = 0; v < HP45_BATCH_LANES; v += VEC_WIDTH)
+#define FOR_LANES(l, mask)  for(l = 0; l < HP45_BATCH_LANES; l++) if(mask[l])
+#define FOR_BITS(l, bits)   for(l = 0; l < HP45_BATCH_LANES; l++) if(((bits) >> l) & 1)
+
+/* Masked update of a byte per lane array: p[] = m[] ? x : p[].
+ * x is evaluated for every vector and may refer to the vector offset v_.
+ */
+#define PLANE_SET(p, x, m)  do{ uint16_t v_; FOR_VEC(v_){ \
+    VSTORE(&(p)[v_], VBLEND(VLOAD(&(p)[v_]), x, VLOAD(&(m)[v_]))); } }while(0)
+
+/* register planes in hp45inst_t order */
+#define RA  batch->reg[0]
+#define RB  batch->reg[1]
+#define RC  batch->reg[2]
+#define RD  batch->reg[3]
+#define RE  batch->reg[4]
+#define RF  batch->reg[5]
+#define RM  batch->reg[6]
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t ROM[2048] = {
+  #include "hp45rom.c"
+};
+
+static const lanes_t zero[14];
+
+/* first and last digit of fixed word-select fields (p and wp depend on P) */
+static const uint8_t field_lo[8] = {0, 3, 0, 0, 0, 3, 2, 13};
+static const uint8_t field_hi[8] = {0, 12, 2, 13, 0, 13, 2, 13};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Compute the digits selected by a word-select field in every lane.
+            Fields reaching past digit 13 (P > 13) are clipped to the register.
+  * @param  batch: batch object
+  * @param  ws: word-select field
+  * @param  g: group, with mask filled in
+  * @retval None
+  */
+static void select_field(const hp45batch_t *batch, uint8_t ws, group_t *g)
+{
+  uint16_t l, v;
+  int i;
+
+  if(ws == 0 || ws == 4){
+    g->dlo = 13;
+    g->dhi = 0;
+    for(l = 0; l < HP45_BATCH_LANES; l++){
+      g->lo[l] = ws ? 0 : batch->P[l];
+      g->hi[l] = batch->P[l];
+    }
+    FOR_LANES(l, g->mask){
+      if(g->lo[l] < g->dlo)g->dlo = g->lo[l];
+      if(g->hi[l] > g->dhi)g->dhi = g->hi[l];
+    }
+    if(g->dhi > 13)g->dhi = 13;
+  }else{
+    g->dlo = field_lo[ws];
+    g->dhi = field_hi[ws];
+    memset(g->lo, g->dlo, sizeof(g->lo));
+    memset(g->hi, g->dhi, sizeof(g->hi));
+  }
+  for(i = g->dlo; i <= g->dhi; i++){
+    FOR_VEC(v){
+      const vec_t d = VSET(i);
+      const vec_t in = VANDNOT(VOR(VGT(VLOAD(&g->lo[v]), d), VGT(d, VLOAD(&g->hi[v]))), VLOAD(&g->mask[v]));
+      VSTORE(&g->act[i][v], in);
+    }
+  }
+}
+
+/**
+  * @brief  Copy the selected field of a register to another, in every executing lane.
+  */
+static void b_mov(lanes_t *dst, const lanes_t *src, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  for(i = g->dlo; i <= g->dhi; i++){
+    FOR_VEC(v){
+      VSTORE(&dst[i][v], VBLEND(VLOAD(&dst[i][v]), VLOAD(&src[i][v]), VLOAD(&g->act[i][v])));
+    }
+  }
+}
+
+/**
+  * @brief  Exchange the selected field of 2 registers.
+  */
+static void b_exch(lanes_t *r1, lanes_t *r2, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  for(i = g->dlo; i <= g->dhi; i++){
+    FOR_VEC(v){
+      const vec_t m = VLOAD(&g->act[i][v]);
+      const vec_t a = VLOAD(&r1[i][v]);
+      const vec_t b = VLOAD(&r2[i][v]);
+
+      VSTORE(&r1[i][v], VBLEND(a, b, m));
+      VSTORE(&r2[i][v], VBLEND(b, a, m));
+    }
+  }
+}
+
+/**
+  * @brief  Shift the selected field of a register by one digit.
+  * @param  left: direction. non-zero for left and 0 for right.
+  */
+static void b_shift(lanes_t *r, uint8_t left, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  if(left){
+    for(i = g->dhi; i >= g->dlo; i--){
+      FOR_VEC(v){
+        const vec_t in = i ? VLOAD(&r[i-1][v]) : VSET(0);
+        const vec_t low = VEQ(VLOAD(&g->lo[v]), VSET(i));
+
+        VSTORE(&r[i][v], VBLEND(VLOAD(&r[i][v]), VANDNOT(low, in), VLOAD(&g->act[i][v])));
+      }
+    }
+  }else{
+    for(i = g->dlo; i <= g->dhi; i++){
+      FOR_VEC(v){
+        const vec_t in = i < 13 ? VLOAD(&r[i+1][v]) : VSET(0);
+        const vec_t high = VEQ(VLOAD(&g->hi[v]), VSET(i));
+
+        VSTORE(&r[i][v], VBLEND(VLOAD(&r[i][v]), VANDNOT(high, in), VLOAD(&g->act[i][v])));
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Set value of 1 to the selected field of a scratch register.
+  */
+static void b_set1(lanes_t *r, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  for(i = g->dlo; i <= g->dhi; i++){
+    FOR_VEC(v){
+      const vec_t low = VEQ(VLOAD(&g->lo[v]), VSET(i));
+
+      VSTORE(&r[i][v], VAND(VAND(low, VLOAD(&g->act[i][v])), VSET(1)));
+    }
+  }
+}
+
+/**
+  * @brief  BCD addition z = x+y on the selected field, carry out to CY.
+  */
+static void b_add(hp45batch_t *batch, const lanes_t *x, const lanes_t *y, lanes_t *z, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  FOR_VEC(v){
+    vec_t cy = VSET(0);
+
+    for(i = g->dlo; i <= g->dhi; i++){
+      const vec_t m = VLOAD(&g->act[i][v]);
+      vec_t c = VADD(VADD(VLOAD(&x[i][v]), VLOAD(&y[i][v])), cy);
+      const vec_t over = VGT(c, VSET(9));
+
+      c = VSUB(c, VAND(over, VSET(10)));
+      cy = VBLEND(cy, VAND(over, VSET(1)), m);
+      VSTORE(&z[i][v], VBLEND(VLOAD(&z[i][v]), c, m));
+    }
+    VSTORE(&batch->CY[v], VBLEND(VLOAD(&batch->CY[v]), cy, VLOAD(&g->mask[v])));
+  }
+}
+
+/**
+  * @brief  BCD subtraction z = x-y on the selected field, borrow out to CY.
+  */
+static void b_sub(hp45batch_t *batch, const lanes_t *x, const lanes_t *y, lanes_t *z, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  FOR_VEC(v){
+    vec_t cy = VSET(0);
+
+    for(i = g->dlo; i <= g->dhi; i++){
+      const vec_t m = VLOAD(&g->act[i][v]);
+      vec_t c = VSUB(VSUB(VLOAD(&x[i][v]), VLOAD(&y[i][v])), cy);
+      const vec_t under = VGT(VSET(0), c);
+
+      c = VADD(c, VAND(under, VSET(10)));
+      cy = VBLEND(cy, VAND(under, VSET(1)), m);
+      VSTORE(&z[i][v], VBLEND(VLOAD(&z[i][v]), c, m));
+    }
+    VSTORE(&batch->CY[v], VBLEND(VLOAD(&batch->CY[v]), cy, VLOAD(&g->mask[v])));
+  }
+}
+
+/**
+  * @brief  r1 >= r2 comparison on the selected field. CY is set where r1 < r2.
+  */
+static void b_ifge(hp45batch_t *batch, const lanes_t *r1, const lanes_t *r2, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  FOR_VEC(v){
+    vec_t open = VLOAD(&g->mask[v]);  // lanes not decided yet
+    vec_t lt = VSET(0);
+
+    for(i = g->dhi; i >= g->dlo; i--){
+      const vec_t m = VAND(VLOAD(&g->act[i][v]), open);
+      const vec_t a = VLOAD(&r1[i][v]);
+      const vec_t b = VLOAD(&r2[i][v]);
+      const vec_t less = VAND(m, VGT(b, a));
+
+      lt = VOR(lt, less);
+      open = VANDNOT(VOR(less, VAND(m, VGT(a, b))), open);
+    }
+    VSTORE(&batch->CY[v], VBLEND(VLOAD(&batch->CY[v]), VAND(lt, VSET(1)), VLOAD(&g->mask[v])));
+  }
+}
+
+/**
+  * @brief  r == 0 comparison on the selected field. CY is set where r != 0.
+  */
+static void b_ifeq0(hp45batch_t *batch, const lanes_t *r, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  FOR_VEC(v){
+    vec_t nz = VSET(0);
+
+    for(i = g->dlo; i <= g->dhi; i++){
+      nz = VOR(nz, VANDNOT(VEQ(VLOAD(&r[i][v]), VSET(0)), VLOAD(&g->act[i][v])));
+    }
+    VSTORE(&batch->CY[v], VBLEND(VLOAD(&batch->CY[v]), VAND(nz, VSET(1)), VLOAD(&g->mask[v])));
+  }
+}
+
+/**
+  * @brief  Copy whole registers in every executing lane.
+  */
+static void b_copy(lanes_t *dst, const lanes_t *src, const group_t *g)
+{
+  uint16_t v;
+  int i;
+
+  for(i = 0; i < 14; i++){
+    FOR_VEC(v){
+      VSTORE(&dst[i][v], VBLEND(VLOAD(&dst[i][v]), VLOAD(&src[i][v]), VLOAD(&g->mask[v])));
+    }
+  }
+}
+
+/**
+  * @brief  Execute a type 2 (arithmetic/register) instruction.
+  * @param  batch: batch object
+  * @param  opcode: bit 2 to 9 of opcode
+  * @param  g: group, with mask filled in
+  * @retval None
+  */
+static void type2(hp45batch_t *batch, uint8_t opcode, group_t *g)
+{
+  lanes_t temp[14];
+
+  select_field(batch, opcode & 7, g);
+  PLANE_SET(batch->ws, VSET(opcode & 7), g->mask);
+  switch(opcode>>3){
+    case 0:  b_ifeq0(batch, RB, g); break;                          // 0-B
+    case 1:  b_mov(RB, zero, g); break;                             // 0->B
+    case 2:  b_ifge(batch, RA, RC, g); break;                       // A-C
+    case 3:  b_set1(temp, g); b_ifge(batch, RC, temp, g); break;    // C-1
+    case 4:  b_mov(RC, RB, g); break;                               // B->C
+    case 5:  b_sub(batch, zero, RC, RC, g); break;                  // 0-C->C
+    case 6:  b_mov(RC, zero, g); break;                             // 0->C
+    case 7:                                                         // 0-C-1->C
+      b_sub(batch, zero, RC, RC, g);
+      b_set1(temp, g);
+      b_sub(batch, RC, temp, RC, g);
+      PLANE_SET(batch->CY, VSET(1), g->mask);
+      break;
+    case 8:  b_shift(RA, 1, g); break;                              // shift A left
+    case 9:  b_mov(RB, RA, g); break;                               // A->B
+    case 10: b_sub(batch, RA, RC, RC, g); break;                    // A-C->C
+    case 11: b_set1(temp, g); b_sub(batch, RC, temp, RC, g); break; // C-1->C
+    case 12: b_mov(RA, RC, g); break;                               // C->A
+    case 13: b_ifeq0(batch, RC, g); break;                          // 0-C
+    case 14: b_add(batch, RA, RC, RC, g); break;                    // A+C->C
+    case 15: b_set1(temp, g); b_add(batch, RC, temp, RC, g); break; // C+1->C
+    case 16: b_ifge(batch, RA, RB, g); break;                       // A-B
+    case 17: b_exch(RB, RC, g); break;                              // B<->C
+    case 18: b_shift(RC, 0, g); break;                              // shift C right
+    case 19: b_set1(temp, g); b_ifge(batch, RA, temp, g); break;    // A-1
+    case 20: b_shift(RB, 0, g); break;                              // shift B right
+    case 21: b_add(batch, RC, RC, RC, g); break;                    // C+C->C
+    case 22: b_shift(RA, 0, g); break;                              // shift A right
+    case 23: b_mov(RA, zero, g); break;                             // 0->A
+    case 24: b_sub(batch, RA, RB, RA, g); break;                    // A-B->A
+    case 25: b_exch(RA, RB, g); break;                              // A<->B
+    case 26: b_sub(batch, RA, RC, RA, g); break;                    // A-C->A
+    case 27: b_set1(temp, g); b_sub(batch, RA, temp, RA, g); break; // A-1->A
+    case 28: b_add(batch, RA, RB, RA, g); break;                    // A+B->A
+    case 29: b_exch(RA, RC, g); break;                              // C<->A
+    case 30: b_add(batch, RA, RC, RA, g); break;                    // A+C->A
+    case 31: b_set1(temp, g); b_add(batch, RA, temp, RA, g); break; // A+1->A
+  }
+}
+
+/**
+  * @brief  Queue lanes to run from the given address. Lanes whose chunk of
+            cycles ran out leave the queue and keep the address in PC.
+  * @param  batch: batch object
+  * @param  sc: scheduling state
+  * @param  pc: address the lanes continue at
+  * @param  bits: lanes
+  * @retval None
+  */
+static void schedule(hp45batch_t *batch, sched_t *sc, uint16_t pc, lanebits_t bits)
+{
+  const lanebits_t out = bits & sc->done;
+  uint16_t l;
+  int i;
+
+  if(out){
+    FOR_BITS(l, out){
+      batch->PC[l] = pc;
+    }
+    bits &= ~out;
+  }
+  if(!bits)
+    return;
+  for(i = 0; i < sc->n; i++){
+    if(sc->grp[i].pc == pc){
+      sc->grp[i].bits |= bits;
+      return;
+    }
+  }
+  sc->grp[sc->n].pc = pc;
+  sc->grp[sc->n].bits = bits;
+  sc->n++;
+}
+
+/**
+  * @brief  Execute type 3-10 instructions (with opcode of xxxx_xxxx_00)
+            and queue the lanes at their next address.
+            Undefined opcodes only clear the carry, as in hp45_run.
+  * @param  batch: batch object
+  * @param  sc: scheduling state
+  * @param  pc: address of the instruction
+  * @param  opcode: bit 2 to 9 of opcode
+  * @param  g: group, with mask filled in
+  * @param  bits: executing lanes, same as g->mask
+  * @retval None
+  */
+static void type0(hp45batch_t *batch, sched_t *sc, uint16_t pc, uint8_t opcode, group_t *g, lanebits_t bits)
+{
+  const uint8_t N = opcode>>4;
+  const uint16_t next = (pc & 0xF00) | ((pc+1) & 0xFF);
+  const uint8_t *mask = g->mask;
+  lanes_t temp[14];
+  uint16_t l, v;
+  int i;
+
+  switch(opcode & 0x03){
+    case 0: // type 6-10: ROM select, misc
+      if(!(opcode & 0x04))break; // types 7-10: undefined or NOP
+      switch((opcode>>3) & 0x03){
+        case 0: // ROM select
+          schedule(batch, sc, (next & 0x0FF) | ((opcode>>5)<<8), bits);
+          return;
+        case 1: // subroutine return
+          FOR_BITS(l, bits){
+            schedule(batch, sc, (pc & 0xF00) | batch->LR[l], (lanebits_t)1 << l);
+          }
+          return;
+        case 2: // keyboard entry
+          if((opcode>>5) & 1){
+            FOR_BITS(l, bits){
+              schedule(batch, sc, (pc & 0xF00) | batch->KeyCode[l], (lanebits_t)1 << l);
+            }
+            return;
+          }
+          break;
+        case 3:
+          if(((opcode>>5) & 0x5) == 0x4){ // C -> data address
+            PLANE_SET(batch->DataAddr, VLOAD(&RC[12][v_]), mask);
+          }else if((opcode>>5) == 0x5){ // C -> data
+            FOR_LANES(l, mask){
+              if(batch->DataAddr[l] < 10){
+                for(i = 0; i < 14; i++)batch->RAM[batch->DataAddr[l]][i][l] = RC[i][l];
+              }
+            }
+          }
+          break;
+      }
+      break;
+    case 1: // type 3: status operations
+      switch((opcode>>2) & 0x03){
+        case 0: if(N < 12)PLANE_SET(batch->S[N], VSET(1), mask); break;
+        case 1: if(N < 12)PLANE_SET(batch->CY, VLOAD(&batch->S[N][v_]), mask); break;
+        case 2: if(N < 12)PLANE_SET(batch->S[N], VSET(0), mask); break;
+        case 3:
+          if(!N){
+            for(i = 0; i < 12; i++)PLANE_SET(batch->S[i], VSET(0), mask);
+          }
+          break;
+      }
+      break;
+    case 2: // type 5: data entry/display
+      switch((opcode>>2) & 0x03){
+        case 0: break;
+        case 1: // load constant
+          if(N >= 10)break;
+          for(i = 0; i < 14; i++){
+            FOR_VEC(v){
+              const vec_t m = VAND(VLOAD(&mask[v]), VEQ(VLOAD(&batch->P[v]), VSET(i)));
+
+              VSTORE(&RC[i][v], VBLEND(VLOAD(&RC[i][v]), VSET(N), m));
+            }
+          }
+          PLANE_SET(batch->P, VAND(VSUB(VLOAD(&batch->P[v_]), VSET(1)), VSET(0x0F)), mask);
+          break;
+        default:
+          switch(N){
+            case 0: PLANE_SET(batch->DispOn, VAND(VEQ(VLOAD(&batch->DispOn[v_]), VSET(0)), VSET(1)), mask); break;
+            case 2: b_copy(temp, RC, g); b_copy(RC, RM, g); b_copy(RM, temp, g); break;
+            case 4: b_copy(RF, RE, g); b_copy(RE, RD, g); b_copy(RD, RC, g); break;
+            case 6: b_copy(RA, RD, g); b_copy(RD, RE, g); b_copy(RE, RF, g); break;
+            case 8: PLANE_SET(batch->DispOn, VSET(0), mask); break;
+            case 10: b_copy(RC, RM, g); break;
+            case 11:
+              FOR_LANES(l, mask){
+                if(batch->DataAddr[l] < 10){
+                  for(i = 0; i < 14; i++)RC[i][l] = batch->RAM[batch->DataAddr[l]][i][l];
+                }
+              }
+              break;
+            case 12: b_copy(temp, RC, g); b_copy(RC, RD, g); b_copy(RD, RE, g); b_copy(RE, RF, g); b_copy(RF, temp, g); break;
+            case 14: for(i = 0; i < 7; i++)b_copy(batch->reg[i], zero, g); break;
+          }
+      }
+      break;
+    case 3: // type 4: pointer operations
+      switch((opcode>>2) & 0x03){
+        case 0: PLANE_SET(batch->P, VSET(N), mask); break;
+        case 1: PLANE_SET(batch->P, VAND(VSUB(VLOAD(&batch->P[v_]), VSET(1)), VSET(0x0F)), mask); break;
+        case 2: PLANE_SET(batch->CY, VAND(VEQ(VLOAD(&batch->P[v_]), VSET(N)), VSET(1)), mask); break;
+        case 3: PLANE_SET(batch->P, VAND(VADD(VLOAD(&batch->P[v_]), VSET(1)), VSET(0x0F)), mask); break;
+      }
+      break;
+  }
+  schedule(batch, sc, next, bits);
+}
+
+/**
+  * @brief  Fetch and execute the instruction at pc in every lane of the group,
+            then queue the lanes at their next address.
+  * @param  batch: batch object
+  * @param  sc: scheduling state
+  * @param  pc: common program counter of the group
+  * @param  bits: executing lanes
+  * @param  g: group, with mask filled in from bits
+  * @retval None
+  */
+static void issue(hp45batch_t *batch, sched_t *sc, uint16_t pc, lanebits_t bits, group_t *g)
+{
+  const uint16_t opcode = ROM[pc];
+  const uint16_t next = (pc & 0xF00) | ((pc+1) & 0xFF);
+  const uint16_t target = (pc & 0xF00) | (opcode>>2);
+  const uint8_t *mask = g->mask;
+  lanebits_t done = 0, nocarry = 0;
+  uint16_t v;
+
+  FOR_VEC(v){
+    const vec_t m = VLOAD(&mask[v]);
+    const vec_t budget = VSUB(VLOAD(&sc->budget[v]), VAND(m, VSET(1)));
+    const vec_t cy = VLOAD(&batch->CY[v]);
+
+    VSTORE(&sc->budget[v], budget);
+    done |= (lanebits_t)VMOVEMASK(VAND(m, VEQ(budget, VSET(0)))) << v;
+    nocarry |= (lanebits_t)VMOVEMASK(VEQ(cy, VSET(0))) << v;
+    VSTORE(&batch->CY[v], VANDNOT(m, cy));
+    VSTORE(&batch->S[0][v], VBLEND(VLOAD(&batch->S[0][v]), VLOAD(&batch->keydown[v]), m));
+  }
+  sc->done = done;
+  switch(opcode & 0x003){
+    case 0:
+      type0(batch, sc, pc, opcode>>2, g, bits);
+      break;
+    case 1: // jump subroutine
+      PLANE_SET(batch->LR, VSET(next & 0xFF), mask);
+      schedule(batch, sc, target, bits);
+      break;
+    case 2:
+      type2(batch, opcode>>2, g);
+      schedule(batch, sc, next, bits);
+      break;
+    case 3: // conditional branch, taken if no carry
+      schedule(batch, sc, target, bits & nocarry);
+      schedule(batch, sc, next, bits & ~nocarry);
+      break;
+  }
+}
+
+/**
+  * @brief  Choose the next group to issue: the lowest address, by offset
+            within the ROM page. HP-45 code mostly flows forward within a
+            page, so lanes that took a shorter path wait at the higher address
+            until the others catch up, and then run together again.
+  * @param  sc: scheduling state, with at least one group
+  * @retval int: index of the group
+  */
+static int pick(const sched_t *sc)
+{
+  uint16_t key, best = 0xFFFF;
+  int i, index = 0;
+
+  for(i = 0; i < sc->n; i++){
+    key = ((sc->grp[i].pc & 0xFF) << 3) | (sc->grp[i].pc >> 8);
+    if(key < best){
+      best = key;
+      index = i;
+    }
+  }
+
+  return index;
+}
+
+/**
+  * @brief  Start the next chunk of at most CHUNK cycles for every lane with
+            cycles left, and queue those lanes at their PC.
+  * @param  batch: batch object
+  * @param  sc: scheduling state, all chunks finished
+  * @retval int: zero if no lane has cycles left.
+  */
+static int refill(hp45batch_t *batch, sched_t *sc)
+{
+  uint16_t l;
+
+  sc->n = 0;
+  sc->done = 0;
+  for(l = 0; l < HP45_BATCH_LANES; l++){
+    sc->budget[l] = sc->rest[l] < CHUNK ? sc->rest[l] : CHUNK;
+    sc->rest[l] -= sc->budget[l];
+    if(sc->budget[l])
+      schedule(batch, sc, batch->PC[l], (lanebits_t)1 << l);
+  }
+
+  return sc->n;
+}
+
+/**
+  * @brief  Fast-forward the lanes at a key poll instruction that wait in the
+            idle loop, as hp45_fast_forward does, so they stop taking issue slots.
+  * @param  batch: batch object
+  * @param  sc: scheduling state
+  * @param  pc: address of the key poll instruction
+  * @param  bits: lanes at pc
+  * @retval lanebits_t: lanes at pc that still have cycles in their chunk.
+  */
+static lanebits_t retire_idle(hp45batch_t *batch, sched_t *sc, uint16_t pc, lanebits_t bits)
+{
+  hp45inst_t lane;
+  uint32_t left, skipped;
+  uint16_t l;
+
+  FOR_BITS(l, bits){
+    left = sc->rest[l] + sc->budget[l];
+    if(batch->keydown[l] || left <= IDLE_SKIP_MIN)continue;
+    batch->PC[l] = pc;
+    hp45batch_store(batch, l, &lane);
+    skipped = hp45_fast_forward(&lane, left);
+    if(skipped){
+      left -= skipped;
+      sc->budget[l] = left < CHUNK ? left : CHUNK;
+      sc->rest[l] = left - sc->budget[l];
+      if(!sc->budget[l])
+        bits &= ~((lanebits_t)1 << l);
+    }
+  }
+
+  return bits;
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Initialize all lanes to the power-on state of hp45_init.
+  * @param  batch: batch object
+  * @retval None
+  */
+void hp45batch_init(hp45batch_t *batch)
+{
+  memset(batch, 0, sizeof(hp45batch_t));
+}
+
+/**
+  * @brief  Copy a calculator into one lane.
+  * @param  batch: batch object
+  * @param  lane: lane index, less than HP45_BATCH_LANES
+  * @param  instance: HP-45 memory object to copy from
+  * @retval None
+  */
+void hp45batch_load(hp45batch_t *batch, uint16_t lane, const hp45inst_t *instance)
+{
+  const reg_t *regs = &instance->A;
+  uint8_t r, i;
+
+  for(r = 0; r < 7; r++){
+    for(i = 0; i < 14; i++)batch->reg[r][i][lane] = HP45_DIGIT(&regs[r], i);
+  }
+  for(r = 0; r < 10; r++){
+    for(i = 0; i < 14; i++)batch->RAM[r][i][lane] = HP45_DIGIT(&instance->RAM[r], i);
+  }
+  for(i = 0; i < 12; i++){
+    batch->S[i][lane] = (instance->S >> i) & 1;
+  }
+  batch->PC[lane] = instance->PC;
+  batch->LR[lane] = instance->LR;
+  batch->KeyCode[lane] = instance->KeyCode;
+  batch->P[lane] = instance->P;
+  batch->DataAddr[lane] = instance->DataAddr;
+  batch->ws[lane] = instance->ws;
+  batch->CY[lane] = instance->CY;
+  batch->keydown[lane] = instance->keydown;
+  batch->DispOn[lane] = instance->DispOn;
+  batch->cycles[lane] = instance->cycles;
+}
+
+/**
+  * @brief  Copy one lane out to a calculator, e.g. to call make_display.
+  * @param  batch: batch object
+  * @param  lane: lane index, less than HP45_BATCH_LANES
+  * @param  instance: HP-45 memory object to copy to
+  * @retval None
+  */
+void hp45batch_store(const hp45batch_t *batch, uint16_t lane, hp45inst_t *instance)
+{
+  reg_t *regs = &instance->A;
+  uint8_t r, i;
+
+  memset(instance, 0, sizeof(hp45inst_t));
+  for(r = 0; r < 7; r++){
+    for(i = 0; i < 14; i++)HP45_SET_DIGIT(&regs[r], i, batch->reg[r][i][lane]);
+  }
+  for(r = 0; r < 10; r++){
+    for(i = 0; i < 14; i++)HP45_SET_DIGIT(&instance->RAM[r], i, batch->RAM[r][i][lane]);
+  }
+  for(i = 0; i < 12; i++){
+    instance->S |= (uint16_t)batch->S[i][lane] << i;
+  }
+  instance->PC = batch->PC[lane];
+  instance->LR = batch->LR[lane];
+  instance->KeyCode = batch->KeyCode[lane];
+  instance->P = batch->P[lane];
+  instance->DataAddr = batch->DataAddr[lane];
+  instance->ws = batch->ws[lane];
+  instance->CY = batch->CY[lane];
+  instance->keydown = batch->keydown[lane];
+  instance->DispOn = batch->DispOn[lane];
+  instance->cycles = batch->cycles[lane];
+}
+
+/**
+  * @brief  Notice one lane that a key is pressed.
+  * @param  batch: batch object
+  * @param  lane: lane index
+  * @param  keycode: HP-45 native key code
+  * @retval None
+  */
+void hp45batch_key_down(hp45batch_t *batch, uint16_t lane, uint8_t keycode)
+{
+  batch->KeyCode[lane] = keycode;
+  batch->keydown[lane] = 1;
+}
+
+/**
+  * @brief  Notice one lane that a key is released.
+  * @param  batch: batch object
+  * @param  lane: lane index
+  * @retval None
+  */
+void hp45batch_key_up(hp45batch_t *batch, uint16_t lane)
+{
+  batch->keydown[lane] = 0;
+}
+
+/**
+  * @brief  Advance every lane by the given number of word-cycles.
+            Events do not stop the run: each lane ends in the same state as a
+            calculator after the same number of hp45_run calls, except that
+            fields past digit 13 (P > 13, never used by the HP-45 firmware) are clipped.
+            Lanes that diverge wait while the group at the lowest address runs.
+            Lanes that reach the idle keyboard loop are fast-forwarded.
+  * @param  batch: batch object
+  * @param  cycles: word-cycles to run in every lane
+  * @retval uint32_t: number of issued instructions. On average
+                      HP45_BATCH_LANES*cycles/issued lanes ran per instruction.
+  */
+uint32_t hp45batch_run_cycles(hp45batch_t *batch, uint32_t cycles)
+{
+  sched_t sc;
+  group_t g;
+  lanebits_t bits;
+  uint32_t issued = 0;
+  uint16_t l, pc;
+  int i;
+
+  for(l = 0; l < HP45_BATCH_LANES; l++){
+    sc.rest[l] = cycles;
+  }
+  while(refill(batch, &sc)){
+    while(sc.n){
+      i = pick(&sc);
+      pc = sc.grp[i].pc;
+      bits = sc.grp[i].bits;
+      sc.grp[i] = sc.grp[--sc.n];
+      if(ROM[pc] == OPCODE_TEST_KEY && !(bits = retire_idle(batch, &sc, pc, bits)))
+        continue;
+      for(l = 0; l < HP45_BATCH_LANES; l++){
+        g.mask[l] = 0 - (uint8_t)((bits >> l) & 1);
+      }
+      issue(batch, &sc, pc, bits, &g);
+      issued++;
+    }
+  }
+  for(l = 0; l < HP45_BATCH_LANES; l++){
+    batch->cycles[l] += cycles;
+  }
+
+  return issued;
+}
@@ -0,0 +1,45 @@
+#ifndef __HP45BATCH_H
+#define __HP45BATCH_H
+
+#include <stdint.h>
+#include "hp45sim.h"
+
+/* Configuration -------------------------------------------------------------*/
+/* HP45_BATCH_LANES: number of calculators held by one hp45batch_t, 32 or 64.
+ * 32 fills one AVX2 vector.
+ */
+#ifndef HP45_BATCH_LANES
+#define HP45_BATCH_LANES 32
+#endif
+
+/* Many HP-45 instances in structure-of-arrays layout: digit i of register r
+ * of all lanes is stored contiguously in reg[r][i][], so one vector operation
+ * works on the same digit of many calculators. Scalar state is kept as one
+ * array per field, and the status bits as one array per bit. Lanes are
+ * independent; use hp45batch_load/store to move a calculator between this
+ * layout and hp45inst_t.
+ */
+typedef struct{
+  uint8_t reg[7][14][HP45_BATCH_LANES];  // digit planes of A, B, C, D, E, F, M in hp45inst_t order
+  uint8_t RAM[10][14][HP45_BATCH_LANES]; // digit planes of auxiliary data storage
+  uint8_t S[12][HP45_BATCH_LANES];       // status bits, one plane per bit
+  uint16_t PC[HP45_BATCH_LANES];
+  uint8_t LR[HP45_BATCH_LANES];
+  uint8_t KeyCode[HP45_BATCH_LANES];
+  uint8_t P[HP45_BATCH_LANES];
+  uint8_t DataAddr[HP45_BATCH_LANES];
+  uint8_t ws[HP45_BATCH_LANES];
+  uint8_t CY[HP45_BATCH_LANES];
+  uint8_t keydown[HP45_BATCH_LANES];
+  uint8_t DispOn[HP45_BATCH_LANES];
+  uint32_t cycles[HP45_BATCH_LANES];
+} hp45batch_t;
+
+void hp45batch_init(hp45batch_t*);
+void hp45batch_load(hp45batch_t*, uint16_t, const hp45inst_t*);
+void hp45batch_store(const hp45batch_t*, uint16_t, hp45inst_t*);
+void hp45batch_key_down(hp45batch_t*, uint16_t, uint8_t);
+void hp45batch_key_up(hp45batch_t*, uint16_t);
+uint32_t hp45batch_run_cycles(hp45batch_t*, uint32_t);
+
+#endif /* __HP45BATCH_H */
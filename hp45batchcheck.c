@@ -0,0 +1,138 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Lockstep test of the batch engine: runs HP45_BATCH_LANES calculators in one
+ * hp45batch_t and the same number of scalar calculators from power-on, presses
+ * and releases random keys in each lane, runs all of them for the same random
+ * number of word-cycles and compares every lane (hp45_snapshot) with its
+ * scalar twin after every round. Stops at the first difference and exits 1.
+ * hp45batch.c picks AVX2, SSE2 or plain byte operations from the target
+ * flags, so build it once per backend:
+ *   cc -O2 -mavx2 -o hp45batchcheck hp45batchcheck.c hp45batch.c hp45snap.c hp45sim.c
+ *   cc -O2 -o hp45batchcheck hp45batchcheck.c hp45batch.c hp45snap.c hp45sim.c
+ *   cc -O2 -mno-sse2 -o hp45batchcheck hp45batchcheck.c hp45batch.c hp45snap.c hp45sim.c
+ *   ./hp45batchcheck [rounds] [seed]
+ * The second line is SSE2 on x86-64, the third the plain byte backend.
+ * Add -DHP45_BATCH_LANES=64 to check 64 lanes.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+#include "hp45batch.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     35
+#define BUDGET_MAX    3000    // word-cycles per round, at most
+
+/* Private variables ---------------------------------------------------------*/
+/* native codes of all keys */
+static const uint8_t Keys[KEY_COUNT] = {
+  006, 004, 003, 002, 000, 056, 054, 053, 052, 050, 016, 014,
+  013, 012, 010, 076, 073, 072, 070, 066, 064, 063, 062, 026,
+  024, 023, 022, 036, 034, 033, 032, 046, 044, 043, 042,
+};
+
+#if defined(__AVX2__)
+static const char *const Backend = "AVX2";
+#elif defined(__SSE2__)
+static const char *const Backend = "SSE2";
+#else
+static const char *const Backend = "scalar";
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Print the scalar state of a calculator.
+  * @param  name: engine name
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+static void print_state(const char *name, const hp45inst_t *instance)
+{
+  printf("  %-7s pc %03x cy %u p %2u s %03x lr %02x cycles %lu\n", name, instance->PC,
+         instance->CY, instance->P, instance->S, instance->LR, (unsigned long)instance->cycles);
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static hp45batch_t batch;
+  static hp45inst_t calc[HP45_BATCH_LANES];
+  hp45inst_t lane;
+  uint8_t a[HP45_SNAPSHOT_SIZE], b[HP45_SNAPSHOT_SIZE], key;
+  unsigned long rounds = argc > 1 ? strtoul(argv[1], NULL, 0) : 2000, n;
+  uint32_t x = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1, budget;
+  uint64_t issued = 0;
+  uint16_t i;
+
+  if(!x)x = 1;
+  hp45batch_init(&batch);
+  for(i = 0; i < HP45_BATCH_LANES; i++){
+    hp45_init(&calc[i]);
+  }
+  for(n = 0; n < rounds; n++){
+    for(i = 0; i < HP45_BATCH_LANES; i++){
+      switch(next_random(&x) % 4){
+        case 0: // press a key
+          key = Keys[next_random(&x) % KEY_COUNT];
+          hp45batch_key_down(&batch, i, key);
+          key_down(&calc[i], key);
+          break;
+        case 1:
+          hp45batch_key_up(&batch, i);
+          key_up(&calc[i]);
+          break;
+      }
+    }
+    budget = next_random(&x) % BUDGET_MAX + 1;
+    issued += hp45batch_run_cycles(&batch, budget);
+    for(i = 0; i < HP45_BATCH_LANES; i++){
+      hp45_run_until(&calc[i], HP45_EVENT_NONE, budget);
+      hp45batch_store(&batch, i, &lane);
+      hp45_snapshot(&calc[i], a);
+      hp45_snapshot(&lane, b);
+      if(memcmp(a, b, HP45_SNAPSHOT_SIZE)){
+        printf("FAIL: %s, round %lu, lane %u after %lu word-cycles\n", Backend, n, i, (unsigned long)budget);
+        print_state("scalar", &calc[i]);
+        print_state("batch", &lane);
+        return 1;
+      }
+    }
+  }
+  printf("ok: %s, %d lanes, %lu rounds, %lu word-cycles per lane, %llu issues\n", Backend, HP45_BATCH_LANES,
+         rounds, (unsigned long)calc[0].cycles, (unsigned long long)issued);
+  return 0;
+}
@@ -0,0 +1,415 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Benchmarks: emulator throughput, cost per instruction class, key press
+ * latency of the slow functions and scaling across threads. Results are
+ * printed as CSV rows "section,name,value,unit", starting with the build
+ * options, so runs of different versions can be compared line by line.
+ *   cc -O2 -pthread -o hp45bench hp45bench.c hp45utils.c hp45sim.c
+ *   ./hp45bench [max-threads] > results.csv
+ * Add the same HP45_* options as the build under test.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  const char *name;
+  const char *setup;  // keys pressed before the measured one
+  const char *key;    // measured key
+} function_t;
+
+typedef struct{
+  const char *name;
+  int (*decode)(hp45inst_t*, uint8_t);
+  uint8_t type;       // hp45_opcode_type of the instructions it decodes
+  uint8_t ops[256];   // defined instructions, opcode>>2
+  int count;
+} opclass_t;
+
+typedef struct{
+  pthread_t thread;
+  uint64_t rounds;
+  uint64_t cycles;
+} worker_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define MIN_TIME_NS   200000000u  // measure each item for at least this long
+#define REPEATS       3           // best of
+#define NS_PER_CYCLE  (10000000.0/35) // HP-45 word-cycle time, 35 per 10ms
+
+/* Private variables ---------------------------------------------------------*/
+/* instruction decoders of hp45sim.c, not part of its interface */
+int opcode10(hp45inst_t*, uint8_t);
+int opcode0100(hp45inst_t*, uint8_t);
+int opcode1100(hp45inst_t*, uint8_t);
+int opcode1000(hp45inst_t*, uint8_t);
+int opcode0000(hp45inst_t*, uint8_t);
+
+static const function_t Functions[] = {
+  {"sin", "1", "SIN"},
+  {"ln", "2", "LN"},
+  {"e^x", "1", "E^X"},
+  {"y^x", "2 ENTER 3 F", "1/X"},
+  {"->p", "3 ENTER 4", "->P"},
+  {"->r", "5 ENTER 53 F", "->P"},
+};
+
+static opclass_t Classes[] = {
+  {"opcode10 arithmetic", opcode10, 2, {0}, 0},
+  {"opcode0100 status", opcode0100, 3, {0}, 0},
+  {"opcode1100 pointer", opcode1100, 4, {0}, 0},
+  {"opcode1000 data/display", opcode1000, 5, {0}, 0},
+  {"opcode0000 rom select/misc", opcode0000, 6, {0}, 0},
+};
+
+/* calculators busy right after a key press, and how long each stays busy */
+static hp45inst_t Busy[sizeof(Functions)/sizeof(Functions[0])];
+static uint32_t BusyCycles[sizeof(Functions)/sizeof(Functions[0])];
+static uint32_t WorkCycles;   // sum of BusyCycles
+static hp45inst_t Idle;       // calculator waiting for a key
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Press the keys of a script.
+  * @param  instance: HP-45 memory object
+  * @param  script: key names, see hp45_parse_keys
+  * @retval int: 0 on success, -1 if a key was not taken.
+  */
+static int press_keys(hp45inst_t *instance, const char *script)
+{
+  uint8_t keys[32];
+  int n, i;
+
+  n = hp45_parse_keys(script, keys, sizeof(keys));
+  for(i = 0; i < n; i++){
+    if(hp45_press_key(instance, keys[i]) < 0)
+      return -1;
+  }
+  return n < 0 ? -1 : 0;
+}
+
+/**
+  * @brief  Prepare the workload: each function, stopped as soon as its key was taken.
+  * @param  None
+  * @retval int: 0 on success, -1 if a function failed.
+  */
+static int prepare_work(void)
+{
+  hp45inst_t calc;
+  uint8_t key;
+  unsigned f;
+  int32_t settle;
+
+  hp45_init_ready(&Idle);
+  WorkCycles = 0;
+  for(f = 0; f < sizeof(Functions)/sizeof(Functions[0]); f++){
+    hp45_init_ready(&calc);
+    if(press_keys(&calc, Functions[f].setup) || hp45_parse_keys(Functions[f].key, &key, 1) != 1)
+      return -1;
+    key_down(&calc, key);
+    if(hp45_run_until(&calc, HP45_EVENT_KEY, 100000) != HP45_EVENT_KEY)
+      return -1;
+    key_up(&calc);
+    Busy[f] = calc;
+    settle = hp45_settle(&calc);
+    if(settle <= 0)
+      return -1;
+    BusyCycles[f] = settle;
+    WorkCycles += settle;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Run the workload once with one hp45_run call per cycle.
+  * @param  None
+  * @retval uint64_t: cycles executed
+  */
+static uint64_t work_run(void)
+{
+  hp45inst_t calc;
+  uint32_t c;
+  unsigned f;
+
+  for(f = 0; f < sizeof(Functions)/sizeof(Functions[0]); f++){
+    calc = Busy[f];
+    for(c = BusyCycles[f]; c; c--){
+      hp45_run(&calc);
+    }
+  }
+  return WorkCycles;
+}
+
+/**
+  * @brief  Run the workload once in 35-cycle (10ms) slices of hp45_run_cycles.
+  * @param  None
+  * @retval uint64_t: cycles executed
+  */
+static uint64_t work_run_cycles(void)
+{
+  hp45inst_t calc;
+  uint32_t c;
+  unsigned f;
+
+  for(f = 0; f < sizeof(Functions)/sizeof(Functions[0]); f++){
+    calc = Busy[f];
+    for(c = BusyCycles[f]; c >= 35; c -= 35){
+      hp45_run_cycles(&calc, 35, NULL);
+    }
+    hp45_run_cycles(&calc, c, NULL);
+  }
+  return WorkCycles;
+}
+
+/**
+  * @brief  Run the idle keyboard loop in 35-cycle slices.
+  * @param  None
+  * @retval uint64_t: cycles executed
+  */
+static uint64_t work_idle(void)
+{
+  int i;
+
+  for(i = 0; i < 1000; i++){
+    hp45_run_cycles(&Idle, 35, NULL);
+  }
+  return 35000;
+}
+
+/**
+  * @brief  Time a workload: best rate of REPEATS runs of at least MIN_TIME_NS each.
+  * @param  work: workload, returns its number of units
+  * @retval double: nanoseconds per unit
+  */
+static double measure(uint64_t (*work)(void))
+{
+  double best = 0, ns;
+  uint64_t start, units;
+  int r;
+
+  for(r = 0; r < REPEATS; r++){
+    units = 0;
+    start = now_ns();
+    do{
+      units += work();
+    }while(now_ns() - start < MIN_TIME_NS);
+    ns = (double)(now_ns() - start)/units;
+    if(!r || ns < best)best = ns;
+  }
+  return best;
+}
+
+/**
+  * @brief  Collect the defined instructions of each class.
+  * @param  None
+  * @retval None
+  */
+static void prepare_classes(void)
+{
+  hp45inst_t calc;
+  unsigned c;
+  uint16_t opcode;
+
+  for(c = 0; c < sizeof(Classes)/sizeof(Classes[0]); c++){
+    Classes[c].count = 0;
+    for(opcode = 0; opcode < 1024; opcode++){
+      if(hp45_opcode_type(opcode) != Classes[c].type)
+        continue;
+      calc = Busy[0];
+      if(Classes[c].decode(&calc, opcode>>2) >= 0)
+        Classes[c].ops[Classes[c].count++] = opcode>>2;
+    }
+  }
+}
+
+static const opclass_t *Class; // class measured by work_class
+
+/**
+  * @brief  Decode every defined instruction of Class once, on a busy calculator.
+  * @param  None
+  * @retval uint64_t: instructions executed
+  */
+static uint64_t work_class(void)
+{
+  hp45inst_t calc = Busy[0];
+  int i, r;
+
+  for(r = 0; r < 16; r++){
+    for(i = 0; i < Class->count; i++){
+      Class->decode(&calc, Class->ops[i]);
+    }
+    calc.P = Busy[0].P;
+  }
+  return 16*Class->count;
+}
+
+/**
+  * @brief  Worker thread of the scaling test: run the workload a given number of times.
+  * @param  arg: worker_t
+  * @retval NULL
+  */
+static void *worker(void *arg)
+{
+  worker_t *w = arg;
+  uint64_t r;
+
+  for(w->cycles = 0, r = 0; r < w->rounds; r++){
+    w->cycles += work_run_cycles();
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Run the workload on several threads at once.
+  * @param  threads: number of threads
+  * @param  rounds: workload runs per thread
+  * @retval double: cycles per second of all threads together, 0 on error.
+  */
+static double run_threads(int threads, uint64_t rounds)
+{
+  worker_t *w = calloc(threads, sizeof(worker_t));
+  uint64_t start, cycles = 0;
+  int t, started;
+
+  if(!w)
+    return 0;
+  start = now_ns();
+  for(started = 0; started < threads; started++){
+    w[started].rounds = rounds;
+    if(pthread_create(&w[started].thread, NULL, worker, &w[started]))
+      break;
+  }
+  for(t = 0; t < started; t++){
+    pthread_join(w[t].thread, NULL);
+    cycles += w[t].cycles;
+  }
+  free(w);
+  return started == threads ? cycles*1e9/(now_ns() - start) : 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  int max_threads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+  uint64_t rounds, start;
+  double ns, rate, single = 0;
+  unsigned f, c;
+  int threads, i;
+  int32_t cycles;
+  hp45inst_t calc, ready;
+  uint8_t key;
+
+  if(max_threads < 1)max_threads = 1;
+  if(prepare_work()){
+    fprintf(stderr, "hp45bench: workload failed\n");
+    return 1;
+  }
+  prepare_classes();
+
+  printf("section,name,value,unit\n");
+#ifdef HP45_PREDECODE
+  printf("config,HP45_PREDECODE,1,\n");
+#endif
+#ifdef HP45_NO_FUSION
+  printf("config,HP45_NO_FUSION,1,\n");
+#endif
+#ifdef HP45_RECOMPILED
+  printf("config,HP45_RECOMPILED,1,\n");
+#endif
+#ifdef HP45_REG_SWAR
+  printf("config,HP45_REG_SWAR,1,\n");
+#endif
+#ifdef HP45_REG_PACKED
+  printf("config,HP45_REG_PACKED,1,\n");
+#endif
+#ifdef HP45_PROFILE
+  printf("config,HP45_PROFILE,1,\n");
+#endif
+#ifdef HP45_TRACE
+  printf("config,HP45_TRACE,1,\n");
+#endif
+  printf("config,rom,%08lx,fingerprint\n", (unsigned long)hp45_rom_fingerprint());
+  printf("config,hp45inst_t,%u,bytes\n", (unsigned)sizeof(hp45inst_t));
+  printf("config,workload,%u,cycles\n", (unsigned)WorkCycles);
+
+  // throughput on the key press workload, and on the idle loop
+  ns = measure(work_run);
+  printf("throughput,hp45_run,%.2f,Mcycles/s\n", 1e3/ns);
+  printf("throughput,hp45_run,%.2f,ns/cycle\n", ns);
+  ns = measure(work_run_cycles);
+  printf("throughput,hp45_run_cycles,%.2f,Mcycles/s\n", 1e3/ns);
+  printf("throughput,hp45_run_cycles,%.2f,ns/cycle\n", ns);
+  printf("throughput,realtime,%.0f,instances\n", NS_PER_CYCLE/ns);
+  ns = measure(work_idle);
+  printf("throughput,idle,%.2f,Mcycles/s\n", 1e3/ns);
+
+  // cost of one decode call, including the call itself
+  for(c = 0; c < sizeof(Classes)/sizeof(Classes[0]); c++){
+    Class = &Classes[c];
+    printf("opclass,%s,%.2f,ns/op\n", Class->name, measure(work_class));
+  }
+
+  // from pressing the key to the display settling, in HP-45 and host time
+  for(f = 0; f < sizeof(Functions)/sizeof(Functions[0]); f++){
+    hp45_init_ready(&ready);
+    press_keys(&ready, Functions[f].setup);
+    hp45_parse_keys(Functions[f].key, &key, 1);
+    for(i = 0, start = now_ns(); i < 100; i++){
+      calc = ready;
+      cycles = hp45_press_key(&calc, key);
+    }
+    ns = (double)(now_ns() - start)/100;
+    printf("latency,%s,%ld,cycles\n", Functions[f].name, (long)cycles);
+    printf("latency,%s,%.1f,hp45_ms\n", Functions[f].name, cycles*NS_PER_CYCLE/1e6);
+    printf("latency,%s,%.1f,host_us\n", Functions[f].name, ns/1e3);
+  }
+
+  // several calculators on several threads, about MIN_TIME_NS per thread
+  rounds = (uint64_t)(MIN_TIME_NS/(measure(work_run_cycles)*WorkCycles)) + 1;
+  for(threads = 1; threads <= max_threads; threads = threads < max_threads && threads*2 > max_threads ? max_threads : threads*2){
+    rate = run_threads(threads, rounds);
+    if(threads == 1)single = rate;
+    printf("scaling,%d,%.2f,Mcycles/s\n", threads, rate/1e6);
+    printf("scaling,%d,%.2f,efficiency\n", threads, single > 0 ? rate/(single*threads) : 0);
+    if(threads == max_threads)break;
+  }
+  return 0;
+}
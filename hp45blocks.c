@@ -0,0 +1,14587 @@
+/* Generated by hp45recomp from hp45rom.c. Do not edit.
+ * Included by hp45sim.c when HP45_RECOMPILED is defined.
+ */
+
+static int block_000(hp45inst_t *instance)
+{
+  /* 000: jsb 2b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x01;
+  instance->PC = 0x02b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_001(hp45inst_t *instance)
+{
+  /* 001: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x602;
+  return 0;
+}
+
+static int block_002(hp45inst_t *instance)
+{
+  /* 002: jsb 4a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x03;
+  instance->PC = 0x04a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_003(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 003: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 004: A+1->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_M);
+  /* 005: A->B [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->B, &instance->A, FIELD_XS);
+  /* 006: A-1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 007: A+B->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 008: 0->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &zero, FIELD_X);
+  /* 009: jsb e2 */
+  instance->LR = 0x0a;
+  instance->PC = 0x0e2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_00a(hp45inst_t *instance)
+{
+  /* 00a: jsb e2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x0b;
+  instance->PC = 0x0e2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_00b(hp45inst_t *instance)
+{
+  /* 00b: 0->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &zero, FIELD_X);
+  /* 00c: jsb c9 */
+  instance->LR = 0x0d;
+  instance->PC = 0x0c9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_00d(hp45inst_t *instance)
+{
+  /* 00d: then go to 64 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x00e : 0x064;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_00e(hp45inst_t *instance)
+{
+  /* 00e: if s8 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 8) & 1;
+  /* 00f: then go to 51 */
+  instance->PC = instance->CY ? 0x010 : 0x051;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_010(hp45inst_t *instance)
+{
+  /* 010: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x11;
+  instance->PC = 0x087;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_011(hp45inst_t *instance)
+{
+  /* 011: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 012: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 013: then go to 02 */
+  instance->PC = instance->CY ? 0x014 : 0x002;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_014(hp45inst_t *instance)
+{
+  /* 014: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x515;
+  return 0;
+}
+
+static int block_015(hp45inst_t *instance)
+{
+  /* 015: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x16;
+  instance->PC = 0x087;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_016(hp45inst_t *instance)
+{
+  /* 016: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 017: rom 4 */
+  instance->CY = 0;
+  instance->PC = 0x418;
+  return 0;
+}
+
+static int block_018(hp45inst_t *instance)
+{
+  /* 018: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x119;
+  return 0;
+}
+
+static int block_019(hp45inst_t *instance)
+{
+  /* 019: if s3 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 3) & 1;
+  /* 01a: then go to 18 */
+  instance->PC = instance->CY ? 0x01b : 0x018;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_01b(hp45inst_t *instance)
+{
+  /* 01b: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 01c: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 01d: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 01e: nop */
+  instance->CY = 0;
+  /* 01f: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 020: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 021: jsb 9e */
+  instance->LR = 0x22;
+  instance->PC = 0x09e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_022(hp45inst_t *instance)
+{
+  /* 022: jsb c6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x23;
+  instance->PC = 0x0c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_023(hp45inst_t *instance)
+{
+  /* 023: jsb a2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x24;
+  instance->PC = 0x0a2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_024(hp45inst_t *instance)
+{
+  /* 024: jsb c6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x25;
+  instance->PC = 0x0c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_025(hp45inst_t *instance)
+{
+  /* 025: 0->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &zero, FIELD_S);
+  /* 026: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 027: 0-C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->CX, FIELD_S);
+  /* 028: then go to 2d */
+  instance->PC = instance->CY ? 0x029 : 0x02d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_029(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 029: A-1->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 02a: jsb 2d */
+  instance->LR = 0x2b;
+  instance->PC = 0x02d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_02b(hp45inst_t *instance)
+{
+  /* 02b: then go to 14 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x02c : 0x014;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_02c(hp45inst_t *instance)
+{
+  /* 02c: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x12d;
+  return 0;
+}
+
+static int block_02d(hp45inst_t *instance)
+{
+  /* 02d: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 02e: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  /* 02f: then go to f2 */
+  instance->PC = instance->CY ? 0x030 : 0x0f2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_030(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 030: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  /* 031: jsb f2 */
+  instance->LR = 0x32;
+  instance->PC = 0x0f2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_032(hp45inst_t *instance)
+{
+  /* 032: if s1 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 1) & 1;
+  /* 033: then go to 2c */
+  instance->PC = instance->CY ? 0x034 : 0x02c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_034(hp45inst_t *instance)
+{
+  /* 034: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 035: then go to 69 */
+  instance->PC = instance->CY ? 0x036 : 0x069;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_036(hp45inst_t *instance)
+{
+  /* 036: then go to 3a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x037 : 0x03a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_037(hp45inst_t *instance)
+{
+  /* 037: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x138;
+  return 0;
+}
+
+static int block_038(hp45inst_t *instance)
+{
+  /* 038: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 039: rom 1 */
+  instance->CY = 0;
+  instance->PC = 0x13a;
+  return 0;
+}
+
+static int block_03a(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 03a: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 03b: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 03c: C+1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 03d: then go to 46 */
+  instance->PC = instance->CY ? 0x03e : 0x046;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_03e(hp45inst_t *instance)
+{
+  /* 03e: 0-C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  ifeq0(instance, &instance->CX, FIELD_X);
+  /* 03f: then go to 46 */
+  instance->PC = instance->CY ? 0x040 : 0x046;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_040(hp45inst_t *instance)
+{
+  /* 040: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 041: 0 -> p */
+  instance->CY = 0;
+  instance->P = 0;
+  /* 042: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 043: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 044: A+C->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  add(instance, &instance->A, &instance->CX, &instance->CX, FIELD_X);
+  /* 045: then go to eb */
+  instance->PC = instance->CY ? 0x046 : 0x0eb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_046(hp45inst_t *instance)
+{
+  /* 046: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 047: then go to 75 */
+  instance->PC = instance->CY ? 0x048 : 0x075;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_048(hp45inst_t *instance)
+{
+  /* 048: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 049: then go to 38 */
+  instance->PC = instance->CY ? 0x04a : 0x038;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_04a(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 04a: 0->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->CX, &zero, FIELD_X);
+  /* 04b: 0 -> p */
+  instance->CY = 0;
+  instance->P = 0;
+  /* 04c: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 04d: A-C->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_X);
+  /* 04e: A-1 [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  ifge(instance, &instance->A, &temp.r, FIELD_XS);
+  /* 04f: then go to cc */
+  instance->PC = instance->CY ? 0x050 : 0x0cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_050(hp45inst_t *instance)
+{
+  /* 050: then go to ff */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x051 : 0x0ff;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_051(hp45inst_t *instance)
+{
+  /* 051: jsb 4a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x52;
+  instance->PC = 0x04a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_052(hp45inst_t *instance)
+{
+  /* 052: jsb e3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x53;
+  instance->PC = 0x0e3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_053(hp45inst_t *instance)
+{
+  /* 053: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  /* 054: A<->B [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->B, FIELD_WP(instance->P));
+  /* 055: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 056: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 057: jsb e5 */
+  instance->LR = 0x58;
+  instance->PC = 0x0e5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_058(hp45inst_t *instance)
+{
+  /* 058: 1 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  /* 059: jsb c9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x5a;
+  instance->PC = 0x0c9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_05a(hp45inst_t *instance)
+{
+  /* 05a: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 05b: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 05c: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 05d: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 05e: jsb 9e */
+  instance->LR = 0x5f;
+  instance->PC = 0x09e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_05f(hp45inst_t *instance)
+{
+  /* 05f: jsb 86 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x60;
+  instance->PC = 0x086;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_060(hp45inst_t *instance)
+{
+  /* 060: then go to 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x061 : 0x07d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_061(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 061: C+1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 062: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 063: then go to 83 */
+  instance->PC = instance->CY ? 0x064 : 0x083;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_064(hp45inst_t *instance)
+{
+  /* 064: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 065: 2 -> p */
+  instance->CY = 0;
+  instance->P = 2;
+  /* 066: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 067: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 068: then go to 01 */
+  instance->PC = instance->CY ? 0x069 : 0x001;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_069(hp45inst_t *instance)
+{
+  /* 069: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x16a;
+  return 0;
+}
+
+static int block_06a(hp45inst_t *instance)
+{
+  /* 06a: 1 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  /* 06b: if s4 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 4) & 1;
+  /* 06c: then go to 73 */
+  instance->PC = instance->CY ? 0x06d : 0x073;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_06d(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 06d: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 06e: A+C->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  add(instance, &instance->A, &instance->CX, &instance->CX, FIELD_S);
+  /* 06f: A-1 [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  ifge(instance, &instance->A, &temp.r, FIELD_M);
+  /* 070: then go to 72 */
+  instance->PC = instance->CY ? 0x071 : 0x072;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_071(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 071: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  instance->PC = 0x072;
+  return 0;
+}
+
+static int block_072(hp45inst_t *instance)
+{
+  /* 072: jsb a6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x73;
+  instance->PC = 0x0a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_073(hp45inst_t *instance)
+{
+  /* 073: 1 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<1;
+  /* 074: then go to 15 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x075 : 0x015;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_075(hp45inst_t *instance)
+{
+  /* 075: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x176;
+  return 0;
+}
+
+static int block_076(hp45inst_t *instance)
+{
+  /* 076: if s8 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 8) & 1;
+  /* 077: then go to 6a */
+  instance->PC = instance->CY ? 0x078 : 0x06a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_078(hp45inst_t *instance)
+{
+  /* 078: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x79;
+  instance->PC = 0x087;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_079(hp45inst_t *instance)
+{
+  /* 079: 1 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<1;
+  /* 07a: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 07b: then go to 3a */
+  instance->PC = instance->CY ? 0x07c : 0x03a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_07c(hp45inst_t *instance)
+{
+  /* 07c: then go to f3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x07d : 0x0f3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_07d(hp45inst_t *instance)
+{
+  /* 07d: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x07e;
+  return 0;
+}
+
+static int block_07e(hp45inst_t *instance)
+{
+  /* 07e: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_07f(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 07f: C-1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 080: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 081: 1 -> s7 */
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  instance->PC = 0x082;
+  return 0;
+}
+
+static int block_082(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 082: C-1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x083;
+  return 0;
+}
+
+static int block_083(hp45inst_t *instance)
+{
+  /* 083: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 084: then go to 9e */
+  instance->PC = instance->CY ? 0x085 : 0x09e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_085(hp45inst_t *instance)
+{
+  /* 085: then go to a2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x086 : 0x0a2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_086(hp45inst_t *instance)
+{
+  /* 086: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  instance->PC = 0x087;
+  return 0;
+}
+
+static int block_087(hp45inst_t *instance)
+{
+  /* 087: 1 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  /* 088: 0 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<4);
+  /* 089: 1 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<6;
+  /* 08a: m -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  /* 08b: 0-C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->CX, FIELD_S);
+  /* 08c: then go to 8e */
+  instance->PC = instance->CY ? 0x08d : 0x08e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_08d(hp45inst_t *instance)
+{
+  /* 08d: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  instance->PC = 0x08e;
+  return 0;
+}
+
+static int block_08e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 08e: C+1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 08f: then go to 91 */
+  instance->PC = instance->CY ? 0x090 : 0x091;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_090(hp45inst_t *instance)
+{
+  /* 090: 0 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<6);
+  instance->PC = 0x091;
+  return 0;
+}
+
+static int block_091(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 091: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 092: C+1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 093: if s1 = 1 */
+  instance->CY = (instance->S >> 1) & 1;
+  /* 094: then go to c0 */
+  instance->PC = instance->CY ? 0x095 : 0x0c0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_095(hp45inst_t *instance)
+{
+  /* 095: if s4 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 4) & 1;
+  /* 096: then go to e1 */
+  instance->PC = instance->CY ? 0x097 : 0x0e1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_097(hp45inst_t *instance)
+{
+  /* 097: 0 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<7);
+  /* 098: if s6 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 6) & 1;
+  /* 099: then go to 82 */
+  instance->PC = instance->CY ? 0x09a : 0x082;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_09a(hp45inst_t *instance)
+{
+  /* 09a: then go to 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x09b : 0x061;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_09b(hp45inst_t *instance)
+{
+  /* 09b: then go to aa */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x09c : 0x0aa;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_09c(hp45inst_t *instance)
+{
+  /* 09c: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 09d: then go to a2 */
+  instance->PC = instance->CY ? 0x09e : 0x0a2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_09e(hp45inst_t *instance)
+{
+  /* 09e: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 09f: 0 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<1);
+  /* 0a0: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  /* 0a1: then go to a5 */
+  instance->PC = instance->CY ? 0x0a2 : 0x0a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0a2(hp45inst_t *instance)
+{
+  /* 0a2: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 0a3: 0 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<1);
+  /* 0a4: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a5;
+  return 0;
+}
+
+static int block_0a5(hp45inst_t *instance)
+{
+  /* 0a5: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a6;
+  return 0;
+}
+
+static int block_0a6(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0a6: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 0a7: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  instance->PC = 0x0a8;
+  return 0;
+}
+
+static int block_0a8(hp45inst_t *instance)
+{
+  /* 0a8: 0 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<1);
+  /* 0a9: 0 -> s2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<2);
+  instance->PC = 0x0aa;
+  return 0;
+}
+
+static int block_0aa(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0aa: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  /* 0ab: A+1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 0ac: A+1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 0ad: C+1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 0ae: C+1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 0af: A-C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  ifge(instance, &instance->A, &instance->CX, FIELD_X);
+  /* 0b0: then go to b2 */
+  instance->PC = instance->CY ? 0x0b1 : 0x0b2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0b1(hp45inst_t *instance)
+{
+  /* 0b1: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x0b2;
+  return 0;
+}
+
+static int block_0b2(hp45inst_t *instance)
+{
+  /* 0b2: C<->A [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->CX, FIELD_M);
+  /* 0b3: 0-C [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  ifeq0(instance, &instance->CX, FIELD_M);
+  /* 0b4: then go to b6 */
+  instance->PC = instance->CY ? 0x0b5 : 0x0b6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0b5(hp45inst_t *instance)
+{
+  /* 0b5: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x0b6;
+  return 0;
+}
+
+static int block_0b6(hp45inst_t *instance)
+{
+  /* 0b6: B<->C [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->B, &instance->CX, FIELD_M);
+  instance->PC = 0x0b7;
+  return 0;
+}
+
+static int block_0b7(hp45inst_t *instance)
+{
+  /* 0b7: A-C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  ifge(instance, &instance->A, &instance->CX, FIELD_X);
+  /* 0b8: then go to be */
+  instance->PC = instance->CY ? 0x0b9 : 0x0be;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0b9(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0b9: shift B right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->B, 0, FIELD_W);
+  /* 0ba: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 0bb: 0-B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  ifeq0(instance, &instance->B, FIELD_W);
+  /* 0bc: then go to be */
+  instance->PC = instance->CY ? 0x0bd : 0x0be;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0bd(hp45inst_t *instance)
+{
+  /* 0bd: then go to b7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x0be : 0x0b7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0be(hp45inst_t *instance)
+{
+  /* 0be: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1bf;
+  return 0;
+}
+
+static int block_0bf(hp45inst_t *instance)
+{
+  /* 0bf: then go to ff */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x0c0 : 0x0ff;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0c0(hp45inst_t *instance)
+{
+  /* 0c0: if s6 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 6) & 1;
+  /* 0c1: then go to e1 */
+  instance->PC = instance->CY ? 0x0c2 : 0x0e1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0c2(hp45inst_t *instance)
+{
+  /* 0c2: 0 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<7);
+  /* 0c3: if s4 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 4) & 1;
+  /* 0c4: then go to 82 */
+  instance->PC = instance->CY ? 0x0c5 : 0x082;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0c5(hp45inst_t *instance)
+{
+  /* 0c5: then go to 7f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x0c6 : 0x07f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0c6(hp45inst_t *instance)
+{
+  /* 0c6: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  /* 0c7: c -> stack */
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 0c8: return */
+  instance->CY = 0;
+  instance->PC = 0x000 | instance->LR;
+  return 0;
+}
+
+static int block_0c9(hp45inst_t *instance)
+{
+  /* 0c9: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 0ca: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1cb;
+  return 0;
+}
+
+static int block_0cb(hp45inst_t *instance)
+{
+  /* 0cb: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1cc;
+  return 0;
+}
+
+static int block_0cc(hp45inst_t *instance)
+{
+  /* 0cc: B<->C [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->B, &instance->CX, FIELD_M);
+  instance->PC = 0x0cd;
+  return 0;
+}
+
+static int block_0cd(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0cd: shift B right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->B, 0, FIELD_W);
+  /* 0ce: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 0cf: then go to cd */
+  instance->PC = instance->CY ? 0x0d0 : 0x0cd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0d0(hp45inst_t *instance)
+{
+  /* 0d0: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 0d1: 6 -> p */
+  instance->CY = 0;
+  instance->P = 6;
+  /* 0d2: return */
+  instance->CY = 0;
+  instance->PC = 0x000 | instance->LR;
+  return 0;
+}
+
+static int block_0d3(hp45inst_t *instance)
+{
+  /* 0d3: if s11 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 11) & 1;
+  /* 0d4: then go to d8 */
+  instance->PC = instance->CY ? 0x0d5 : 0x0d8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0d5(hp45inst_t *instance)
+{
+  /* 0d5: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 0d6: 1 -> s7 */
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  /* 0d7: then go to 9c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x0d8 : 0x09c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0d8(hp45inst_t *instance)
+{
+  /* 0d8: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1d9;
+  return 0;
+}
+
+static int block_0d9(hp45inst_t *instance)
+{
+  /* 0d9: 12 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 12;
+  /* 0da: then go to d3 */
+  instance->PC = instance->CY ? 0x0db : 0x0d3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0db(hp45inst_t *instance)
+{
+  /* 0db: if s11 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 11) & 1;
+  /* 0dc: then go to f9 */
+  instance->PC = instance->CY ? 0x0dd : 0x0f9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0dd(hp45inst_t *instance)
+{
+  /* 0dd: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 0de: if s7 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 7) & 1;
+  /* 0df: then go to cb */
+  instance->PC = instance->CY ? 0x0e0 : 0x0cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0e0(hp45inst_t *instance)
+{
+  /* 0e0: 0 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<11);
+  instance->PC = 0x0e1;
+  return 0;
+}
+
+static int block_0e1(hp45inst_t *instance)
+{
+  /* 0e1: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x000 | instance->LR;
+  return 0;
+}
+
+static int block_0e2(hp45inst_t *instance)
+{
+  /* 0e2: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  instance->PC = 0x0e3;
+  return 0;
+}
+
+static int block_0e3(hp45inst_t *instance)
+{
+  /* 0e3: A<->B [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->B, FIELD_WP(instance->P));
+  /* 0e4: shift B right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->B, 0, FIELD_W);
+  instance->PC = 0x0e5;
+  return 0;
+}
+
+static int block_0e5(hp45inst_t *instance)
+{
+  /* 0e5: 10 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 10;
+  instance->PC = 0x0e6;
+  return 0;
+}
+
+static int block_0e6(hp45inst_t *instance)
+{
+  /* 0e6: A+B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 0e7: p - 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 0e8: if p # 4 */
+  instance->CY = (instance->P == 4);
+  /* 0e9: then go to e6 */
+  instance->PC = instance->CY ? 0x0ea : 0x0e6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0ea(hp45inst_t *instance)
+{
+  /* 0ea: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x000 | instance->LR;
+  return 0;
+}
+
+static int block_0eb(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0eb: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 0ec: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 0ed: if s10 = 1 */
+  instance->CY = (instance->S >> 10) & 1;
+  /* 0ee: then go to 37 */
+  instance->PC = instance->CY ? 0x0ef : 0x037;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0ef(hp45inst_t *instance)
+{
+  /* 0ef: then go to 69 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x0f0 : 0x069;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0f0(hp45inst_t *instance)
+{
+  /* 0f0: if s1 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 1) & 1;
+  /* 0f1: then go to 7e */
+  instance->PC = instance->CY ? 0x0f2 : 0x07e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0f2(hp45inst_t *instance)
+{
+  /* 0f2: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x0f3;
+  return 0;
+}
+
+static int block_0f3(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 0f3: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 0f4: C-1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 0f5: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 0f6: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 0f7: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 0f8: then go to 7d */
+  instance->PC = instance->CY ? 0x0f9 : 0x07d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0f9(hp45inst_t *instance)
+{
+  /* 0f9: if s3 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 3) & 1;
+  /* 0fa: then go to f0 */
+  instance->PC = instance->CY ? 0x0fb : 0x0f0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0fb(hp45inst_t *instance)
+{
+  /* 0fb: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 0fc: then go to fe */
+  instance->PC = instance->CY ? 0x0fd : 0x0fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_0fd(hp45inst_t *instance)
+{
+  /* 0fd: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x4fe;
+  return 0;
+}
+
+static int block_0fe(hp45inst_t *instance)
+{
+  /* 0fe: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x5ff;
+  return 0;
+}
+
+static int block_0ff(hp45inst_t *instance)
+{
+  /* 0ff: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x200;
+  return 0;
+}
+
+static int block_102(hp45inst_t *instance)
+{
+  /* 102: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 103: jsb 30 */
+  instance->LR = 0x04;
+  instance->PC = 0x130;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_104(hp45inst_t *instance)
+{
+  /* 104: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 105: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 106: jsb 30 */
+  instance->LR = 0x07;
+  instance->PC = 0x130;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_107(hp45inst_t *instance)
+{
+  /* 107: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 108: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x109;
+  return 0;
+}
+
+static int block_109(hp45inst_t *instance)
+{
+  /* 109: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 10a: then go to 0c */
+  instance->PC = instance->CY ? 0x10b : 0x10c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_10b(hp45inst_t *instance)
+{
+  /* 10b: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x10c;
+  return 0;
+}
+
+static int block_10c(hp45inst_t *instance)
+{
+  /* 10c: if s5 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 5) & 1;
+  /* 10d: then go to 1a */
+  instance->PC = instance->CY ? 0x10e : 0x11a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_10e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 10e: C-1 [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->CX, &temp.r, FIELD_S);
+  /* 10f: then go to 11 */
+  instance->PC = instance->CY ? 0x110 : 0x111;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_110(hp45inst_t *instance)
+{
+  /* 110: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  instance->PC = 0x111;
+  return 0;
+}
+
+static int block_111(hp45inst_t *instance)
+{
+  /* 111: 0->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->CX, &zero, FIELD_S);
+  /* 112: jsb a6 */
+  instance->LR = 0x13;
+  instance->PC = 0x1a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_113(hp45inst_t *instance)
+{
+  /* 113: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 114: jsb a5 */
+  instance->LR = 0x15;
+  instance->PC = 0x1a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_115(hp45inst_t *instance)
+{
+  /* 115: jsb 98 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x16;
+  instance->PC = 0x198;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_116(hp45inst_t *instance)
+{
+  /* 116: jsb 2d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x17;
+  instance->PC = 0x12d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_117(hp45inst_t *instance)
+{
+  /* 117: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 118: rom 0 */
+  instance->CY = 0;
+  instance->PC = 0x019;
+  return 0;
+}
+
+static int block_119(hp45inst_t *instance)
+{
+  /* 119: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x11a;
+  return 0;
+}
+
+static int block_11a(hp45inst_t *instance)
+{
+  /* 11a: jsb a6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x1b;
+  instance->PC = 0x1a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_11b(hp45inst_t *instance)
+{
+  /* 11b: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 11c: then go to da */
+  instance->PC = instance->CY ? 0x11d : 0x1da;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_11d(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 11d: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 11e: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 11f: A->B [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  mov(&instance->B, &instance->A, FIELD_M);
+  /* 120: C<->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->CX, FIELD_M);
+  instance->PC = 0x121;
+  return 0;
+}
+
+static int block_121(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 121: C-1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 122: shift B right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  /* 123: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 124: then go to 21 */
+  instance->PC = instance->CY ? 0x125 : 0x121;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_125(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 125: shift A right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 126: C+1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 127: then go to 25 */
+  instance->PC = instance->CY ? 0x128 : 0x125;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_128(hp45inst_t *instance)
+{
+  /* 128: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 129: shift B right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->B, 0, FIELD_W);
+  /* 12a: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  instance->PC = 0x12b;
+  return 0;
+}
+
+static int block_12b(hp45inst_t *instance)
+{
+  /* 12b: B<->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 12c: then go to 46 */
+  instance->PC = instance->CY ? 0x12d : 0x146;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_12d(hp45inst_t *instance)
+{
+  /* 12d: B<->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 12e: 4 -> p */
+  instance->CY = 0;
+  instance->P = 4;
+  /* 12f: then go to de */
+  instance->PC = instance->CY ? 0x130 : 0x1de;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_130(hp45inst_t *instance)
+{
+  /* 130: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 131: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 132: 0-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifeq0(instance, &instance->CX, FIELD_P(instance->P));
+  /* 133: then go to 35 */
+  instance->PC = instance->CY ? 0x134 : 0x135;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_134(hp45inst_t *instance)
+{
+  /* 134: 0-C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_W);
+  instance->PC = 0x135;
+  return 0;
+}
+
+static int block_135(hp45inst_t *instance)
+{
+  /* 135: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 136: B->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->CX, &instance->B, FIELD_X);
+  /* 137: then go to cb */
+  instance->PC = instance->CY ? 0x138 : 0x1cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_138(hp45inst_t *instance)
+{
+  /* 138: then go to 09 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x139 : 0x109;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_139(hp45inst_t *instance)
+{
+  /* 139: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x03a;
+  return 0;
+}
+
+static int block_13a(hp45inst_t *instance)
+{
+  /* 13a: if s5 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 5) & 1;
+  /* 13b: then go to 1d */
+  instance->PC = instance->CY ? 0x13c : 0x11d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_13c(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 13c: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  /* 13d: C<->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  exch(&instance->A, &instance->CX, FIELD_S);
+  /* 13e: then go to 13 */
+  instance->PC = instance->CY ? 0x13f : 0x113;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_13f(hp45inst_t *instance)
+{
+  /* 13f: shift B right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  instance->PC = 0x140;
+  return 0;
+}
+
+static int block_140(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 140: A-1->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 141: then go to 3f */
+  instance->PC = instance->CY ? 0x142 : 0x13f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_142(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 142: C+1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 143: A<->B [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->B, FIELD_WP(instance->P));
+  /* 144: A+C->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  add(instance, &instance->A, &instance->CX, &instance->CX, FIELD_WP(instance->P));
+  /* 145: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  instance->PC = 0x146;
+  return 0;
+}
+
+static int block_146(hp45inst_t *instance)
+{
+  /* 146: A->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &instance->A, FIELD_W);
+  /* 147: A-C->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_WP(instance->P));
+  /* 148: then go to 40 */
+  instance->PC = instance->CY ? 0x149 : 0x140;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_149(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 149: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 14a: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 14b: shift C right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  /* 14c: C<->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  exch(&instance->A, &instance->CX, FIELD_S);
+  /* 14d: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 14e: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 14f: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 150: A+1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 151: A+1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 152: then go to 2b */
+  instance->PC = instance->CY ? 0x153 : 0x12b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_153(hp45inst_t *instance)
+{
+  /* 153: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 154: 0->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &zero, FIELD_X);
+  /* 155: shift A right [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 156: jsb b2 */
+  instance->LR = 0x57;
+  instance->PC = 0x1b2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_157(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 157: A-1->A [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 158: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 159: 4 -> p */
+  instance->CY = 0;
+  instance->P = 4;
+  /* 15a: jsb a4 */
+  instance->LR = 0x5b;
+  instance->PC = 0x1a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_15b(hp45inst_t *instance)
+{
+  /* 15b: 6 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 6;
+  /* 15c: jsb 9b */
+  instance->LR = 0x5d;
+  instance->PC = 0x19b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_15d(hp45inst_t *instance)
+{
+  /* 15d: 8 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 8;
+  /* 15e: jsb 9b */
+  instance->LR = 0x5f;
+  instance->PC = 0x19b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_15f(hp45inst_t *instance)
+{
+  /* 15f: 2 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 2;
+  /* 160: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 161: 10 -> p */
+  instance->CY = 0;
+  instance->P = 10;
+  /* 162: jsb 9b */
+  instance->LR = 0x63;
+  instance->PC = 0x19b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_163(hp45inst_t *instance)
+{
+  /* 163: jsb 8e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x64;
+  instance->PC = 0x18e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_164(hp45inst_t *instance)
+{
+  /* 164: jsb 9b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x65;
+  instance->PC = 0x19b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_165(hp45inst_t *instance)
+{
+  /* 165: jsb cc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x66;
+  instance->PC = 0x1cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_166(hp45inst_t *instance)
+{
+  /* 166: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 167: jsb 9b */
+  instance->LR = 0x68;
+  instance->PC = 0x19b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_168(hp45inst_t *instance)
+{
+  /* 168: B->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &instance->B, FIELD_W);
+  /* 169: jsb cb */
+  instance->LR = 0x6a;
+  instance->PC = 0x1cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_16a(hp45inst_t *instance)
+{
+  /* 16a: jsb cc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x6b;
+  instance->PC = 0x1cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_16b(hp45inst_t *instance)
+{
+  /* 16b: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 16c: if s10 = 1 */
+  instance->CY = (instance->S >> 10) & 1;
+  /* 16d: then go to 75 */
+  instance->PC = instance->CY ? 0x16e : 0x175;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_16e(hp45inst_t *instance)
+{
+  /* 16e: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 16f: then go to 75 */
+  instance->PC = instance->CY ? 0x170 : 0x175;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_170(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 170: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 171: 0-C-1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  /* 172: jsb 9a */
+  instance->LR = 0x73;
+  instance->PC = 0x19a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_173(hp45inst_t *instance)
+{
+  /* 173: jsb cc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x74;
+  instance->PC = 0x1cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_174(hp45inst_t *instance)
+{
+  /* 174: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  instance->PC = 0x175;
+  return 0;
+}
+
+static int block_175(hp45inst_t *instance)
+{
+  /* 175: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x076;
+  return 0;
+}
+
+static int block_176(hp45inst_t *instance)
+{
+  /* 176: jsb cc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x77;
+  instance->PC = 0x1cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_177(hp45inst_t *instance)
+{
+  /* 177: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 178: C+C->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 179: jsb 95 */
+  instance->LR = 0x7a;
+  instance->PC = 0x195;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_17a(hp45inst_t *instance)
+{
+  /* 17a: C+C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_W);
+  /* 17b: jsb eb */
+  instance->LR = 0x7c;
+  instance->PC = 0x1eb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_17c(hp45inst_t *instance)
+{
+  /* 17c: jsb cc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x7d;
+  instance->PC = 0x1cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_17d(hp45inst_t *instance)
+{
+  /* 17d: 10 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 10;
+  /* 17e: jsb 9c */
+  instance->LR = 0x7f;
+  instance->PC = 0x19c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_17f(hp45inst_t *instance)
+{
+  /* 17f: jsb 8e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x80;
+  instance->PC = 0x18e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_180(hp45inst_t *instance)
+{
+  /* 180: 8 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 8;
+  /* 181: jsb 9d */
+  instance->LR = 0x82;
+  instance->PC = 0x19d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_182(hp45inst_t *instance)
+{
+  /* 182: 2 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 2;
+  /* 183: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 184: 6 -> p */
+  instance->CY = 0;
+  instance->P = 6;
+  /* 185: jsb 9c */
+  instance->LR = 0x86;
+  instance->PC = 0x19c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_186(hp45inst_t *instance)
+{
+  /* 186: 4 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 4;
+  /* 187: jsb 9c */
+  instance->LR = 0x88;
+  instance->PC = 0x19c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_188(hp45inst_t *instance)
+{
+  /* 188: jsb 9c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x89;
+  instance->PC = 0x19c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_189(hp45inst_t *instance)
+{
+  /* 189: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 18a: shift C right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  /* 18b: 13 -> p */
+  instance->CY = 0;
+  instance->P = 13;
+  /* 18c: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 18d: then go to fc */
+  instance->PC = instance->CY ? 0x18e : 0x1fc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_18e(hp45inst_t *instance)
+{
+  /* 18e: 6 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 6;
+  /* 18f: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 190: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 191: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 192: 2 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 193: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 194: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x195;
+  return 0;
+}
+
+static int block_195(hp45inst_t *instance)
+{
+  /* 195: if s1 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 1) & 1;
+  /* 196: then go to da */
+  instance->PC = instance->CY ? 0x197 : 0x1da;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_197(hp45inst_t *instance)
+{
+  /* 197: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x100 | instance->LR;
+  return 0;
+}
+
+static int block_198(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 198: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 199: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  instance->PC = 0x19a;
+  return 0;
+}
+
+static int block_19a(hp45inst_t *instance)
+{
+  /* 19a: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x09b;
+  return 0;
+}
+
+static int block_19b(hp45inst_t *instance)
+{
+  /* 19b: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x29c;
+  return 0;
+}
+
+static int block_19c(hp45inst_t *instance)
+{
+  /* 19c: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  instance->PC = 0x19d;
+  return 0;
+}
+
+static int block_19d(hp45inst_t *instance)
+{
+  /* 19d: shift B right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->B, 0, FIELD_MS);
+  /* 19e: B<->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 19f: then go to a1 */
+  instance->PC = instance->CY ? 0x1a0 : 0x1a1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1a0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1a0: C+1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->PC = 0x1a1;
+  return 0;
+}
+
+static int block_1a1(hp45inst_t *instance)
+{
+  /* 1a1: A-B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 1a2: then go to a0 */
+  instance->PC = instance->CY ? 0x1a3 : 0x1a0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1a3(hp45inst_t *instance)
+{
+  /* 1a3: A+B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  instance->PC = 0x1a4;
+  return 0;
+}
+
+static int block_1a4(hp45inst_t *instance)
+{
+  /* 1a4: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2a5;
+  return 0;
+}
+
+static int block_1a5(hp45inst_t *instance)
+{
+  /* 1a5: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2a6;
+  return 0;
+}
+
+static int block_1a6(hp45inst_t *instance)
+{
+  /* 1a6: A-C->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &instance->A, &instance->CX, &instance->CX, FIELD_X);
+  /* 1a7: rom 2 */
+  instance->CY = 0;
+  instance->PC = 0x2a8;
+  return 0;
+}
+
+static int block_1a8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1a8: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x1a9;
+  return 0;
+}
+
+static int block_1a9(hp45inst_t *instance)
+{
+  /* 1a9: A-C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_W);
+  /* 1aa: then go to a8 */
+  instance->PC = instance->CY ? 0x1ab : 0x1a8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1ab(hp45inst_t *instance)
+{
+  /* 1ab: A+C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->CX, &instance->A, FIELD_W);
+  /* 1ac: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 1ad: p - 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x1ae;
+  return 0;
+}
+
+static int block_1ae(hp45inst_t *instance)
+{
+  /* 1ae: shift C right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->CX, 0, FIELD_WP(instance->P));
+  /* 1af: if p # 0 */
+  instance->CY = (instance->P == 0);
+  /* 1b0: then go to a9 */
+  instance->PC = instance->CY ? 0x1b1 : 0x1a9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1b1(hp45inst_t *instance)
+{
+  /* 1b1: then go to 35 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x1b2 : 0x135;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1b2(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1b2: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x1b3;
+  return 0;
+}
+
+static int block_1b3(hp45inst_t *instance)
+{
+  /* 1b3: A-B->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 1b4: then go to b2 */
+  instance->PC = instance->CY ? 0x1b5 : 0x1b2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1b5(hp45inst_t *instance)
+{
+  /* 1b5: A+B->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 1b6: shift A left [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  /* 1b7: p - 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1b8: if p # 0 */
+  instance->CY = (instance->P == 0);
+  instance->PC = 0x1b9;
+  return 0;
+}
+
+static int block_1b9(hp45inst_t *instance)
+{
+  /* 1b9: then go to b3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x1ba : 0x1b3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1ba(hp45inst_t *instance)
+{
+  /* 1ba: then go to 35 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x1bb : 0x135;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1bb(hp45inst_t *instance)
+{
+  /* 1bb: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1bc: A+B->A [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 1bd: then go to db */
+  instance->PC = instance->CY ? 0x1be : 0x1db;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1be(hp45inst_t *instance)
+{
+  /* 1be: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x0bf;
+  return 0;
+}
+
+static int block_1bf(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1bf: C-1->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 1c0: C-1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 1c1: 0->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &zero, FIELD_X);
+  /* 1c2: A-C->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_S);
+  /* 1c3: A-1 [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->A, &temp.r, FIELD_S);
+  /* 1c4: then go to c6 */
+  instance->PC = instance->CY ? 0x1c5 : 0x1c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1c5(hp45inst_t *instance)
+{
+  /* 1c5: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2c6;
+  return 0;
+}
+
+static int block_1c6(hp45inst_t *instance)
+{
+  /* 1c6: A-B [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  ifge(instance, &instance->A, &instance->B, FIELD_M);
+  /* 1c7: then go to ca */
+  instance->PC = instance->CY ? 0x1c8 : 0x1ca;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1c8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1c8: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  /* 1c9: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  instance->PC = 0x1ca;
+  return 0;
+}
+
+static int block_1ca(hp45inst_t *instance)
+{
+  /* 1ca: A-B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  instance->PC = 0x1cb;
+  return 0;
+}
+
+static int block_1cb(hp45inst_t *instance)
+{
+  /* 1cb: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2cc;
+  return 0;
+}
+
+static int block_1cc(hp45inst_t *instance)
+{
+  /* 1cc: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 1cd: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 1ce: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1cf: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d0: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d1: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d2: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d3: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d4: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d5: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d6: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d7: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 1d8: rom 0 */
+  instance->CY = 0;
+  instance->PC = 0x0d9;
+  return 0;
+}
+
+static int block_1d9(hp45inst_t *instance)
+{
+  /* 1d9: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x100 | instance->LR;
+  return 0;
+}
+
+static int block_1da(hp45inst_t *instance)
+{
+  /* 1da: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x0db;
+  return 0;
+}
+
+static int block_1db(hp45inst_t *instance)
+{
+  /* 1db: A+B->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_X);
+  /* 1dc: then go to de */
+  instance->PC = instance->CY ? 0x1dd : 0x1de;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1dd(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1dd: C-1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x1de;
+  return 0;
+}
+
+static int block_1de(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1de: C+1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 1df: if p # 0 */
+  instance->CY = (instance->P == 0);
+  /* 1e0: then go to bb */
+  instance->PC = instance->CY ? 0x1e1 : 0x1bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1e1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1e1: C<->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  /* 1e2: 0->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &zero, FIELD_X);
+  /* 1e3: C-1 [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->CX, &temp.r, FIELD_P(instance->P));
+  /* 1e4: then go to e6 */
+  instance->PC = instance->CY ? 0x1e5 : 0x1e6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1e5(hp45inst_t *instance)
+{
+  /* 1e5: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  instance->PC = 0x1e6;
+  return 0;
+}
+
+static int block_1e6(hp45inst_t *instance)
+{
+  /* 1e6: shift C right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  /* 1e7: B<->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->B, &instance->CX, FIELD_X);
+  /* 1e8: 0->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->CX, &zero, FIELD_X);
+  /* 1e9: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 1ea: then go to ae */
+  instance->PC = instance->CY ? 0x1eb : 0x1ae;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1eb(hp45inst_t *instance)
+{
+  /* 1eb: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2ec;
+  return 0;
+}
+
+static int block_1ec(hp45inst_t *instance)
+{
+  /* 1ec: shift B right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  /* 1ed: shift B right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  instance->PC = 0x1ee;
+  return 0;
+}
+
+static int block_1ee(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1ee: C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 1ef: then go to ec */
+  instance->PC = instance->CY ? 0x1f0 : 0x1ec;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1f0(hp45inst_t *instance)
+{
+  /* 1f0: A+C->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  add(instance, &instance->A, &instance->CX, &instance->CX, FIELD_WP(instance->P));
+  /* 1f1: A-B->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_WP(instance->P));
+  /* 1f2: B<->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->B, &instance->CX, FIELD_WP(instance->P));
+  instance->PC = 0x1f3;
+  return 0;
+}
+
+static int block_1f3(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1f3: B->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &instance->B, FIELD_W);
+  /* 1f4: A-1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 1f5: then go to ee */
+  instance->PC = instance->CY ? 0x1f6 : 0x1ee;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1f6(hp45inst_t *instance)
+{
+  /* 1f6: C<->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  exch(&instance->A, &instance->CX, FIELD_S);
+  /* 1f7: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 1f8: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 1f9: 0-B [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->B, FIELD_S);
+  /* 1fa: then go to 02 */
+  instance->PC = instance->CY ? 0x1fb : 0x102;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_1fb(hp45inst_t *instance)
+{
+  /* 1fb: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  instance->PC = 0x1fc;
+  return 0;
+}
+
+static int block_1fc(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 1fc: C<->A [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->CX, FIELD_WP(instance->P));
+  /* 1fd: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 1fe: shift B right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  /* 1ff: C-1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 100: B<->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  exch(&instance->B, &instance->CX, FIELD_S);
+  /* 101: then go to f3 */
+  instance->PC = instance->CY ? 0x102 : 0x1f3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_200(hp45inst_t *instance)
+{
+  /* 200: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x601;
+  return 0;
+}
+
+static int block_201(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 201: A<->B [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  exch(&instance->A, &instance->B, FIELD_S);
+  /* 202: A+1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 203: shift C right [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->CX, 0, FIELD_MS);
+  /* 204: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 205: then go to 12 */
+  instance->PC = instance->CY ? 0x206 : 0x212;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_206(hp45inst_t *instance)
+{
+  /* 206: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  /* 207: jsb a6 */
+  instance->LR = 0x08;
+  instance->PC = 0x2a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_208(hp45inst_t *instance)
+{
+  /* 208: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 209: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  /* 20a: then go to 42 */
+  instance->PC = instance->CY ? 0x20b : 0x242;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_20b(hp45inst_t *instance)
+{
+  /* 20b: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 20c: A-C->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_M);
+  /* 20d: then go to 00 */
+  instance->PC = instance->CY ? 0x20e : 0x200;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_20e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 20e: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 20f: C-1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 210: then go to 00 */
+  instance->PC = instance->CY ? 0x211 : 0x200;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_211(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 211: C+1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->PC = 0x212;
+  return 0;
+}
+
+static int block_212(hp45inst_t *instance)
+{
+  /* 212: A->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &instance->A, FIELD_W);
+  /* 213: jsb 96 */
+  instance->LR = 0x14;
+  instance->PC = 0x296;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_214(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 214: A-1->A [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 215: then go to 11 */
+  instance->PC = instance->CY ? 0x216 : 0x211;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_216(hp45inst_t *instance)
+{
+  /* 216: A<->B [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->B, FIELD_WP(instance->P));
+  /* 217: A+B->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_S);
+  /* 218: then go to 01 */
+  instance->PC = instance->CY ? 0x219 : 0x201;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_219(hp45inst_t *instance)
+{
+  /* 219: 7 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 7;
+  /* 21a: jsb 6d */
+  instance->LR = 0x1b;
+  instance->PC = 0x26d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_21b(hp45inst_t *instance)
+{
+  /* 21b: 8 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 8;
+  /* 21c: jsb 9d */
+  instance->LR = 0x1d;
+  instance->PC = 0x29d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_21d(hp45inst_t *instance)
+{
+  /* 21d: 9 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 9;
+  /* 21e: jsb 9c */
+  instance->LR = 0x1f;
+  instance->PC = 0x29c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_21f(hp45inst_t *instance)
+{
+  /* 21f: jsb fe */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x20;
+  instance->PC = 0x2fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_220(hp45inst_t *instance)
+{
+  /* 220: 10 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 10;
+  /* 221: jsb 9c */
+  instance->LR = 0x22;
+  instance->PC = 0x29c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_222(hp45inst_t *instance)
+{
+  /* 222: jsb 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x23;
+  instance->PC = 0x27d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_223(hp45inst_t *instance)
+{
+  /* 223: 11 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 11;
+  /* 224: jsb 9c */
+  instance->LR = 0x25;
+  instance->PC = 0x29c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_225(hp45inst_t *instance)
+{
+  /* 225: jsb df */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x26;
+  instance->PC = 0x2df;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_226(hp45inst_t *instance)
+{
+  /* 226: jsb 9c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x27;
+  instance->PC = 0x29c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_227(hp45inst_t *instance)
+{
+  /* 227: jsb b9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x28;
+  instance->PC = 0x2b9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_228(hp45inst_t *instance)
+{
+  /* 228: jsb 9c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x29;
+  instance->PC = 0x29c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_229(hp45inst_t *instance)
+{
+  /* 229: jsb f6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x2a;
+  instance->PC = 0x2f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_22a(hp45inst_t *instance)
+{
+  /* 22a: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 22b: A-C->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->CX, &instance->CX, FIELD_W);
+  /* 22c: 0-B [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->B, FIELD_XS);
+  /* 22d: then go to 2f */
+  instance->PC = instance->CY ? 0x22e : 0x22f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_22e(hp45inst_t *instance)
+{
+  /* 22e: A-C->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->CX, &instance->CX, FIELD_W);
+  instance->PC = 0x22f;
+  return 0;
+}
+
+static int block_22f(hp45inst_t *instance)
+{
+  /* 22f: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  instance->PC = 0x230;
+  return 0;
+}
+
+static int block_230(hp45inst_t *instance)
+{
+  /* 230: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 231: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 232: if p # 1 */
+  instance->CY = (instance->P == 1);
+  /* 233: then go to 30 */
+  instance->PC = instance->CY ? 0x234 : 0x230;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_234(hp45inst_t *instance)
+{
+  /* 234: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 235: 0-C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->CX, FIELD_S);
+  /* 236: then go to 38 */
+  instance->PC = instance->CY ? 0x237 : 0x238;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_237(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 237: 0-C-1->C [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_M);
+  set1(&temp.r, FIELD_M);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_M);
+  instance->CY = 1;
+  instance->PC = 0x238;
+  return 0;
+}
+
+static int block_238(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 238: C+1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 239: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 23a: jsb c5 */
+  instance->LR = 0x3b;
+  instance->PC = 0x2c5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_23b(hp45inst_t *instance)
+{
+  /* 23b: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 23c: then go to 06 */
+  instance->PC = instance->CY ? 0x23d : 0x206;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_23d(hp45inst_t *instance)
+{
+  /* 23d: if s5 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 5) & 1;
+  /* 23e: then go to 94 */
+  instance->PC = instance->CY ? 0x23f : 0x294;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_23f(hp45inst_t *instance)
+{
+  /* 23f: jsb f6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x40;
+  instance->PC = 0x2f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_240(hp45inst_t *instance)
+{
+  /* 240: jsb a7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x41;
+  instance->PC = 0x2a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_241(hp45inst_t *instance)
+{
+  /* 241: then go to 94 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x242 : 0x294;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_242(hp45inst_t *instance)
+{
+  /* 242: jsb f6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x43;
+  instance->PC = 0x2f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_243(hp45inst_t *instance)
+{
+  /* 243: jsb ec */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x44;
+  instance->PC = 0x2ec;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_244(hp45inst_t *instance)
+{
+  /* 244: jsb b9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x45;
+  instance->PC = 0x2b9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_245(hp45inst_t *instance)
+{
+  /* 245: 11 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 11;
+  /* 246: jsb 9b */
+  instance->LR = 0x47;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_247(hp45inst_t *instance)
+{
+  /* 247: jsb df */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x48;
+  instance->PC = 0x2df;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_248(hp45inst_t *instance)
+{
+  /* 248: 10 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 10;
+  /* 249: jsb 9b */
+  instance->LR = 0x4a;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_24a(hp45inst_t *instance)
+{
+  /* 24a: jsb 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4b;
+  instance->PC = 0x27d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_24b(hp45inst_t *instance)
+{
+  /* 24b: 9 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 9;
+  /* 24c: jsb 9b */
+  instance->LR = 0x4d;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_24d(hp45inst_t *instance)
+{
+  /* 24d: jsb fe */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4e;
+  instance->PC = 0x2fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_24e(hp45inst_t *instance)
+{
+  /* 24e: 8 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 8;
+  /* 24f: jsb 9b */
+  instance->LR = 0x50;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_250(hp45inst_t *instance)
+{
+  /* 250: jsb 9b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x51;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_251(hp45inst_t *instance)
+{
+  /* 251: jsb 9b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x52;
+  instance->PC = 0x29b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_252(hp45inst_t *instance)
+{
+  /* 252: 6 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 6;
+  /* 253: 0->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->A, &zero, FIELD_WP(instance->P));
+  /* 254: 13 -> p */
+  instance->CY = 0;
+  instance->P = 13;
+  /* 255: B<->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 256: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 257: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 258: then go to 8e */
+  instance->PC = instance->CY ? 0x259 : 0x28e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_259(hp45inst_t *instance)
+{
+  /* 259: if s2 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 2) & 1;
+  /* 25a: then go to 5e */
+  instance->PC = instance->CY ? 0x25b : 0x25e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_25b(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 25b: A+1->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  instance->PC = 0x25c;
+  return 0;
+}
+
+static int block_25c(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 25c: A-1 [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  ifge(instance, &instance->A, &temp.r, FIELD_XS);
+  /* 25d: then go to c2 */
+  instance->PC = instance->CY ? 0x25e : 0x2c2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_25e(hp45inst_t *instance)
+{
+  /* 25e: A-B->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 25f: then go to 59 */
+  instance->PC = instance->CY ? 0x260 : 0x259;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_260(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 260: A+B->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 261: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 262: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 263: then go to 5c */
+  instance->PC = instance->CY ? 0x264 : 0x25c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_264(hp45inst_t *instance)
+{
+  /* 264: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 265: 0->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 266: C<->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  instance->PC = 0x267;
+  return 0;
+}
+
+static int block_267(hp45inst_t *instance)
+{
+  /* 267: 0-C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->CX, FIELD_S);
+  /* 268: then go to 6c */
+  instance->PC = instance->CY ? 0x269 : 0x26c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_269(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 269: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 26a: A-B->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 26b: 0-C-1->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_W);
+  set1(&temp.r, FIELD_W);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_W);
+  instance->CY = 1;
+  instance->PC = 0x26c;
+  return 0;
+}
+
+static int block_26c(hp45inst_t *instance)
+{
+  /* 26c: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  instance->PC = 0x26d;
+  return 0;
+}
+
+static int block_26d(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 26d: B<->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 26e: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 26f: C-1->C [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_M);
+  /* 270: if s2 = 1 */
+  instance->CY = (instance->S >> 2) & 1;
+  /* 271: then go to 76 */
+  instance->PC = instance->CY ? 0x272 : 0x276;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_272(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 272: 4 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 273: C+1->C [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_M);
+  /* 274: then go to 79 */
+  instance->PC = instance->CY ? 0x275 : 0x279;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_275(hp45inst_t *instance)
+{
+  /* 275: 6 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x276;
+  return 0;
+}
+
+static int block_276(hp45inst_t *instance)
+{
+  /* 276: if p # 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->P == 1);
+  /* 277: then go to 75 */
+  instance->PC = instance->CY ? 0x278 : 0x275;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_278(hp45inst_t *instance)
+{
+  /* 278: shift C right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  instance->PC = 0x279;
+  return 0;
+}
+
+static int block_279(hp45inst_t *instance)
+{
+  /* 279: shift C right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  instance->PC = 0x27a;
+  return 0;
+}
+
+static int block_27a(hp45inst_t *instance)
+{
+  /* 27a: if s2 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 2) & 1;
+  /* 27b: then go to 94 */
+  instance->PC = instance->CY ? 0x27c : 0x294;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_27c(hp45inst_t *instance)
+{
+  /* 27c: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x200 | instance->LR;
+  return 0;
+}
+
+static int block_27d(hp45inst_t *instance)
+{
+  /* 27d: 7 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 7;
+  instance->PC = 0x27e;
+  return 0;
+}
+
+static int block_27e(hp45inst_t *instance)
+{
+  /* 27e: 3 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 27f: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 280: 0 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x281;
+  return 0;
+}
+
+static int block_281(hp45inst_t *instance)
+{
+  /* 281: 8 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 282: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 283: 0 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 284: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 285: then go to ea */
+  instance->PC = instance->CY ? 0x286 : 0x2ea;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_286(hp45inst_t *instance)
+{
+  /* 286: jsb 96 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x87;
+  instance->PC = 0x296;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_287(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 287: A+1->A [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  instance->PC = 0x288;
+  return 0;
+}
+
+static int block_288(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 288: A->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &instance->A, FIELD_W);
+  /* 289: C-1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 28a: then go to 86 */
+  instance->PC = instance->CY ? 0x28b : 0x286;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_28b(hp45inst_t *instance)
+{
+  /* 28b: shift A right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 28c: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 28d: shift A left [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  instance->PC = 0x28e;
+  return 0;
+}
+
+static int block_28e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 28e: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 28f: A-1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 290: then go to 88 */
+  instance->PC = instance->CY ? 0x291 : 0x288;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_291(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 291: A<->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 292: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 293: jsb cc */
+  instance->LR = 0x94;
+  instance->PC = 0x2cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_294(hp45inst_t *instance)
+{
+  /* 294: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x195;
+  return 0;
+}
+
+static int block_295(hp45inst_t *instance)
+{
+  /* 295: shift A right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  instance->PC = 0x296;
+  return 0;
+}
+
+static int block_296(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 296: A-1->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 297: then go to 95 */
+  instance->PC = instance->CY ? 0x298 : 0x295;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_298(hp45inst_t *instance)
+{
+  /* 298: 0->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &zero, FIELD_S);
+  /* 299: A+B->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 29a: return */
+  instance->CY = 0;
+  instance->PC = 0x200 | instance->LR;
+  return 0;
+}
+
+static int block_29b(hp45inst_t *instance)
+{
+  /* 29b: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x19c;
+  return 0;
+}
+
+static int block_29c(hp45inst_t *instance)
+{
+  /* 29c: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  instance->PC = 0x29d;
+  return 0;
+}
+
+static int block_29d(hp45inst_t *instance)
+{
+  /* 29d: B<->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 29e: then go to a0 */
+  instance->PC = instance->CY ? 0x29f : 0x2a0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_29f(hp45inst_t *instance)
+{
+  /* 29f: A+B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  instance->PC = 0x2a0;
+  return 0;
+}
+
+static int block_2a0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2a0: C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 2a1: then go to 9f */
+  instance->PC = instance->CY ? 0x2a2 : 0x29f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2a2(hp45inst_t *instance)
+{
+  /* 2a2: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 2a3: shift A left [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  /* 2a4: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x2a5;
+  return 0;
+}
+
+static int block_2a5(hp45inst_t *instance)
+{
+  /* 2a5: then go to 6d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x2a6 : 0x26d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2a6(hp45inst_t *instance)
+{
+  /* 2a6: 3 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 3;
+  instance->PC = 0x2a7;
+  return 0;
+}
+
+static int block_2a7(hp45inst_t *instance)
+{
+  /* 2a7: A+C->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  add(instance, &instance->A, &instance->CX, &instance->CX, FIELD_X);
+  instance->PC = 0x2a8;
+  return 0;
+}
+
+static int block_2a8(hp45inst_t *instance)
+{
+  /* 2a8: A-C->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &instance->A, &instance->CX, &instance->CX, FIELD_S);
+  /* 2a9: then go to ab */
+  instance->PC = instance->CY ? 0x2aa : 0x2ab;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2aa(hp45inst_t *instance)
+{
+  /* 2aa: 0-C->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  instance->PC = 0x2ab;
+  return 0;
+}
+
+static int block_2ab(hp45inst_t *instance)
+{
+  /* 2ab: A<->B [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->B, FIELD_M);
+  /* 2ac: 0->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 2ad: if p # 12 */
+  instance->CY = (instance->P == 12);
+  /* 2ae: then go to c5 */
+  instance->PC = instance->CY ? 0x2af : 0x2c5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2af(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2af: C-1 [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  ifge(instance, &instance->CX, &temp.r, FIELD_M);
+  /* 2b0: then go to b6 */
+  instance->PC = instance->CY ? 0x2b1 : 0x2b6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2b1(hp45inst_t *instance)
+{
+  /* 2b1: if s1 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 1) & 1;
+  /* 2b2: then go to 00 */
+  instance->PC = instance->CY ? 0x2b3 : 0x200;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2b3(hp45inst_t *instance)
+{
+  /* 2b3: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x5b4;
+  return 0;
+}
+
+static int block_2b4(hp45inst_t *instance)
+{
+  /* 2b4: then go to db */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x2b5 : 0x2db;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2b5(hp45inst_t *instance)
+{
+  /* 2b5: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2b6;
+  return 0;
+}
+
+static int block_2b6(hp45inst_t *instance)
+{
+  /* 2b6: B<->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->B, &instance->CX, FIELD_WP(instance->P));
+  /* 2b7: C<->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->CX, FIELD_M);
+  /* 2b8: rom 1 */
+  instance->CY = 0;
+  instance->PC = 0x1b9;
+  return 0;
+}
+
+static int block_2b9(hp45inst_t *instance)
+{
+  /* 2b9: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 2ba: 6 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2bb: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2bc: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2bd: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2be: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2bf: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2c0: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2c1: then go to e6 */
+  instance->PC = instance->CY ? 0x2c2 : 0x2e6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2c2(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2c2: A+1->A [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_M);
+  /* 2c3: then go to 64 */
+  instance->PC = instance->CY ? 0x2c4 : 0x264;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2c4(hp45inst_t *instance)
+{
+  /* 2c4: A+B->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  instance->PC = 0x2c5;
+  return 0;
+}
+
+static int block_2c5(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2c5: C-1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x2c6;
+  return 0;
+}
+
+static int block_2c6(hp45inst_t *instance)
+{
+  /* 2c6: then go to c4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x2c7 : 0x2c4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2c7(hp45inst_t *instance)
+{
+  /* 2c7: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 2c8: p + 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  /* 2c9: if p # 13 */
+  instance->CY = (instance->P == 13);
+  /* 2ca: then go to c5 */
+  instance->PC = instance->CY ? 0x2cb : 0x2c5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2cb(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2cb: C+1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  instance->PC = 0x2cc;
+  return 0;
+}
+
+static int block_2cc(hp45inst_t *instance)
+{
+  /* 2cc: 0->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &zero, FIELD_S);
+  /* 2cd: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 2ce: 0->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  instance->PC = 0x2cf;
+  return 0;
+}
+
+static int block_2cf(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2cf: A-1 [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->A, &temp.r, FIELD_P(instance->P));
+  /* 2d0: then go to d6 */
+  instance->PC = instance->CY ? 0x2d1 : 0x2d6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2d1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2d1: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 2d2: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 2d3: A-1 [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  ifge(instance, &instance->A, &temp.r, FIELD_W);
+  /* 2d4: then go to cf */
+  instance->PC = instance->CY ? 0x2d5 : 0x2cf;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2d5(hp45inst_t *instance)
+{
+  /* 2d5: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  instance->PC = 0x2d6;
+  return 0;
+}
+
+static int block_2d6(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2d6: A->B [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &instance->A, FIELD_X);
+  /* 2d7: A+B->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_W);
+  /* 2d8: A-1 [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->A, &temp.r, FIELD_S);
+  /* 2d9: then go to c7 */
+  instance->PC = instance->CY ? 0x2da : 0x2c7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2da(hp45inst_t *instance)
+{
+  /* 2da: C<->A [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->CX, FIELD_M);
+  instance->PC = 0x2db;
+  return 0;
+}
+
+static int block_2db(hp45inst_t *instance)
+{
+  /* 2db: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 2dc: 0->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  instance->PC = 0x2dd;
+  return 0;
+}
+
+static int block_2dd(hp45inst_t *instance)
+{
+  /* 2dd: 12 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 12;
+  /* 2de: then go to 7a */
+  instance->PC = instance->CY ? 0x2df : 0x27a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2df(hp45inst_t *instance)
+{
+  /* 2df: 9 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 9;
+  /* 2e0: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e1: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e2: 0 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e3: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e4: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e5: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x2e6;
+  return 0;
+}
+
+static int block_2e6(hp45inst_t *instance)
+{
+  /* 2e6: 8 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e7: 0 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e8: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2e9: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x2ea;
+  return 0;
+}
+
+static int block_2ea(hp45inst_t *instance)
+{
+  /* 2ea: 3 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2eb: then go to dd */
+  instance->PC = instance->CY ? 0x2ec : 0x2dd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2ec(hp45inst_t *instance)
+{
+  /* 2ec: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 2ed: A->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &instance->A, FIELD_W);
+  /* 2ee: C->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  mov(&instance->A, &instance->CX, FIELD_M);
+  /* 2ef: C+C->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  add(instance, &instance->CX, &instance->CX, &instance->CX, FIELD_XS);
+  /* 2f0: then go to 5e */
+  instance->PC = instance->CY ? 0x2f1 : 0x25e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2f1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2f1: C+1->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  instance->PC = 0x2f2;
+  return 0;
+}
+
+static int block_2f2(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 2f2: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 2f3: C+1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 2f4: then go to f2 */
+  instance->PC = instance->CY ? 0x2f5 : 0x2f2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2f5(hp45inst_t *instance)
+{
+  /* 2f5: then go to 67 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x2f6 : 0x267;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2f6(hp45inst_t *instance)
+{
+  /* 2f6: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 2f7: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 2f8: 2 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2f9: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2fa: 0 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2fb: 2 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2fc: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 2fd: then go to 81 */
+  instance->PC = instance->CY ? 0x2fe : 0x281;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_2fe(hp45inst_t *instance)
+{
+  /* 2fe: 5 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 5;
+  /* 2ff: then go to 7e */
+  instance->PC = instance->CY ? 0x200 : 0x27e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_300(hp45inst_t *instance)
+{
+  /* 300: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x401;
+  return 0;
+}
+
+static int block_301(hp45inst_t *instance)
+{
+  /* 301: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x302;
+  return 0;
+}
+
+static int block_302(hp45inst_t *instance)
+{
+  /* 302: then go to 4a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x303 : 0x34a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_303(hp45inst_t *instance)
+{
+  /* 303: then go to 59 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x304 : 0x359;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_304(hp45inst_t *instance)
+{
+  /* 304: then go to 5a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x305 : 0x35a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_305(hp45inst_t *instance)
+{
+  /* 305: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x306;
+  return 0;
+}
+
+static int block_306(hp45inst_t *instance)
+{
+  /* 306: then go to 44 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x307 : 0x344;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_307(hp45inst_t *instance)
+{
+  /* 307: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x208;
+  return 0;
+}
+
+static int block_308(hp45inst_t *instance)
+{
+  /* 308: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x409;
+  return 0;
+}
+
+static int block_309(hp45inst_t *instance)
+{
+  /* 309: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x60a;
+  return 0;
+}
+
+static int block_30a(hp45inst_t *instance)
+{
+  /* 30a: then go to 66 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x30b : 0x366;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_30b(hp45inst_t *instance)
+{
+  /* 30b: then go to 68 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x30c : 0x368;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_30c(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 30c: down rotate */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp.r, sizeof(reg_t));
+  instance->PC = 0x30d;
+  return 0;
+}
+
+static int block_30d(hp45inst_t *instance)
+{
+  /* 30d: then go to 7f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x30e : 0x37f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_30e(hp45inst_t *instance)
+{
+  /* 30e: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  instance->PC = 0x30f;
+  return 0;
+}
+
+static int block_30f(hp45inst_t *instance)
+{
+  /* 30f: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  instance->PC = 0x310;
+  return 0;
+}
+
+static int block_310(hp45inst_t *instance)
+{
+  /* 310: then go to 7e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x311 : 0x37e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_311(hp45inst_t *instance)
+{
+  /* 311: then go to 3f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x312 : 0x33f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_312(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 312: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x313;
+  return 0;
+}
+
+static int block_313(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 313: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x314;
+  return 0;
+}
+
+static int block_314(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 314: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x315;
+  return 0;
+}
+
+static int block_315(hp45inst_t *instance)
+{
+  /* 315: then go to 1a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x316 : 0x31a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_316(hp45inst_t *instance)
+{
+  /* 316: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x417;
+  return 0;
+}
+
+static int block_317(hp45inst_t *instance)
+{
+  /* 317: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x18;
+  instance->PC = 0x387;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_318(hp45inst_t *instance)
+{
+  /* 318: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  instance->PC = 0x319;
+  return 0;
+}
+
+static int block_319(hp45inst_t *instance)
+{
+  /* 319: then go to 52 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x31a : 0x352;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_31a(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 31a: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x31b;
+  return 0;
+}
+
+static int block_31b(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 31b: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x31c;
+  return 0;
+}
+
+static int block_31c(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 31c: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x31d;
+  return 0;
+}
+
+static int block_31d(hp45inst_t *instance)
+{
+  /* 31d: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x300 | instance->LR;
+  return 0;
+}
+
+static int block_31e(hp45inst_t *instance)
+{
+  /* 31e: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x41f;
+  return 0;
+}
+
+static int block_31f(hp45inst_t *instance)
+{
+  /* 31f: keys -> rom address */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x300 | instance->KeyCode;
+  return HP45_EVENT_KEY;
+}
+
+static int block_320(hp45inst_t *instance)
+{
+  /* 320: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  instance->PC = 0x321;
+  return 0;
+}
+
+static int block_321(hp45inst_t *instance)
+{
+  /* 321: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x422;
+  return 0;
+}
+
+static int block_322(hp45inst_t *instance)
+{
+  /* 322: then go to 20 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x323 : 0x320;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_323(hp45inst_t *instance)
+{
+  /* 323: 3 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 3;
+  instance->PC = 0x324;
+  return 0;
+}
+
+static int block_324(hp45inst_t *instance)
+{
+  /* 324: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x300 | instance->LR;
+  return 0;
+}
+
+static int block_325(hp45inst_t *instance)
+{
+  /* 325: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x426;
+  return 0;
+}
+
+static int block_326(hp45inst_t *instance)
+{
+  /* 326: then go to 25 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x327 : 0x325;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_327(hp45inst_t *instance)
+{
+  /* 327: 1 -> s5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<5;
+  instance->PC = 0x328;
+  return 0;
+}
+
+static int block_328(hp45inst_t *instance)
+{
+  /* 328: jsb 64 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x29;
+  instance->PC = 0x364;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_329(hp45inst_t *instance)
+{
+  /* 329: then go to 42 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x32a : 0x342;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_32a(hp45inst_t *instance)
+{
+  /* 32a: then go to 4c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x32b : 0x34c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_32b(hp45inst_t *instance)
+{
+  /* 32b: then go to 27 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x32c : 0x327;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_32c(hp45inst_t *instance)
+{
+  /* 32c: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x42d;
+  return 0;
+}
+
+static int block_32d(hp45inst_t *instance)
+{
+  /* 32d: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x32e;
+  return 0;
+}
+
+static int block_32e(hp45inst_t *instance)
+{
+  /* 32e: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x2f;
+  instance->PC = 0x361;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_32f(hp45inst_t *instance)
+{
+  /* 32f: then go to 48 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x330 : 0x348;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_330(hp45inst_t *instance)
+{
+  /* 330: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x331;
+  return 0;
+}
+
+static int block_331(hp45inst_t *instance)
+{
+  /* 331: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x032;
+  return 0;
+}
+
+static int block_332(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 332: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x333;
+  return 0;
+}
+
+static int block_333(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 333: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x334;
+  return 0;
+}
+
+static int block_334(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 334: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x335;
+  return 0;
+}
+
+static int block_335(hp45inst_t *instance)
+{
+  /* 335: then go to 12 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x336 : 0x312;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_336(hp45inst_t *instance)
+{
+  /* 336: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x437;
+  return 0;
+}
+
+static int block_337(hp45inst_t *instance)
+{
+  /* 337: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x338;
+  return 0;
+}
+
+static int block_338(hp45inst_t *instance)
+{
+  /* 338: jsb a6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x39;
+  instance->PC = 0x3a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_339(hp45inst_t *instance)
+{
+  /* 339: then go to 81 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x33a : 0x381;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_33a(hp45inst_t *instance)
+{
+  /* 33a: then go to bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x33b : 0x3bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_33b(hp45inst_t *instance)
+{
+  /* 33b: then go to c1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x33c : 0x3c1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_33c(hp45inst_t *instance)
+{
+  /* 33c: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  instance->PC = 0x33d;
+  return 0;
+}
+
+static int block_33d(hp45inst_t *instance)
+{
+  /* 33d: rom 7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x73e;
+  return 0;
+}
+
+static int block_33e(hp45inst_t *instance)
+{
+  /* 33e: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  instance->PC = 0x33f;
+  return 0;
+}
+
+static int block_33f(hp45inst_t *instance)
+{
+  /* 33f: jsb a7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x40;
+  instance->PC = 0x3a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_340(hp45inst_t *instance)
+{
+  /* 340: then go to 81 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x341 : 0x381;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_341(hp45inst_t *instance)
+{
+  /* 341: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x42;
+  instance->PC = 0x361;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_342(hp45inst_t *instance)
+{
+  /* 342: 0 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<9);
+  /* 343: then go to 31 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x344 : 0x331;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_344(hp45inst_t *instance)
+{
+  /* 344: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x45;
+  instance->PC = 0x361;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_345(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 345: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 346: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 347: then go to 49 */
+  instance->PC = instance->CY ? 0x348 : 0x349;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_348(hp45inst_t *instance)
+{
+  /* 348: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x449;
+  return 0;
+}
+
+static int block_349(hp45inst_t *instance)
+{
+  /* 349: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x44a;
+  return 0;
+}
+
+static int block_34a(hp45inst_t *instance)
+{
+  /* 34a: 0 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<9);
+  /* 34b: then go to 17 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x34c : 0x317;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_34c(hp45inst_t *instance)
+{
+  /* 34c: jsb 64 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4d;
+  instance->PC = 0x364;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_34d(hp45inst_t *instance)
+{
+  /* 34d: 1 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<9;
+  instance->PC = 0x34e;
+  return 0;
+}
+
+static int block_34e(hp45inst_t *instance)
+{
+  /* 34e: 1 -> s5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<5;
+  /* 34f: then go to 31 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x350 : 0x331;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_350(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 350: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 351: A+1->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x352;
+  return 0;
+}
+
+static int block_352(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 352: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 353: c <-> m */
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 354: C<->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  /* 355: c <-> m */
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  instance->PC = 0x356;
+  return 0;
+}
+
+static int block_356(hp45inst_t *instance)
+{
+  /* 356: then go to 72 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x357 : 0x372;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_357(hp45inst_t *instance)
+{
+  /* 357: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 358: nop */
+  instance->CY = 0;
+  instance->PC = 0x359;
+  return 0;
+}
+
+static int block_359(hp45inst_t *instance)
+{
+  /* 359: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  instance->PC = 0x35a;
+  return 0;
+}
+
+static int block_35a(hp45inst_t *instance)
+{
+  /* 35a: 1 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<9;
+  /* 35b: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x5c;
+  instance->PC = 0x361;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_35c(hp45inst_t *instance)
+{
+  /* 35c: 1 -> s2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<2;
+  /* 35d: then go to 07 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x35e : 0x307;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_35e(hp45inst_t *instance)
+{
+  /* 35e: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x5f;
+  instance->PC = 0x387;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_35f(hp45inst_t *instance)
+{
+  /* 35f: then go to 50 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x360 : 0x350;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_360(hp45inst_t *instance)
+{
+  /* 360: 1 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<3;
+  instance->PC = 0x361;
+  return 0;
+}
+
+static int block_361(hp45inst_t *instance)
+{
+  /* 361: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 362: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x663;
+  return 0;
+}
+
+static int block_363(hp45inst_t *instance)
+{
+  /* 363: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x664;
+  return 0;
+}
+
+static int block_364(hp45inst_t *instance)
+{
+  /* 364: 1 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<1;
+  /* 365: then go to 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x366 : 0x361;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_366(hp45inst_t *instance)
+{
+  /* 366: 1 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<9;
+  /* 367: then go to 69 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x368 : 0x369;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_368(hp45inst_t *instance)
+{
+  /* 368: 0 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<9);
+  instance->PC = 0x369;
+  return 0;
+}
+
+static int block_369(hp45inst_t *instance)
+{
+  /* 369: 1 -> s2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<2;
+  /* 36a: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x6b;
+  instance->PC = 0x387;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_36b(hp45inst_t *instance)
+{
+  /* 36b: jsb 75 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x6c;
+  instance->PC = 0x375;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_36c(hp45inst_t *instance)
+{
+  /* 36c: jsb 63 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x6d;
+  instance->PC = 0x363;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_36d(hp45inst_t *instance)
+{
+  /* 36d: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 36e: then go to 71 */
+  instance->PC = instance->CY ? 0x36f : 0x371;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_36f(hp45inst_t *instance)
+{
+  /* 36f: jsb f6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x70;
+  instance->PC = 0x3f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_370(hp45inst_t *instance)
+{
+  /* 370: then go to 7e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x371 : 0x37e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_371(hp45inst_t *instance)
+{
+  /* 371: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  instance->PC = 0x372;
+  return 0;
+}
+
+static int block_372(hp45inst_t *instance)
+{
+  /* 372: if s7 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 7) & 1;
+  /* 373: then go to 3f */
+  instance->PC = instance->CY ? 0x374 : 0x33f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_374(hp45inst_t *instance)
+{
+  /* 374: then go to 7f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x375 : 0x37f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_375(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 375: 0 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 0;
+  /* 376: A-1 [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->A, &temp.r, FIELD_P(instance->P));
+  /* 377: then go to ff */
+  instance->PC = instance->CY ? 0x378 : 0x3ff;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_378(hp45inst_t *instance)
+{
+  /* 378: then go to 72 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x379 : 0x372;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_379(hp45inst_t *instance)
+{
+  /* 379: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x7a;
+  instance->PC = 0x387;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_37a(hp45inst_t *instance)
+{
+  /* 37a: jsb 75 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x7b;
+  instance->PC = 0x375;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_37b(hp45inst_t *instance)
+{
+  /* 37b: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x47c;
+  return 0;
+}
+
+static int block_37e(hp45inst_t *instance)
+{
+  /* 37e: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_37f(hp45inst_t *instance)
+{
+  /* 37f: jsb a7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x80;
+  instance->PC = 0x3a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_380(hp45inst_t *instance)
+{
+  /* 380: 1 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  instance->PC = 0x381;
+  return 0;
+}
+
+static int block_381(hp45inst_t *instance)
+{
+  /* 381: jsb 85 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x82;
+  instance->PC = 0x385;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_382(hp45inst_t *instance)
+{
+  /* 382: jsb f5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x83;
+  instance->PC = 0x3f5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_383(hp45inst_t *instance)
+{
+  /* 383: then go to d6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x384 : 0x3d6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_384(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 384: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  instance->PC = 0x385;
+  return 0;
+}
+
+static int block_385(hp45inst_t *instance)
+{
+  /* 385: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 386: then go to 88 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x387 : 0x388;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_387(hp45inst_t *instance)
+{
+  /* 387: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  instance->PC = 0x388;
+  return 0;
+}
+
+static int block_388(hp45inst_t *instance)
+{
+  /* 388: C->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &instance->CX, FIELD_S);
+  /* 389: 0 -> s8 */
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 38a: then go to 94 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x38b : 0x394;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_38b(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 38b: C+1->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  instance->PC = 0x38c;
+  return 0;
+}
+
+static int block_38c(hp45inst_t *instance)
+{
+  /* 38c: 1 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<8;
+  /* 38d: if s5 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 5) & 1;
+  /* 38e: then go to 92 */
+  instance->PC = instance->CY ? 0x38f : 0x392;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_38f(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 38f: C+1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 390: then go to 8b */
+  instance->PC = instance->CY ? 0x391 : 0x38b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_391(hp45inst_t *instance)
+{
+  /* 391: display toggle */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x392;
+  instance->DispOn = !instance->DispOn;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int block_392(hp45inst_t *instance)
+{
+  /* 392: if s0 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 0) & 1;
+  /* 393: then go to 8c */
+  instance->PC = instance->CY ? 0x394 : 0x38c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_394(hp45inst_t *instance)
+{
+  /* 394: 0 -> s0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<0);
+  instance->PC = 0x395;
+  return 0;
+}
+
+static int block_395(hp45inst_t *instance)
+{
+  /* 395: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 396: if p # 12 */
+  instance->CY = (instance->P == 12);
+  /* 397: then go to 95 */
+  instance->PC = instance->CY ? 0x398 : 0x395;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_398(hp45inst_t *instance)
+{
+  /* 398: display off */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x399;
+  if(!instance->DispOn)
+    return 0;
+  instance->DispOn = 0;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int block_399(hp45inst_t *instance)
+{
+  /* 399: if s8 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 8) & 1;
+  /* 39a: then go to 91 */
+  instance->PC = instance->CY ? 0x39b : 0x391;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_39b(hp45inst_t *instance)
+{
+  /* 39b: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 39c: 0 -> s5 */
+  instance->CY = 0;
+  instance->S &= ~(1<<5);
+  /* 39d: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 39e: then go to 1f */
+  instance->PC = instance->CY ? 0x39f : 0x31f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_39f(hp45inst_t *instance)
+{
+  /* 39f: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x4a0;
+  return 0;
+}
+
+static int block_3a1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3a1: 0->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 3a2: C-1->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_WP(instance->P));
+  /* 3a3: 0->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->CX, &zero, FIELD_XS);
+  /* 3a4: A+B->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_X);
+  /* 3a5: then go to a7 */
+  instance->PC = instance->CY ? 0x3a6 : 0x3a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3a6(hp45inst_t *instance)
+{
+  /* 3a6: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  instance->PC = 0x3a7;
+  return 0;
+}
+
+static int block_3a7(hp45inst_t *instance)
+{
+  /* 3a7: clear status */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S = 0;
+  /* 3a8: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x3a9;
+  return 0;
+}
+
+static int block_3a9(hp45inst_t *instance)
+{
+  /* 3a9: 12 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 12;
+  /* 3aa: A->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &instance->A, FIELD_X);
+  /* 3ab: C->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &instance->CX, FIELD_X);
+  /* 3ac: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 3ad: then go to b1 */
+  instance->PC = instance->CY ? 0x3ae : 0x3b1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3ae(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3ae: 0-C->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_X);
+  /* 3af: C-1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 3b0: then go to a1 */
+  instance->PC = instance->CY ? 0x3b1 : 0x3a1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3b1(hp45inst_t *instance)
+{
+  /* 3b1: C<->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  /* 3b2: if s4 = 1 */
+  instance->CY = (instance->S >> 4) & 1;
+  /* 3b3: then go to 09 */
+  instance->PC = instance->CY ? 0x3b4 : 0x309;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3b4(hp45inst_t *instance)
+{
+  /* 3b4: A<->B [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->B, FIELD_X);
+  /* 3b5: 0->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &zero, FIELD_X);
+  /* 3b6: jsb 85 */
+  instance->LR = 0xb7;
+  instance->PC = 0x385;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3b7(hp45inst_t *instance)
+{
+  /* 3b7: if p # 12 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->P == 12);
+  /* 3b8: then go to 87 */
+  instance->PC = instance->CY ? 0x3b9 : 0x387;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3b9(hp45inst_t *instance)
+{
+  /* 3b9: shift A left [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  shift(&instance->A, 1, FIELD_X);
+  /* 3ba: then go to be */
+  instance->PC = instance->CY ? 0x3bb : 0x3be;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3bb(hp45inst_t *instance)
+{
+  /* 3bb: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  /* 3bc: if s11 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 11) & 1;
+  /* 3bd: then go to 1c */
+  instance->PC = instance->CY ? 0x3be : 0x31c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3be(hp45inst_t *instance)
+{
+  /* 3be: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 3bf: C<->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->CX, FIELD_WP(instance->P));
+  /* 3c0: then go to c6 */
+  instance->PC = instance->CY ? 0x3c1 : 0x3c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3c1(hp45inst_t *instance)
+{
+  /* 3c1: shift A right [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 0, FIELD_W);
+  /* 3c2: if s4 = 1 */
+  instance->CY = (instance->S >> 4) & 1;
+  /* 3c3: then go to 84 */
+  instance->PC = instance->CY ? 0x3c4 : 0x384;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3c4(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3c4: C<->A [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  exch(&instance->A, &instance->CX, FIELD_WP(instance->P));
+  /* 3c5: 0-C-1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_XS);
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  instance->CY = 1;
+  instance->PC = 0x3c6;
+  return 0;
+}
+
+static int block_3c6(hp45inst_t *instance)
+{
+  /* 3c6: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 3c7: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 3c8: then go to cb */
+  instance->PC = instance->CY ? 0x3c9 : 0x3cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3c9(hp45inst_t *instance)
+{
+  /* 3c9: 0->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->CX, &zero, FIELD_XS);
+  /* 3ca: 0-C->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_X);
+  instance->PC = 0x3cb;
+  return 0;
+}
+
+static int block_3cb(hp45inst_t *instance)
+{
+  /* 3cb: 13 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 13;
+  instance->PC = 0x3cc;
+  return 0;
+}
+
+static int block_3cc(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3cc: shift A left [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  /* 3cd: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 3ce: A-1 [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->A, &temp.r, FIELD_S);
+  /* 3cf: then go to ec */
+  instance->PC = instance->CY ? 0x3d0 : 0x3ec;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3d0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3d0: A-1 [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  set1(&temp.r, FIELD_MS);
+  ifge(instance, &instance->A, &temp.r, FIELD_MS);
+  /* 3d1: then go to cc */
+  instance->PC = instance->CY ? 0x3d2 : 0x3cc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3d2(hp45inst_t *instance)
+{
+  /* 3d2: 0->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->CX, &zero, FIELD_X);
+  instance->PC = 0x3d3;
+  return 0;
+}
+
+static int block_3d3(hp45inst_t *instance)
+{
+  /* 3d3: jsb 85 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xd4;
+  instance->PC = 0x385;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3d4(hp45inst_t *instance)
+{
+  /* 3d4: shift A right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 3d5: C->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &instance->CX, FIELD_S);
+  instance->PC = 0x3d6;
+  return 0;
+}
+
+static int block_3d6(hp45inst_t *instance)
+{
+  /* 3d6: if p # 12 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->P == 12);
+  /* 3d7: then go to df */
+  instance->PC = instance->CY ? 0x3d8 : 0x3df;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3d8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3d8: B->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &instance->B, FIELD_W);
+  /* 3d9: C+1->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_W);
+  /* 3da: 1 -> p */
+  instance->CY = 0;
+  instance->P = 1;
+  instance->PC = 0x3db;
+  return 0;
+}
+
+static int block_3db(hp45inst_t *instance)
+{
+  /* 3db: shift A left [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 3dc: p + 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  /* 3dd: 0-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifeq0(instance, &instance->CX, FIELD_P(instance->P));
+  /* 3de: then go to db */
+  instance->PC = instance->CY ? 0x3df : 0x3db;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3df(hp45inst_t *instance)
+{
+  /* 3df: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 3e0: if p # 3 */
+  instance->CY = (instance->P == 3);
+  /* 3e1: then go to e5 */
+  instance->PC = instance->CY ? 0x3e2 : 0x3e5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3e2(hp45inst_t *instance)
+{
+  /* 3e2: 0->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->CX, &zero, FIELD_X);
+  /* 3e3: 1 -> s6 */
+  instance->CY = 0;
+  instance->S |= 1<<6;
+  /* 3e4: then go to c6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x3e5 : 0x3c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3e5(hp45inst_t *instance)
+{
+  /* 3e5: if s6 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 6) & 1;
+  /* 3e6: then go to e8 */
+  instance->PC = instance->CY ? 0x3e7 : 0x3e8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3e7(hp45inst_t *instance)
+{
+  /* 3e7: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x3e8;
+  return 0;
+}
+
+static int block_3e8(hp45inst_t *instance)
+{
+  /* 3e8: shift B right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  /* 3e9: jsb c6 */
+  instance->LR = 0xea;
+  instance->PC = 0x3c6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3ea(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3ea: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 3eb: C+1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  instance->PC = 0x3ec;
+  return 0;
+}
+
+static int block_3ec(hp45inst_t *instance)
+{
+  /* 3ec: 0-B [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  ifeq0(instance, &instance->B, FIELD_P(instance->P));
+  /* 3ed: then go to ea */
+  instance->PC = instance->CY ? 0x3ee : 0x3ea;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3ee(hp45inst_t *instance)
+{
+  /* 3ee: 1 -> s11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<11;
+  /* 3ef: shift A right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 3f0: C<->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  exch(&instance->A, &instance->CX, FIELD_M);
+  /* 3f1: if s4 = 1 */
+  instance->CY = (instance->S >> 4) & 1;
+  /* 3f2: then go to d3 */
+  instance->PC = instance->CY ? 0x3f3 : 0x3d3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3f3(hp45inst_t *instance)
+{
+  /* 3f3: jsb a9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xf4;
+  instance->PC = 0x3a9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3f4(hp45inst_t *instance)
+{
+  /* 3f4: then go to 81 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x3f5 : 0x381;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3f5(hp45inst_t *instance)
+{
+  /* 3f5: 0->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  mov(&instance->A, &zero, FIELD_MS);
+  instance->PC = 0x3f6;
+  return 0;
+}
+
+static int block_3f6(hp45inst_t *instance)
+{
+  /* 3f6: if s7 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 7) & 1;
+  /* 3f7: then go to f9 */
+  instance->PC = instance->CY ? 0x3f8 : 0x3f9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_3f8(hp45inst_t *instance)
+{
+  /* 3f8: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  instance->PC = 0x3f9;
+  return 0;
+}
+
+static int block_3f9(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 3f9: 1 -> s7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<7;
+  /* 3fa: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 3fb: C-1->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_W);
+  /* 3fc: 0-C->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  /* 3fd: C+1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 3fe: B<->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  instance->PC = 0x3ff;
+  return 0;
+}
+
+static int block_3ff(hp45inst_t *instance)
+{
+  /* 3ff: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x300 | instance->LR;
+  return 0;
+}
+
+static int block_400(hp45inst_t *instance)
+{
+  /* 400: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x401;
+  return 0;
+}
+
+static int block_401(hp45inst_t *instance)
+{
+  /* 401: then go to 84 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x402 : 0x484;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_402(hp45inst_t *instance)
+{
+  /* 402: then go to 5c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x403 : 0x45c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_403(hp45inst_t *instance)
+{
+  /* 403: then go to c8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x404 : 0x4c8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_404(hp45inst_t *instance)
+{
+  /* 404: then go to 58 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x405 : 0x458;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_405(hp45inst_t *instance)
+{
+  /* 405: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x606;
+  return 0;
+}
+
+static int block_406(hp45inst_t *instance)
+{
+  /* 406: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x07;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_407(hp45inst_t *instance)
+{
+  /* 407: then go to 5a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x408 : 0x45a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_408(hp45inst_t *instance)
+{
+  /* 408: then go to 98 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x409 : 0x498;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_409(hp45inst_t *instance)
+{
+  /* 409: then go to 42 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x40a : 0x442;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_40a(hp45inst_t *instance)
+{
+  /* 40a: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  instance->PC = 0x40b;
+  return 0;
+}
+
+static int block_40b(hp45inst_t *instance)
+{
+  /* 40b: then go to 10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x40c : 0x410;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_40c(hp45inst_t *instance)
+{
+  /* 40c: then go to 20 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x40d : 0x420;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_40d(hp45inst_t *instance)
+{
+  /* 40d: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x00e;
+  return 0;
+}
+
+static int block_40e(hp45inst_t *instance)
+{
+  /* 40e: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x0f;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_40f(hp45inst_t *instance)
+{
+  /* 40f: then go to ff */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x410 : 0x4ff;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_410(hp45inst_t *instance)
+{
+  /* 410: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x11;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_411(hp45inst_t *instance)
+{
+  /* 411: then go to 0d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x412 : 0x40d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_412(hp45inst_t *instance)
+{
+  /* 412: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x413 : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_413(hp45inst_t *instance)
+{
+  /* 413: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x414 : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_414(hp45inst_t *instance)
+{
+  /* 414: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x415 : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_415(hp45inst_t *instance)
+{
+  /* 415: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x516;
+  return 0;
+}
+
+static int block_416(hp45inst_t *instance)
+{
+  /* 416: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x417;
+  return 0;
+}
+
+static int block_417(hp45inst_t *instance)
+{
+  /* 417: then go to 68 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x418 : 0x468;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_418(hp45inst_t *instance)
+{
+  /* 418: then go to b5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x419 : 0x4b5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_419(hp45inst_t *instance)
+{
+  /* 419: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x41a;
+  return 0;
+}
+
+static int block_41a(hp45inst_t *instance)
+{
+  /* 41a: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x41b : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_41b(hp45inst_t *instance)
+{
+  /* 41b: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x41c : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_41c(hp45inst_t *instance)
+{
+  /* 41c: then go to 82 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x41d : 0x482;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_41d(hp45inst_t *instance)
+{
+  /* 41d: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x41e;
+  return 0;
+}
+
+static int block_41e(hp45inst_t *instance)
+{
+  /* 41e: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x41f;
+  return 0;
+}
+
+static int block_41f(hp45inst_t *instance)
+{
+  /* 41f: then go to 6e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x420 : 0x46e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_420(hp45inst_t *instance)
+{
+  /* 420: jsb 60 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x21;
+  instance->PC = 0x460;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_421(hp45inst_t *instance)
+{
+  /* 421: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x522;
+  return 0;
+}
+
+static int block_422(hp45inst_t *instance)
+{
+  /* 422: then go to d0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x423 : 0x4d0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_423(hp45inst_t *instance)
+{
+  /* 423: then go to 72 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x424 : 0x472;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_424(hp45inst_t *instance)
+{
+  /* 424: then go to 71 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x425 : 0x471;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_425(hp45inst_t *instance)
+{
+  /* 425: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x426;
+  return 0;
+}
+
+static int block_426(hp45inst_t *instance)
+{
+  /* 426: then go to 73 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x427 : 0x473;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_427(hp45inst_t *instance)
+{
+  /* 427: 1 -> s5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<5;
+  instance->PC = 0x428;
+  return 0;
+}
+
+static int block_428(hp45inst_t *instance)
+{
+  /* 428: jsb 5e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x29;
+  instance->PC = 0x45e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_429(hp45inst_t *instance)
+{
+  /* 429: then go to 41 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x42a : 0x441;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42a(hp45inst_t *instance)
+{
+  /* 42a: then go to 4b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x42b : 0x44b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42b(hp45inst_t *instance)
+{
+  /* 42b: then go to 27 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x42c : 0x427;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42c(hp45inst_t *instance)
+{
+  /* 42c: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x42d : 0x493;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42d(hp45inst_t *instance)
+{
+  /* 42d: then go to a8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x42e : 0x4a8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42e(hp45inst_t *instance)
+{
+  /* 42e: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x2f;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_42f(hp45inst_t *instance)
+{
+  /* 42f: then go to 41 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x430 : 0x441;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_430(hp45inst_t *instance)
+{
+  /* 430: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x431;
+  return 0;
+}
+
+static int block_431(hp45inst_t *instance)
+{
+  /* 431: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x432;
+  return 0;
+}
+
+static int block_432(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 432: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x433;
+  return 0;
+}
+
+static int block_433(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 433: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x434;
+  return 0;
+}
+
+static int block_434(hp45inst_t *instance)
+{
+  /* 434: then go to 70 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x435 : 0x470;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_435(hp45inst_t *instance)
+{
+  /* 435: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x536;
+  return 0;
+}
+
+static int block_436(hp45inst_t *instance)
+{
+  /* 436: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x437;
+  return 0;
+}
+
+static int block_437(hp45inst_t *instance)
+{
+  /* 437: then go to 6b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x438 : 0x46b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_438(hp45inst_t *instance)
+{
+  /* 438: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x39;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_439(hp45inst_t *instance)
+{
+  /* 439: then go to f5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x43a : 0x4f5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_43a(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 43a: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x43b;
+  return 0;
+}
+
+static int block_43b(hp45inst_t *instance)
+{
+  /* 43b: then go to 3f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x43c : 0x43f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_43c(hp45inst_t *instance)
+{
+  /* 43c: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x43d;
+  return 0;
+}
+
+static int block_43d(hp45inst_t *instance)
+{
+  /* 43d: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x43e;
+  return 0;
+}
+
+static int block_43e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 43e: A-1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x43f;
+  return 0;
+}
+
+static int block_43f(hp45inst_t *instance)
+{
+  /* 43f: 0 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 0;
+  /* 440: then go to 4e */
+  instance->PC = instance->CY ? 0x441 : 0x44e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_441(hp45inst_t *instance)
+{
+  /* 441: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x342;
+  return 0;
+}
+
+static int block_442(hp45inst_t *instance)
+{
+  /* 442: jsb 60 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x43;
+  instance->PC = 0x460;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_443(hp45inst_t *instance)
+{
+  /* 443: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  instance->PC = 0x444;
+  return 0;
+}
+
+static int block_444(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 444: down rotate */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp.r, sizeof(reg_t));
+  /* 445: c -> stack */
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 446: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 447: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 448: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  instance->PC = 0x449;
+  return 0;
+}
+
+static int block_449(hp45inst_t *instance)
+{
+  /* 449: then go to a3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x44a : 0x4a3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_44a(hp45inst_t *instance)
+{
+  /* 44a: then go to a1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x44b : 0x4a1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_44b(hp45inst_t *instance)
+{
+  /* 44b: jsb 5e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4c;
+  instance->PC = 0x45e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_44c(hp45inst_t *instance)
+{
+  /* 44c: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x34d;
+  return 0;
+}
+
+static int block_44d(hp45inst_t *instance)
+{
+  /* 44d: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x34e;
+  return 0;
+}
+
+static int block_44e(hp45inst_t *instance)
+{
+  /* 44e: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 44f: p + 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  /* 450: if p # 13 */
+  instance->CY = (instance->P == 13);
+  /* 451: then go to 4e */
+  instance->PC = instance->CY ? 0x452 : 0x44e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_452(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 452: c <-> m */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 453: C<->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  exch(&instance->A, &instance->CX, FIELD_P(instance->P));
+  /* 454: c <-> m */
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 455: rom 3 */
+  instance->CY = 0;
+  instance->PC = 0x356;
+  return 0;
+}
+
+static int block_458(hp45inst_t *instance)
+{
+  /* 458: 1 -> s5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<5;
+  /* 459: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x35a;
+  return 0;
+}
+
+static int block_45a(hp45inst_t *instance)
+{
+  /* 45a: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x5b;
+  instance->PC = 0x487;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_45b(hp45inst_t *instance)
+{
+  /* 45b: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x35c;
+  return 0;
+}
+
+static int block_45c(hp45inst_t *instance)
+{
+  /* 45c: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 45d: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x35e;
+  return 0;
+}
+
+static int block_45e(hp45inst_t *instance)
+{
+  /* 45e: 1 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<1;
+  /* 45f: then go to 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x460 : 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_460(hp45inst_t *instance)
+{
+  /* 460: 1 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<3;
+  instance->PC = 0x461;
+  return 0;
+}
+
+static int block_461(hp45inst_t *instance)
+{
+  /* 461: 1 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<10;
+  /* 462: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x663;
+  return 0;
+}
+
+static int block_463(hp45inst_t *instance)
+{
+  /* 463: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x664;
+  return 0;
+}
+
+static int block_464(hp45inst_t *instance)
+{
+  /* 464: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x665;
+  return 0;
+}
+
+static int block_465(hp45inst_t *instance)
+{
+  /* 465: 1 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<10;
+  /* 466: 1 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<3;
+  /* 467: then go to 63 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x468 : 0x463;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_468(hp45inst_t *instance)
+{
+  /* 468: 1 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<6;
+  /* 469: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  /* 46a: then go to 75 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x46b : 0x475;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_46b(hp45inst_t *instance)
+{
+  /* 46b: 0 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<6);
+  /* 46c: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  /* 46d: then go to 75 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x46e : 0x475;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_46e(hp45inst_t *instance)
+{
+  /* 46e: 1 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<6;
+  /* 46f: then go to 74 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x470 : 0x474;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_470(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 470: A+1->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  set1(&temp.r, FIELD_W);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_W);
+  instance->PC = 0x471;
+  return 0;
+}
+
+static int block_471(hp45inst_t *instance)
+{
+  /* 471: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x672;
+  return 0;
+}
+
+static int block_472(hp45inst_t *instance)
+{
+  /* 472: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x673;
+  return 0;
+}
+
+static int block_473(hp45inst_t *instance)
+{
+  /* 473: 0 -> s6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<6);
+  instance->PC = 0x474;
+  return 0;
+}
+
+static int block_474(hp45inst_t *instance)
+{
+  /* 474: 0 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<4);
+  instance->PC = 0x475;
+  return 0;
+}
+
+static int block_475(hp45inst_t *instance)
+{
+  /* 475: if s2 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 2) & 1;
+  /* 476: then go to 7f */
+  instance->PC = instance->CY ? 0x477 : 0x47f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_477(hp45inst_t *instance)
+{
+  /* 477: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 478: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x379;
+  return 0;
+}
+
+static int block_479(hp45inst_t *instance)
+{
+  /* 479: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 47a: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x57b;
+  return 0;
+}
+
+static int block_47c(hp45inst_t *instance)
+{
+  /* 47c: then go to 8b */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x47d : 0x48b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_47d(hp45inst_t *instance)
+{
+  /* 47d: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 47e: rom 3 */
+  instance->CY = 0;
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_47f(hp45inst_t *instance)
+{
+  /* 47f: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x80;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_480(hp45inst_t *instance)
+{
+  /* 480: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  /* 481: then go to 79 */
+  instance->PC = instance->CY ? 0x482 : 0x479;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_482(hp45inst_t *instance)
+{
+  /* 482: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 483: then go to 85 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x484 : 0x485;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_484(hp45inst_t *instance)
+{
+  /* 484: 1 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<10;
+  instance->PC = 0x485;
+  return 0;
+}
+
+static int block_485(hp45inst_t *instance)
+{
+  /* 485: 0 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<9);
+  /* 486: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x387;
+  return 0;
+}
+
+static int block_487(hp45inst_t *instance)
+{
+  /* 487: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  instance->PC = 0x488;
+  return 0;
+}
+
+static int block_488(hp45inst_t *instance)
+{
+  /* 488: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 489: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 48a: return */
+  instance->CY = 0;
+  instance->PC = 0x400 | instance->LR;
+  return 0;
+}
+
+static int block_48b(hp45inst_t *instance)
+{
+  /* 48b: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 48c: then go to 90 */
+  instance->PC = instance->CY ? 0x48d : 0x490;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_48d(hp45inst_t *instance)
+{
+  /* 48d: jsb 60 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x8e;
+  instance->PC = 0x460;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_48e(hp45inst_t *instance)
+{
+  /* 48e: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 48f: then go to 79 */
+  instance->PC = instance->CY ? 0x490 : 0x479;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_490(hp45inst_t *instance)
+{
+  /* 490: jsb 65 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x91;
+  instance->PC = 0x465;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_491(hp45inst_t *instance)
+{
+  /* 491: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 492: then go to 8e */
+  instance->PC = instance->CY ? 0x493 : 0x48e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_493(hp45inst_t *instance)
+{
+  /* 493: jsb 5e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x94;
+  instance->PC = 0x45e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_494(hp45inst_t *instance)
+{
+  /* 494: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  /* 495: 1 -> s3 */
+  instance->CY = 0;
+  instance->S |= 1<<3;
+  /* 496: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 497: then go to 4d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x498 : 0x44d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_498(hp45inst_t *instance)
+{
+  /* 498: jsb 60 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x99;
+  instance->PC = 0x460;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_499(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 499: down rotate */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp.r, sizeof(reg_t));
+  /* 49a: c -> stack */
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 49b: jsb a6 */
+  instance->LR = 0x9c;
+  instance->PC = 0x4a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_49c(hp45inst_t *instance)
+{
+  /* 49c: then go to 44 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x49d : 0x444;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_49d(hp45inst_t *instance)
+{
+  /* 49d: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 49e: nop */
+  instance->CY = 0;
+  instance->PC = 0x49f;
+  return 0;
+}
+
+static int block_49f(hp45inst_t *instance)
+{
+  /* 49f: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x5a0;
+  return 0;
+}
+
+static int block_4a0(hp45inst_t *instance)
+{
+  /* 4a0: keys -> rom address */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x400 | instance->KeyCode;
+  return HP45_EVENT_KEY;
+}
+
+static int block_4a1(hp45inst_t *instance)
+{
+  /* 4a1: 0 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<3);
+  /* 4a2: then go to a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x4a3 : 0x4a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4a3(hp45inst_t *instance)
+{
+  /* 4a3: 0 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<3);
+  instance->PC = 0x4a4;
+  return 0;
+}
+
+static int block_4a4(hp45inst_t *instance)
+{
+  /* 4a4: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a5;
+  return 0;
+}
+
+static int block_4a5(hp45inst_t *instance)
+{
+  /* 4a5: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a6;
+  return 0;
+}
+
+static int block_4a6(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4a6: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  instance->PC = 0x4a7;
+  return 0;
+}
+
+static int block_4a7(hp45inst_t *instance)
+{
+  /* 4a7: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x0a8;
+  return 0;
+}
+
+static int block_4a8(hp45inst_t *instance)
+{
+  /* 4a8: jsb 5e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa9;
+  instance->PC = 0x45e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4a9(hp45inst_t *instance)
+{
+  /* 4a9: 1 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<3;
+  /* 4aa: 0 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<4);
+  /* 4ab: 0-C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  ifeq0(instance, &instance->CX, FIELD_S);
+  /* 4ac: then go to ae */
+  instance->PC = instance->CY ? 0x4ad : 0x4ae;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4ad(hp45inst_t *instance)
+{
+  /* 4ad: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  instance->PC = 0x4ae;
+  return 0;
+}
+
+static int block_4ae(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4ae: down rotate */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp.r, sizeof(reg_t));
+  /* 4af: jsb 88 */
+  instance->LR = 0xb0;
+  instance->PC = 0x488;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4b0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4b0: A-1 [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  set1(&temp.r, FIELD_M);
+  ifge(instance, &instance->A, &temp.r, FIELD_M);
+  /* 4b1: then go to 35 */
+  instance->PC = instance->CY ? 0x4b2 : 0x435;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4b2(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4b2: 0->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 4b3: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 4b4: jsb 35 */
+  instance->LR = 0xb5;
+  instance->PC = 0x435;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4b5(hp45inst_t *instance)
+{
+  /* 4b5: 0 -> s1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<1);
+  /* 4b6: jsb 87 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xb7;
+  instance->PC = 0x487;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4b7(hp45inst_t *instance)
+{
+  /* 4b7: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 4b8: jsb a4 */
+  instance->LR = 0xb9;
+  instance->PC = 0x4a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4b9(hp45inst_t *instance)
+{
+  /* 4b9: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 4ba: jsb cb */
+  instance->LR = 0xbb;
+  instance->PC = 0x4cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4bb(hp45inst_t *instance)
+{
+  /* 4bb: jsb 64 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xbc;
+  instance->PC = 0x464;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4bc(hp45inst_t *instance)
+{
+  /* 4bc: jsb a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xbd;
+  instance->PC = 0x4a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4bd(hp45inst_t *instance)
+{
+  /* 4bd: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 4be: jsb a7 */
+  instance->LR = 0xbf;
+  instance->PC = 0x4a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4bf(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4bf: A-1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 4c0: A-1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 4c1: A-1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 4c2: then go to c5 */
+  instance->PC = instance->CY ? 0x4c3 : 0x4c5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4c3(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 4c3: C-1->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 4c4: jsb f1 */
+  instance->LR = 0xc5;
+  instance->PC = 0x4f1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4c5(hp45inst_t *instance)
+{
+  /* 4c5: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 4c6: jsb 41 */
+  instance->LR = 0xc7;
+  instance->PC = 0x441;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4c7(hp45inst_t *instance)
+{
+  /* 4c7: then go to f1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x4c8 : 0x4f1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4c8(hp45inst_t *instance)
+{
+  /* 4c8: jsb 61 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xc9;
+  instance->PC = 0x461;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4c9(hp45inst_t *instance)
+{
+  /* 4c9: 1 -> s2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<2;
+  /* 4ca: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x4cb : 0x405;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4cb(hp45inst_t *instance)
+{
+  /* 4cb: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 4cc: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 4cd: nop */
+  instance->CY = 0;
+  /* 4ce: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 4cf: return */
+  instance->CY = 0;
+  instance->PC = 0x400 | instance->LR;
+  return 0;
+}
+
+static int block_4d0(hp45inst_t *instance)
+{
+  /* 4d0: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 4d1: then go to d3 */
+  instance->PC = instance->CY ? 0x4d2 : 0x4d3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4d2(hp45inst_t *instance)
+{
+  /* 4d2: then go to 9f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x4d3 : 0x49f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4d3(hp45inst_t *instance)
+{
+  /* 4d3: jsb 60 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xd4;
+  instance->PC = 0x460;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4d4(hp45inst_t *instance)
+{
+  /* 4d4: then go to 15 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x4d5 : 0x415;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_4d5(hp45inst_t *instance)
+{
+  /* 4d5: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 4d6: nop */
+  instance->CY = 0;
+  /* 4d7: nop */
+  instance->CY = 0;
+  /* 4d8: nop */
+  instance->CY = 0;
+  /* 4d9: nop */
+  instance->CY = 0;
+  /* 4da: nop */
+  instance->CY = 0;
+  /* 4db: nop */
+  instance->CY = 0;
+  /* 4dc: nop */
+  instance->CY = 0;
+  /* 4dd: nop */
+  instance->CY = 0;
+  /* 4de: nop */
+  instance->CY = 0;
+  /* 4df: nop */
+  instance->CY = 0;
+  /* 4e0: nop */
+  instance->CY = 0;
+  /* 4e1: nop */
+  instance->CY = 0;
+  /* 4e2: nop */
+  instance->CY = 0;
+  /* 4e3: nop */
+  instance->CY = 0;
+  /* 4e4: nop */
+  instance->CY = 0;
+  /* 4e5: nop */
+  instance->CY = 0;
+  /* 4e6: nop */
+  instance->CY = 0;
+  /* 4e7: nop */
+  instance->CY = 0;
+  /* 4e8: nop */
+  instance->CY = 0;
+  /* 4e9: nop */
+  instance->CY = 0;
+  /* 4ea: nop */
+  instance->CY = 0;
+  /* 4eb: nop */
+  instance->CY = 0;
+  /* 4ec: nop */
+  instance->CY = 0;
+  /* 4ed: nop */
+  instance->CY = 0;
+  /* 4ee: nop */
+  instance->CY = 0;
+  /* 4ef: nop */
+  instance->CY = 0;
+  /* 4f0: nop */
+  instance->CY = 0;
+  instance->PC = 0x4f1;
+  return 0;
+}
+
+static int block_4f1(hp45inst_t *instance)
+{
+  /* 4f1: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x0f2;
+  return 0;
+}
+
+static int block_4f5(hp45inst_t *instance)
+{
+  /* 4f5: rom 5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x5f6;
+  return 0;
+}
+
+static int block_4fe(hp45inst_t *instance)
+{
+  /* 4fe: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x400 | instance->LR;
+  return 0;
+}
+
+static int block_4ff(hp45inst_t *instance)
+{
+  /* 4ff: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x600;
+  return 0;
+}
+
+static int block_500(hp45inst_t *instance)
+{
+  /* 500: rom 6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x601;
+  return 0;
+}
+
+static int block_501(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 501: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x502;
+  return 0;
+}
+
+static int block_502(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 502: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x503;
+  return 0;
+}
+
+static int block_503(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 503: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  instance->PC = 0x504;
+  return 0;
+}
+
+static int block_504(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 504: C+1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 505: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 506: A-C->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->CX, &instance->CX, FIELD_W);
+  /* 507: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 508: nop */
+  instance->CY = 0;
+  /* 509: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 50a: if s4 = 1 */
+  instance->CY = (instance->S >> 4) & 1;
+  /* 50b: then go to ff */
+  instance->PC = instance->CY ? 0x50c : 0x5ff;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_50c(hp45inst_t *instance)
+{
+  /* 50c: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 50d: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  /* 50e: then go to a7 */
+  instance->PC = instance->CY ? 0x50f : 0x5a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_50f(hp45inst_t *instance)
+{
+  /* 50f: then go to a6 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x510 : 0x5a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_510(hp45inst_t *instance)
+{
+  /* 510: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x311;
+  return 0;
+}
+
+static int block_515(hp45inst_t *instance)
+{
+  /* 515: then go to e4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x516 : 0x5e4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_516(hp45inst_t *instance)
+{
+  /* 516: 1 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<4;
+  /* 517: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 518: jsb a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x19;
+  instance->PC = 0x5a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_519(hp45inst_t *instance)
+{
+  /* 519: jsb 02 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x1a;
+  instance->PC = 0x502;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_51a(hp45inst_t *instance)
+{
+  /* 51a: jsb bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x1b;
+  instance->PC = 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_51b(hp45inst_t *instance)
+{
+  /* 51b: jsb 2d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x1c;
+  instance->PC = 0x52d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_51c(hp45inst_t *instance)
+{
+  /* 51c: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 51d: jsb 03 */
+  instance->LR = 0x1e;
+  instance->PC = 0x503;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_51e(hp45inst_t *instance)
+{
+  /* 51e: then go to 23 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x51f : 0x523;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_51f(hp45inst_t *instance)
+{
+  /* 51f: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 520: nop */
+  instance->CY = 0;
+  /* 521: nop */
+  instance->CY = 0;
+  instance->PC = 0x522;
+  return 0;
+}
+
+static int block_522(hp45inst_t *instance)
+{
+  /* 522: then go to 42 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x523 : 0x542;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_523(hp45inst_t *instance)
+{
+  /* 523: jsb bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x24;
+  instance->PC = 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_524(hp45inst_t *instance)
+{
+  /* 524: jsb 32 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x25;
+  instance->PC = 0x532;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_525(hp45inst_t *instance)
+{
+  /* 525: jsb 04 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x26;
+  instance->PC = 0x504;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_526(hp45inst_t *instance)
+{
+  /* 526: jsb bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x27;
+  instance->PC = 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_527(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 527: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 528: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 529: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 52a: jsb 01 */
+  instance->LR = 0x2b;
+  instance->PC = 0x501;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_52b(hp45inst_t *instance)
+{
+  /* 52b: jsb bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x2c;
+  instance->PC = 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_52c(hp45inst_t *instance)
+{
+  /* 52c: then go to 10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x52d : 0x510;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_52d(hp45inst_t *instance)
+{
+  /* 52d: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 52e: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 52f: nop */
+  instance->CY = 0;
+  /* 530: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 531: return */
+  instance->CY = 0;
+  instance->PC = 0x500 | instance->LR;
+  return 0;
+}
+
+static int block_532(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 532: down rotate */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp.r, sizeof(reg_t));
+  /* 533: c -> stack */
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 534: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 535: return */
+  instance->CY = 0;
+  instance->PC = 0x500 | instance->LR;
+  return 0;
+}
+
+static int block_536(hp45inst_t *instance)
+{
+  /* 536: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 537: 0 -> s9 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<9);
+  /* 538: jsb a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x39;
+  instance->PC = 0x5a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_539(hp45inst_t *instance)
+{
+  /* 539: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 53a: nop */
+  instance->CY = 0;
+  /* 53b: nop */
+  instance->CY = 0;
+  /* 53c: nop */
+  instance->CY = 0;
+  /* 53d: nop */
+  instance->CY = 0;
+  /* 53e: nop */
+  instance->CY = 0;
+  /* 53f: nop */
+  instance->CY = 0;
+  /* 540: nop */
+  instance->CY = 0;
+  instance->PC = 0x541;
+  return 0;
+}
+
+static int block_541(hp45inst_t *instance)
+{
+  /* 541: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x342;
+  return 0;
+}
+
+static int block_542(hp45inst_t *instance)
+{
+  /* 542: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 543: 0 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<4);
+  /* 544: jsb 03 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x45;
+  instance->PC = 0x503;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_545(hp45inst_t *instance)
+{
+  /* 545: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 546: jsb a4 */
+  instance->LR = 0x47;
+  instance->PC = 0x5a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_547(hp45inst_t *instance)
+{
+  /* 547: jsb 01 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x48;
+  instance->PC = 0x501;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_548(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 548: C-1 [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->CX, &temp.r, FIELD_S);
+  /* 549: then go to 00 */
+  instance->PC = instance->CY ? 0x54a : 0x500;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_54a(hp45inst_t *instance)
+{
+  /* 54a: jsb a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4b;
+  instance->PC = 0x5a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_54b(hp45inst_t *instance)
+{
+  /* 54b: jsb 02 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x4c;
+  instance->PC = 0x502;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_54c(hp45inst_t *instance)
+{
+  /* 54c: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 54d: jsb a6 */
+  instance->LR = 0x4e;
+  instance->PC = 0x5a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_54e(hp45inst_t *instance)
+{
+  /* 54e: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 54f: jsb 01 */
+  instance->LR = 0x50;
+  instance->PC = 0x501;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_550(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 550: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 551: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 552: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 553: jsb a6 */
+  instance->LR = 0x54;
+  instance->PC = 0x5a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_554(hp45inst_t *instance)
+{
+  /* 554: stack -> a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  /* 555: jsb a5 */
+  instance->LR = 0x56;
+  instance->PC = 0x5a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_556(hp45inst_t *instance)
+{
+  /* 556: jsb 41 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x57;
+  instance->PC = 0x541;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_557(hp45inst_t *instance)
+{
+  /* 557: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 558: jsb 03 */
+  instance->LR = 0x59;
+  instance->PC = 0x503;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_559(hp45inst_t *instance)
+{
+  /* 559: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 55a: jsb 01 */
+  instance->LR = 0x5b;
+  instance->PC = 0x501;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_55b(hp45inst_t *instance)
+{
+  /* 55b: jsb a1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x5c;
+  instance->PC = 0x5a1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_55c(hp45inst_t *instance)
+{
+  /* 55c: 0 -> s4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<4);
+  /* 55d: if s7 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 7) & 1;
+  /* 55e: then go to 60 */
+  instance->PC = instance->CY ? 0x55f : 0x560;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_55f(hp45inst_t *instance)
+{
+  /* 55f: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  instance->PC = 0x560;
+  return 0;
+}
+
+static int block_560(hp45inst_t *instance)
+{
+  /* 560: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 561: jsb 04 */
+  instance->LR = 0x62;
+  instance->PC = 0x504;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_562(hp45inst_t *instance)
+{
+  /* 562: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 563: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 564: jsb 03 */
+  instance->LR = 0x65;
+  instance->PC = 0x503;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_565(hp45inst_t *instance)
+{
+  /* 565: then go to 7e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x566 : 0x57e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_566(hp45inst_t *instance)
+{
+  /* 566: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 567: nop */
+  instance->CY = 0;
+  /* 568: nop */
+  instance->CY = 0;
+  /* 569: nop */
+  instance->CY = 0;
+  /* 56a: nop */
+  instance->CY = 0;
+  /* 56b: nop */
+  instance->CY = 0;
+  /* 56c: nop */
+  instance->CY = 0;
+  /* 56d: nop */
+  instance->CY = 0;
+  /* 56e: nop */
+  instance->CY = 0;
+  /* 56f: nop */
+  instance->CY = 0;
+  /* 570: nop */
+  instance->CY = 0;
+  /* 571: nop */
+  instance->CY = 0;
+  /* 572: nop */
+  instance->CY = 0;
+  /* 573: nop */
+  instance->CY = 0;
+  /* 574: nop */
+  instance->CY = 0;
+  instance->PC = 0x575;
+  return 0;
+}
+
+static int block_575(hp45inst_t *instance)
+{
+  /* 575: jsb bb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x76;
+  instance->PC = 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_576(hp45inst_t *instance)
+{
+  /* 576: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 577: rom 3 */
+  instance->CY = 0;
+  instance->PC = 0x378;
+  return 0;
+}
+
+static int block_57b(hp45inst_t *instance)
+{
+  /* 57b: jsb dc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x7c;
+  instance->PC = 0x5dc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_57c(hp45inst_t *instance)
+{
+  /* 57c: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  /* 57d: then go to 75 */
+  instance->PC = instance->CY ? 0x57e : 0x575;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_57e(hp45inst_t *instance)
+{
+  /* 57e: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_5a0(hp45inst_t *instance)
+{
+  /* 5a0: then go to 5c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5a1 : 0x55c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5a1(hp45inst_t *instance)
+{
+  /* 5a1: 0 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<3);
+  /* 5a2: then go to a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5a3 : 0x5a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5a3(hp45inst_t *instance)
+{
+  /* 5a3: 0 -> s3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<3);
+  instance->PC = 0x5a4;
+  return 0;
+}
+
+static int block_5a4(hp45inst_t *instance)
+{
+  /* 5a4: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a5;
+  return 0;
+}
+
+static int block_5a5(hp45inst_t *instance)
+{
+  /* 5a5: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x1a6;
+  return 0;
+}
+
+static int block_5a6(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5a6: 0-C-1->C [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_S);
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->CY = 1;
+  instance->PC = 0x5a7;
+  return 0;
+}
+
+static int block_5a7(hp45inst_t *instance)
+{
+  /* 5a7: rom 0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x0a8;
+  return 0;
+}
+
+static int block_5b0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5b0: 0->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 5b1: C-1->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_WP(instance->P));
+  /* 5b2: 0->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->CX, &zero, FIELD_XS);
+  /* 5b3: rom 2 */
+  instance->CY = 0;
+  instance->PC = 0x2b4;
+  return 0;
+}
+
+static int block_5b4(hp45inst_t *instance)
+{
+  /* 5b4: then go to b0 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5b5 : 0x5b0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5b5(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5b5: 0->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 5b6: C-1->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_WP(instance->P));
+  /* 5b7: 0->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->CX, &zero, FIELD_XS);
+  /* 5b8: A+B->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_X);
+  /* 5b9: then go to bb */
+  instance->PC = instance->CY ? 0x5ba : 0x5bb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5ba(hp45inst_t *instance)
+{
+  /* 5ba: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  instance->PC = 0x5bb;
+  return 0;
+}
+
+static int block_5bb(hp45inst_t *instance)
+{
+  /* 5bb: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 5bc: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 5bd: A->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &instance->A, FIELD_X);
+  /* 5be: C->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &instance->CX, FIELD_X);
+  /* 5bf: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 5c0: then go to c4 */
+  instance->PC = instance->CY ? 0x5c1 : 0x5c4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5c1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5c1: 0-C->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_X);
+  /* 5c2: C-1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 5c3: then go to b5 */
+  instance->PC = instance->CY ? 0x5c4 : 0x5b5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5c4(hp45inst_t *instance)
+{
+  /* 5c4: C<->A [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  exch(&instance->A, &instance->CX, FIELD_MS);
+  /* 5c5: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 5c6: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 5c7: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 5c8: return */
+  instance->CY = 0;
+  instance->PC = 0x500 | instance->LR;
+  return 0;
+}
+
+static int block_5dc(hp45inst_t *instance)
+{
+  /* 5dc: if s4 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 4) & 1;
+  /* 5dd: then go to e1 */
+  instance->PC = instance->CY ? 0x5de : 0x5e1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5de(hp45inst_t *instance)
+{
+  /* 5de: if s6 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 6) & 1;
+  /* 5df: then go to a6 */
+  instance->PC = instance->CY ? 0x5e0 : 0x5a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5e0(hp45inst_t *instance)
+{
+  /* 5e0: then go to a7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5e1 : 0x5a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5e1(hp45inst_t *instance)
+{
+  /* 5e1: if s6 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 6) & 1;
+  /* 5e2: then go to a5 */
+  instance->PC = instance->CY ? 0x5e3 : 0x5a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5e3(hp45inst_t *instance)
+{
+  /* 5e3: then go to a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5e4 : 0x5a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5e4(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5e4: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 5e5: C-1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  /* 5e6: 2 -> p */
+  instance->CY = 0;
+  instance->P = 2;
+  /* 5e7: 2 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 5e8: c <-> m */
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 5e9: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  instance->PC = 0x5ea;
+  return 0;
+}
+
+static int block_5ea(hp45inst_t *instance)
+{
+  /* 5ea: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 5eb: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  instance->PC = 0x5ec;
+  return 0;
+}
+
+static int block_5ec(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 5ec: C-1->C [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 5ed: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 5ee: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 5ef: c -> stack */
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  /* 5f0: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 5f1: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 5f2: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 5f3: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 5f4: then go to ec */
+  instance->PC = instance->CY ? 0x5f5 : 0x5ec;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5f5(hp45inst_t *instance)
+{
+  /* 5f5: then go to 7e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x5f6 : 0x57e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5f6(hp45inst_t *instance)
+{
+  /* 5f6: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 5f7: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 5f8: then go to ea */
+  instance->PC = instance->CY ? 0x5f9 : 0x5ea;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_5f9(hp45inst_t *instance)
+{
+  /* 5f9: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 5fa: nop */
+  instance->CY = 0;
+  /* 5fb: nop */
+  instance->CY = 0;
+  /* 5fc: nop */
+  instance->CY = 0;
+  /* 5fd: nop */
+  instance->CY = 0;
+  /* 5fe: nop */
+  instance->CY = 0;
+  instance->PC = 0x5ff;
+  return 0;
+}
+
+static int block_5ff(hp45inst_t *instance)
+{
+  /* 5ff: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x500 | instance->LR;
+  return 0;
+}
+
+static int block_600(hp45inst_t *instance)
+{
+  /* 600: then go to bc */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x601 : 0x6bc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_601(hp45inst_t *instance)
+{
+  /* 601: then go to 07 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x602 : 0x607;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_602(hp45inst_t *instance)
+{
+  /* 602: clear status */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S = 0;
+  /* 603: then go to 7f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x604 : 0x67f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_604(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 604: C+1->C [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  /* 605: jsb 7e */
+  instance->LR = 0x06;
+  instance->PC = 0x67e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_606(hp45inst_t *instance)
+{
+  /* 606: jsb f4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x07;
+  instance->PC = 0x6f4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_607(hp45inst_t *instance)
+{
+  /* 607: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 608: clear status */
+  instance->CY = 0;
+  instance->S = 0;
+  /* 609: 1 -> s5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<5;
+  instance->PC = 0x60a;
+  return 0;
+}
+
+static int block_60a(hp45inst_t *instance)
+{
+  /* 60a: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 60b: m -> c */
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  /* 60c: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 60d: then go to 19 */
+  instance->PC = instance->CY ? 0x60e : 0x619;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_60e(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 60e: shift A right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 60f: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 610: then go to 0e */
+  instance->PC = instance->CY ? 0x611 : 0x60e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_611(hp45inst_t *instance)
+{
+  /* 611: 13 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 13;
+  instance->PC = 0x612;
+  return 0;
+}
+
+static int block_612(hp45inst_t *instance)
+{
+  /* 612: A<->B [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  exch(&instance->A, &instance->B, FIELD_XS);
+  /* 613: A->B [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->B, &instance->A, FIELD_XS);
+  instance->PC = 0x614;
+  return 0;
+}
+
+static int block_614(hp45inst_t *instance)
+{
+  /* 614: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 615: if p # 2 */
+  instance->CY = (instance->P == 2);
+  /* 616: then go to 2d */
+  instance->PC = instance->CY ? 0x617 : 0x62d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_617(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 617: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 618: A-1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  instance->PC = 0x619;
+  return 0;
+}
+
+static int block_619(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 619: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  /* 61a: 1 -> s8 */
+  instance->CY = 0;
+  instance->S |= 1<<8;
+  /* 61b: 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 1;
+  /* 61c: A->B [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  mov(&instance->B, &instance->A, FIELD_XS);
+  /* 61d: C->A [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  mov(&instance->A, &instance->CX, FIELD_M);
+  /* 61e: shift A left [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  /* 61f: A-1 [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->A, &temp.r, FIELD_P(instance->P));
+  /* 620: then go to 11 */
+  instance->PC = instance->CY ? 0x621 : 0x611;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_621(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 621: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 622: 14 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 14;
+  /* 623: C->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &instance->CX, FIELD_X);
+  /* 624: C-1 [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  ifge(instance, &instance->CX, &temp.r, FIELD_XS);
+  /* 625: then go to 0e */
+  instance->PC = instance->CY ? 0x626 : 0x60e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_626(hp45inst_t *instance)
+{
+  /* 626: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 627: if p # 2 */
+  instance->CY = (instance->P == 2);
+  /* 628: then go to 2a */
+  instance->PC = instance->CY ? 0x629 : 0x62a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_629(hp45inst_t *instance)
+{
+  /* 629: then go to 17 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x62a : 0x617;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_62a(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 62a: A-1->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 62b: then go to 26 */
+  instance->PC = instance->CY ? 0x62c : 0x626;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_62c(hp45inst_t *instance)
+{
+  /* 62c: then go to 12 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x62d : 0x612;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_62d(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 62d: A-1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 62e: then go to 14 */
+  instance->PC = instance->CY ? 0x62f : 0x614;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_62f(hp45inst_t *instance)
+{
+  /* 62f: A->B [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  mov(&instance->B, &instance->A, FIELD_P(instance->P));
+  /* 630: p - 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 631: 0->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->A, &zero, FIELD_WP(instance->P));
+  /* 632: C->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &instance->CX, FIELD_X);
+  /* 633: A+B->A [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 634: then go to 3a */
+  instance->PC = instance->CY ? 0x635 : 0x63a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_635(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 635: shift A right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 636: A+1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 637: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 638: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  /* 639: then go to 3b */
+  instance->PC = instance->CY ? 0x63a : 0x63b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_63a(hp45inst_t *instance)
+{
+  /* 63a: p + 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  instance->PC = 0x63b;
+  return 0;
+}
+
+static int block_63b(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 63b: shift A right [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 63c: 0->B [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  mov(&instance->B, &zero, FIELD_MS);
+  /* 63d: A-1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 63e: A-1 [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  ifge(instance, &instance->A, &temp.r, FIELD_XS);
+  /* 63f: then go to 41 */
+  instance->PC = instance->CY ? 0x640 : 0x641;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_640(hp45inst_t *instance)
+{
+  /* 640: then go to 17 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x641 : 0x617;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_641(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 641: A+1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 642: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 643: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 644: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  instance->PC = 0x645;
+  return 0;
+}
+
+static int block_645(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 645: shift A left [ms] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  /* 646: A-1->A [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 647: then go to 45 */
+  instance->PC = instance->CY ? 0x648 : 0x645;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_648(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 648: 0->A [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->A, &zero, FIELD_WP(instance->P));
+  /* 649: A-1->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_WP(instance->P));
+  /* 64a: shift A right [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 0, FIELD_MS);
+  /* 64b: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 64c: if s8 = 1 */
+  instance->CY = (instance->S >> 8) & 1;
+  /* 64d: then go to 55 */
+  instance->PC = instance->CY ? 0x64e : 0x655;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_64e(hp45inst_t *instance)
+{
+  /* 64e: C<->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  /* 64f: 0->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &zero, FIELD_X);
+  /* 650: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 651: then go to 54 */
+  instance->PC = instance->CY ? 0x652 : 0x654;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_652(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 652: 0-C->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_X);
+  /* 653: C-1->C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_XS);
+  instance->PC = 0x654;
+  return 0;
+}
+
+static int block_654(hp45inst_t *instance)
+{
+  /* 654: C<->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  instance->PC = 0x655;
+  return 0;
+}
+
+static int block_655(hp45inst_t *instance)
+{
+  /* 655: if s5 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 5) & 1;
+  /* 656: then go to fe */
+  instance->PC = instance->CY ? 0x657 : 0x6fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_657(hp45inst_t *instance)
+{
+  /* 657: then go to 80 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x658 : 0x680;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_658(hp45inst_t *instance)
+{
+  /* 658: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 659: nop */
+  instance->CY = 0;
+  /* 65a: nop */
+  instance->CY = 0;
+  /* 65b: nop */
+  instance->CY = 0;
+  /* 65c: nop */
+  instance->CY = 0;
+  /* 65d: nop */
+  instance->CY = 0;
+  /* 65e: nop */
+  instance->CY = 0;
+  /* 65f: nop */
+  instance->CY = 0;
+  /* 660: nop */
+  instance->CY = 0;
+  /* 661: nop */
+  instance->CY = 0;
+  /* 662: nop */
+  instance->CY = 0;
+  instance->PC = 0x663;
+  return 0;
+}
+
+static int block_663(hp45inst_t *instance)
+{
+  /* 663: then go to b4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x664 : 0x6b4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_664(hp45inst_t *instance)
+{
+  /* 664: then go to a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x665 : 0x6a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_665(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 665: C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 666: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 667: C-1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 668: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 669: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 66a: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 66b: then go to fb */
+  instance->PC = instance->CY ? 0x66c : 0x6fb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_66c(hp45inst_t *instance)
+{
+  /* 66c: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 66d: nop */
+  instance->CY = 0;
+  /* 66e: nop */
+  instance->CY = 0;
+  /* 66f: nop */
+  instance->CY = 0;
+  /* 670: nop */
+  instance->CY = 0;
+  /* 671: nop */
+  instance->CY = 0;
+  instance->PC = 0x672;
+  return 0;
+}
+
+static int block_672(hp45inst_t *instance)
+{
+  /* 672: then go to 81 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x673 : 0x681;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_673(hp45inst_t *instance)
+{
+  /* 673: jsb 76 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x74;
+  instance->PC = 0x676;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_674(hp45inst_t *instance)
+{
+  /* 674: clear status */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S = 0;
+  /* 675: rom 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x176;
+  return 0;
+}
+
+static int block_676(hp45inst_t *instance)
+{
+  /* 676: if s7 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 7) & 1;
+  /* 677: then go to 79 */
+  instance->PC = instance->CY ? 0x678 : 0x679;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_678(hp45inst_t *instance)
+{
+  /* 678: c -> stack */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  instance->PC = 0x679;
+  return 0;
+}
+
+static int block_679(hp45inst_t *instance)
+{
+  /* 679: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 67a: return */
+  instance->CY = 0;
+  instance->PC = 0x600 | instance->LR;
+  return 0;
+}
+
+static int block_67c(hp45inst_t *instance)
+{
+  /* 67c: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 67d: jsb 64 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x7e;
+  instance->PC = 0x664;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_67e(hp45inst_t *instance)
+{
+  /* 67e: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_67f(hp45inst_t *instance)
+{
+  /* 67f: jsb 19 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x80;
+  instance->PC = 0x619;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_680(hp45inst_t *instance)
+{
+  /* 680: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x381;
+  return 0;
+}
+
+static int block_681(hp45inst_t *instance)
+{
+  /* 681: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 682: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 683: jsb 76 */
+  instance->LR = 0x84;
+  instance->PC = 0x676;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_684(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 684: A-1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 685: then go to 87 */
+  instance->PC = instance->CY ? 0x686 : 0x687;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_686(hp45inst_t *instance)
+{
+  /* 686: then go to 7c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x687 : 0x67c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_687(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 687: A-1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 688: then go to 8d */
+  instance->PC = instance->CY ? 0x689 : 0x68d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_689(hp45inst_t *instance)
+{
+  /* 689: 2 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 68a: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 68b: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 68c: then go to 7e */
+  instance->PC = instance->CY ? 0x68d : 0x67e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_68d(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 68d: A-1->A [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_XS);
+  /* 68e: then go to 99 */
+  instance->PC = instance->CY ? 0x68f : 0x699;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_68f(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 68f: 4 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 690: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 691: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 692: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 693: 9 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 694: 2 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 695: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 696: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 697: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 698: jsb 7e */
+  instance->LR = 0x99;
+  instance->PC = 0x67e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_699(hp45inst_t *instance)
+{
+  /* 699: 3 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69a: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69b: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69c: 5 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69d: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69e: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 69f: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6a0: 7 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6a1: 8 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6a2: 4 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6a3: then go to 7e */
+  instance->PC = instance->CY ? 0x6a4 : 0x67e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6a4(hp45inst_t *instance)
+{
+  /* 6a4: 0 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 0;
+  instance->PC = 0x6a5;
+  return 0;
+}
+
+static int block_6a5(hp45inst_t *instance)
+{
+  /* 6a5: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 6a6: p + 1 -> p */
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  /* 6a7: if p # 12 */
+  instance->CY = (instance->P == 12);
+  /* 6a8: then go to a5 */
+  instance->PC = instance->CY ? 0x6a9 : 0x6a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6a9(hp45inst_t *instance)
+{
+  /* 6a9: 0->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  mov(&instance->A, &zero, FIELD_S);
+  /* 6aa: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6ab: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 6ac: 0 -> s2 */
+  instance->CY = 0;
+  instance->S &= ~(1<<2);
+  /* 6ad: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 6ae: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6af: 0 -> s11 */
+  instance->CY = 0;
+  instance->S &= ~(1<<11);
+  /* 6b0: 0->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  /* 6b1: if s1 = 1 */
+  instance->CY = (instance->S >> 1) & 1;
+  /* 6b2: then go to fb */
+  instance->PC = instance->CY ? 0x6b3 : 0x6fb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6b3(hp45inst_t *instance)
+{
+  /* 6b3: then go to 65 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x6b4 : 0x665;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6b4(hp45inst_t *instance)
+{
+  /* 6b4: A->B [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &instance->A, FIELD_W);
+  /* 6b5: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6b6: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 6b7: c -> data address */
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 6b8: B->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &instance->B, FIELD_W);
+  /* 6b9: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6ba: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 6bb: then go to 64 */
+  instance->PC = instance->CY ? 0x6bc : 0x664;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6bc(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6bc: C-1 [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->CX, &temp.r, FIELD_S);
+  /* 6bd: then go to 07 */
+  instance->PC = instance->CY ? 0x6be : 0x607;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6be(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6be: C-1 [xs] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 6;
+  set1(&temp.r, FIELD_XS);
+  ifge(instance, &instance->CX, &temp.r, FIELD_XS);
+  /* 6bf: then go to 07 */
+  instance->PC = instance->CY ? 0x6c0 : 0x607;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6c0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6c0: C-1 [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  ifge(instance, &instance->CX, &temp.r, FIELD_X);
+  /* 6c1: then go to c4 */
+  instance->PC = instance->CY ? 0x6c2 : 0x6c4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6c2(hp45inst_t *instance)
+{
+  /* 6c2: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6c3: then go to cb */
+  instance->PC = instance->CY ? 0x6c4 : 0x6cb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6c4(hp45inst_t *instance)
+{
+  /* 6c4: p - 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 6c5: if p # 3 */
+  instance->CY = (instance->P == 3);
+  /* 6c6: then go to c8 */
+  instance->PC = instance->CY ? 0x6c7 : 0x6c8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6c7(hp45inst_t *instance)
+{
+  /* 6c7: then go to 04 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x6c8 : 0x604;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6c8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6c8: C-1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 6c9: jsb c0 */
+  instance->LR = 0xca;
+  instance->PC = 0x6c0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6ca(hp45inst_t *instance)
+{
+  /* 6ca: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2cb;
+  return 0;
+}
+
+static int block_6cb(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6cb: C-1 [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  ifge(instance, &instance->CX, &temp.r, FIELD_WP(instance->P));
+  /* 6cc: then go to 07 */
+  instance->PC = instance->CY ? 0x6cd : 0x607;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6cd(hp45inst_t *instance)
+{
+  /* 6cd: C<->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->CX, FIELD_X);
+  /* 6ce: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 6cf: 0-C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  ifeq0(instance, &instance->CX, FIELD_X);
+  /* 6d0: then go to d5 */
+  instance->PC = instance->CY ? 0x6d1 : 0x6d5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6d1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6d1: C-1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 6d2: C-1 [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  ifge(instance, &instance->CX, &temp.r, FIELD_X);
+  /* 6d3: then go to 04 */
+  instance->PC = instance->CY ? 0x6d4 : 0x604;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6d4(hp45inst_t *instance)
+{
+  /* 6d4: shift A left [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  instance->PC = 0x6d5;
+  return 0;
+}
+
+static int block_6d5(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6d5: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6d6: 0->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 6d7: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 6d8: 0-C->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &zero, &instance->CX, &instance->CX, FIELD_W);
+  /* 6d9: then go to ca */
+  instance->PC = instance->CY ? 0x6da : 0x6ca;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6da(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6da: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6db: shift C right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->CX, 0, FIELD_W);
+  /* 6dc: C+1->C [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_S);
+  instance->PC = 0x6dd;
+  return 0;
+}
+
+static int block_6dd(hp45inst_t *instance)
+{
+  /* 6dd: 12 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 12;
+  /* 6de: A->B [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  mov(&instance->B, &instance->A, FIELD_MS);
+  instance->PC = 0x6df;
+  return 0;
+}
+
+static int block_6df(hp45inst_t *instance)
+{
+  /* 6df: A+C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->CX, &instance->A, FIELD_W);
+  /* 6e0: then go to df */
+  instance->PC = instance->CY ? 0x6e1 : 0x6df;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6e1(hp45inst_t *instance)
+{
+  /* 6e1: A-C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  sub(instance, &instance->A, &instance->CX, &instance->A, FIELD_W);
+  /* 6e2: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  instance->PC = 0x6e3;
+  return 0;
+}
+
+static int block_6e3(hp45inst_t *instance)
+{
+  /* 6e3: A+C->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  add(instance, &instance->A, &instance->CX, &instance->A, FIELD_W);
+  /* 6e4: then go to e3 */
+  instance->PC = instance->CY ? 0x6e5 : 0x6e3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6e5(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6e5: A+1->A [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 6e6: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 6e7: jsb f6 */
+  instance->LR = 0xe8;
+  instance->PC = 0x6f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6e8(hp45inst_t *instance)
+{
+  /* 6e8: 11 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 11;
+  /* 6e9: jsb f6 */
+  instance->LR = 0xea;
+  instance->PC = 0x6f6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6ea(hp45inst_t *instance)
+{
+  /* 6ea: B->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &instance->B, FIELD_W);
+  /* 6eb: 0->B [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->B, &zero, FIELD_WP(instance->P));
+  /* 6ec: shift B right [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->B, 0, FIELD_W);
+  /* 6ed: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 6ee: A+B->A [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  add(instance, &instance->A, &instance->B, &instance->A, FIELD_MS);
+  /* 6ef: then go to dd */
+  instance->PC = instance->CY ? 0x6f0 : 0x6dd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6f0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6f0: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 6f1: B<->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->B, &instance->CX, FIELD_X);
+  /* 6f2: C+1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 6f3: jsb ca */
+  instance->LR = 0xf4;
+  instance->PC = 0x6ca;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6f4(hp45inst_t *instance)
+{
+  /* 6f4: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 6f5: rom 2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x2f6;
+  return 0;
+}
+
+static int block_6f6(hp45inst_t *instance)
+{
+  /* 6f6: 0-B [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  ifeq0(instance, &instance->B, FIELD_P(instance->P));
+  /* 6f7: then go to fa */
+  instance->PC = instance->CY ? 0x6f8 : 0x6fa;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6f8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 6f8: shift B right [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->B, 0, FIELD_WP(instance->P));
+  /* 6f9: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  instance->PC = 0x6fa;
+  return 0;
+}
+
+static int block_6fa(hp45inst_t *instance)
+{
+  /* 6fa: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x600 | instance->LR;
+  return 0;
+}
+
+static int block_6fb(hp45inst_t *instance)
+{
+  /* 6fb: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 6fc: then go to fe */
+  instance->PC = instance->CY ? 0x6fd : 0x6fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_6fd(hp45inst_t *instance)
+{
+  /* 6fd: rom 4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x4fe;
+  return 0;
+}
+
+static int block_6fe(hp45inst_t *instance)
+{
+  /* 6fe: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x3ff;
+  return 0;
+}
+
+static int block_700(hp45inst_t *instance)
+{
+  /* 700: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x701 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_701(hp45inst_t *instance)
+{
+  /* 701: then go to a2 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x702 : 0x7a2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_702(hp45inst_t *instance)
+{
+  /* 702: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x703 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_703(hp45inst_t *instance)
+{
+  /* 703: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x704 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_704(hp45inst_t *instance)
+{
+  /* 704: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x705 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_705(hp45inst_t *instance)
+{
+  /* 705: then go to 0d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x706 : 0x70d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_706(hp45inst_t *instance)
+{
+  /* 706: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x707 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_707(hp45inst_t *instance)
+{
+  /* 707: then go to 11 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x708 : 0x711;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_708(hp45inst_t *instance)
+{
+  /* 708: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x709 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_709(hp45inst_t *instance)
+{
+  /* 709: then go to a7 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70a : 0x7a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70a(hp45inst_t *instance)
+{
+  /* 70a: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70b : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70b(hp45inst_t *instance)
+{
+  /* 70b: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70c : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70c(hp45inst_t *instance)
+{
+  /* 70c: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70d : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70d(hp45inst_t *instance)
+{
+  /* 70d: then go to a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70e : 0x7a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70e(hp45inst_t *instance)
+{
+  /* 70e: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x70f : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_70f(hp45inst_t *instance)
+{
+  /* 70f: 9 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 9);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x710;
+  return 0;
+}
+
+static int block_710(hp45inst_t *instance)
+{
+  /* 710: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x711 : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_711(hp45inst_t *instance)
+{
+  /* 711: then go to a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x712 : 0x7a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_712(hp45inst_t *instance)
+{
+  /* 712: then go to 30 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x713 : 0x730;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_713(hp45inst_t *instance)
+{
+  /* 713: then go to 1f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x714 : 0x71f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_714(hp45inst_t *instance)
+{
+  /* 714: 4 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x715;
+  return 0;
+}
+
+static int block_715(hp45inst_t *instance)
+{
+  /* 715: then go to 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x716 : 0x77d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_716(hp45inst_t *instance)
+{
+  /* 716: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x717 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_717(hp45inst_t *instance)
+{
+  /* 717: 8 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 8);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x718;
+  return 0;
+}
+
+static int block_718(hp45inst_t *instance)
+{
+  /* 718: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x719 : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_719(hp45inst_t *instance)
+{
+  /* 719: then go to a8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x71a : 0x7a8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_71a(hp45inst_t *instance)
+{
+  /* 71a: then go to 7a */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x71b : 0x77a;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_71b(hp45inst_t *instance)
+{
+  /* 71b: then go to 7c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x71c : 0x77c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_71c(hp45inst_t *instance)
+{
+  /* 71c: 1 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x71d;
+  return 0;
+}
+
+static int block_71d(hp45inst_t *instance)
+{
+  /* 71d: then go to 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x71e : 0x77d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_71e(hp45inst_t *instance)
+{
+  /* 71e: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x71f : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_71f(hp45inst_t *instance)
+{
+  /* 71f: 5 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 5);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x720;
+  return 0;
+}
+
+static int block_720(hp45inst_t *instance)
+{
+  /* 720: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x721 : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_721(hp45inst_t *instance)
+{
+  /* 721: then go to 27 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x722 : 0x727;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_722(hp45inst_t *instance)
+{
+  /* 722: then go to 90 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x723 : 0x790;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_723(hp45inst_t *instance)
+{
+  /* 723: then go to d1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x724 : 0x7d1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_724(hp45inst_t *instance)
+{
+  /* 724: 0 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 0);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x725;
+  return 0;
+}
+
+static int block_725(hp45inst_t *instance)
+{
+  /* 725: then go to 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x726 : 0x77d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_726(hp45inst_t *instance)
+{
+  /* 726: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x727 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_727(hp45inst_t *instance)
+{
+  /* 727: then go to 09 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x728 : 0x709;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_728(hp45inst_t *instance)
+{
+  /* 728: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x729 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_729(hp45inst_t *instance)
+{
+  /* 729: then go to 2d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72a : 0x72d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72a(hp45inst_t *instance)
+{
+  /* 72a: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72b : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72b(hp45inst_t *instance)
+{
+  /* 72b: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72c : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72c(hp45inst_t *instance)
+{
+  /* 72c: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72d : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72d(hp45inst_t *instance)
+{
+  /* 72d: then go to 2f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72e : 0x72f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72e(hp45inst_t *instance)
+{
+  /* 72e: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x72f : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_72f(hp45inst_t *instance)
+{
+  /* 72f: then go to 37 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x730 : 0x737;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_730(hp45inst_t *instance)
+{
+  /* 730: 6 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x731;
+  return 0;
+}
+
+static int block_731(hp45inst_t *instance)
+{
+  /* 731: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x732 : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_732(hp45inst_t *instance)
+{
+  /* 732: then go to 0f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x733 : 0x70f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_733(hp45inst_t *instance)
+{
+  /* 733: then go to 17 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x734 : 0x717;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_734(hp45inst_t *instance)
+{
+  /* 734: 7 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 7);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x735;
+  return 0;
+}
+
+static int block_735(hp45inst_t *instance)
+{
+  /* 735: then go to 7d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x736 : 0x77d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_736(hp45inst_t *instance)
+{
+  /* 736: then go to 05 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x737 : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_737(hp45inst_t *instance)
+{
+  /* 737: then go to fd */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x738 : 0x7fd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_738(hp45inst_t *instance)
+{
+  /* 738: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  instance->PC = 0x739;
+  return 0;
+}
+
+static int block_739(hp45inst_t *instance)
+{
+  /* 739: jsb 0d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0x3a;
+  instance->PC = 0x70d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_73a(hp45inst_t *instance)
+{
+  /* 73a: then go to 74 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x73b : 0x774;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_73b(hp45inst_t *instance)
+{
+  /* 73b: then go to 8e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x73c : 0x78e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_73c(hp45inst_t *instance)
+{
+  /* 73c: then go to 72 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x73d : 0x772;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_73d(hp45inst_t *instance)
+{
+  /* 73d: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x33e;
+  return 0;
+}
+
+static int block_73e(hp45inst_t *instance)
+{
+  /* 73e: if s9 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 9) & 1;
+  instance->PC = 0x73f;
+  return 0;
+}
+
+static int block_73f(hp45inst_t *instance)
+{
+  /* 73f: then go to 3d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x740 : 0x73d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_740(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 740: clear status */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S = 0;
+  /* 741: C-1 [s] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  ifge(instance, &instance->CX, &temp.r, FIELD_S);
+  /* 742: then go to fe */
+  instance->PC = instance->CY ? 0x743 : 0x7fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_743(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 743: C-1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 744: C-1->C [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 745: 0-C [xs] */
+  instance->CY = 0;
+  instance->ws = 6;
+  ifeq0(instance, &instance->CX, FIELD_XS);
+  /* 746: then go to fe */
+  instance->PC = instance->CY ? 0x747 : 0x7fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_747(hp45inst_t *instance)
+{
+  /* 747: then go to 49 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x748 : 0x749;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_748(hp45inst_t *instance)
+{
+  /* 748: shift C right [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  shift(&instance->CX, 0, FIELD_M);
+  instance->PC = 0x749;
+  return 0;
+}
+
+static int block_749(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 749: C+1->C [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_X);
+  /* 74a: then go to 48 */
+  instance->PC = instance->CY ? 0x74b : 0x748;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_74b(hp45inst_t *instance)
+{
+  /* 74b: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 74c: m -> c */
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  /* 74d: 1 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 1);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 74e: 3 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 74f: A-C [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  ifge(instance, &instance->A, &instance->CX, FIELD_M);
+  /* 750: then go to fe */
+  instance->PC = instance->CY ? 0x751 : 0x7fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_751(hp45inst_t *instance)
+{
+  /* 751: 6 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 752: 10 -> p */
+  instance->CY = 0;
+  instance->P = 10;
+  /* 753: A-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifge(instance, &instance->A, &instance->CX, FIELD_P(instance->P));
+  /* 754: then go to fe */
+  instance->PC = instance->CY ? 0x755 : 0x7fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_755(hp45inst_t *instance)
+{
+  /* 755: 8 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 8;
+  /* 756: shift A right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 757: 7 -> p */
+  instance->CY = 0;
+  instance->P = 7;
+  /* 758: 6 -> c[p] */
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 759: 7 -> p */
+  instance->CY = 0;
+  instance->P = 7;
+  /* 75a: A-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifge(instance, &instance->A, &instance->CX, FIELD_P(instance->P));
+  /* 75b: then go to fe */
+  instance->PC = instance->CY ? 0x75c : 0x7fe;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_75c(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 75c: c <-> m */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 75d: 5 -> p */
+  instance->CY = 0;
+  instance->P = 5;
+  /* 75e: shift A right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 75f: shift A right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 760: shift A right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 761: shift A right [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 0, FIELD_WP(instance->P));
+  /* 762: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  /* 763: A-1->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_WP(instance->P));
+  /* 764: 0->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->A, &zero, FIELD_X);
+  /* 765: 8 -> p */
+  instance->CY = 0;
+  instance->P = 8;
+  /* 766: A-1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 767: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 768: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 769: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 76a: A-1->A [s] */
+  instance->CY = 0;
+  instance->ws = 7;
+  set1(&temp.r, FIELD_S);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_S);
+  /* 76b: A<->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->B, FIELD_W);
+  instance->PC = 0x76c;
+  return 0;
+}
+
+static int block_76c(hp45inst_t *instance)
+{
+  /* 76c: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 76d: then go to 05 */
+  instance->PC = instance->CY ? 0x76e : 0x705;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_76e(hp45inst_t *instance)
+{
+  /* 76e: 1 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<8;
+  /* 76f: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 770: jsb 29 */
+  instance->LR = 0x71;
+  instance->PC = 0x729;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_771(hp45inst_t *instance)
+{
+  /* 771: then go to 0d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x772 : 0x70d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_772(hp45inst_t *instance)
+{
+  /* 772: 1 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S |= 1<<10;
+  /* 773: then go to a4 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x774 : 0x7a4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_774(hp45inst_t *instance)
+{
+  /* 774: 0-B [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  ifeq0(instance, &instance->B, FIELD_X);
+  /* 775: then go to 88 */
+  instance->PC = instance->CY ? 0x776 : 0x788;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_776(hp45inst_t *instance)
+{
+  /* 776: 0->B [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  mov(&instance->B, &zero, FIELD_X);
+  /* 777: then go to 07 */
+  instance->PC = instance->CY ? 0x778 : 0x707;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_778(hp45inst_t *instance)
+{
+  /* 778: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x779;
+  return 0;
+}
+
+static int block_779(hp45inst_t *instance)
+{
+  /* 779: then go to 6c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x77a : 0x76c;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_77a(hp45inst_t *instance)
+{
+  /* 77a: 3 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 3);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 77b: then go to 93 */
+  instance->PC = instance->CY ? 0x77c : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_77c(hp45inst_t *instance)
+{
+  /* 77c: 2 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 2);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x77d;
+  return 0;
+}
+
+static int block_77d(hp45inst_t *instance)
+{
+  /* 77d: then go to 93 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x77e : 0x793;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_77e(hp45inst_t *instance)
+{
+  /* 77e: rom 3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x37f;
+  return 0;
+}
+
+static int block_77f(hp45inst_t *instance)
+{
+  /* 77f: if s0 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 0) & 1;
+  /* 780: then go to 6e */
+  instance->PC = instance->CY ? 0x781 : 0x76e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_781(hp45inst_t *instance)
+{
+  /* 781: if s8 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 8) & 1;
+  /* 782: then go to 79 */
+  instance->PC = instance->CY ? 0x783 : 0x779;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_783(hp45inst_t *instance)
+{
+  /* 783: display off */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x784;
+  if(!instance->DispOn)
+    return 0;
+  instance->DispOn = 0;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int block_784(hp45inst_t *instance)
+{
+  /* 784: 0 -> s8 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<8);
+  /* 785: 12 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 12;
+  /* 786: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 787: keys -> rom address */
+  instance->CY = 0;
+  instance->PC = 0x700 | instance->KeyCode;
+  return HP45_EVENT_KEY;
+}
+
+static int block_788(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 788: A<->B [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->B, FIELD_X);
+  /* 789: A-1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 78a: A<->B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  exch(&instance->A, &instance->B, FIELD_X);
+  /* 78b: then go to a5 */
+  instance->PC = instance->CY ? 0x78c : 0x7a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_78c(hp45inst_t *instance)
+{
+  /* 78c: nop */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  /* 78d: nop */
+  instance->CY = 0;
+  instance->PC = 0x78e;
+  return 0;
+}
+
+static int block_78e(hp45inst_t *instance)
+{
+  /* 78e: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 78f: then go to 72 */
+  instance->PC = instance->CY ? 0x790 : 0x772;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_790(hp45inst_t *instance)
+{
+  /* 790: 0 -> s10 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->S &= ~(1<<10);
+  /* 791: c -> data address */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 792: then go to 96 */
+  instance->PC = instance->CY ? 0x793 : 0x796;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_793(hp45inst_t *instance)
+{
+  /* 793: c -> data address */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 794: if s10 = 1 */
+  instance->CY = (instance->S >> 10) & 1;
+  /* 795: then go to 9b */
+  instance->PC = instance->CY ? 0x796 : 0x79b;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_796(hp45inst_t *instance)
+{
+  /* 796: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 797: C->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &instance->CX, FIELD_W);
+  /* 798: shift C right [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  shift(&instance->CX, 0, FIELD_M);
+  /* 799: c -> data */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  /* 79a: then go to a6 */
+  instance->PC = instance->CY ? 0x79b : 0x7a6;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_79b(hp45inst_t *instance)
+{
+  /* 79b: data -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 79c: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 79d: 0-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifeq0(instance, &instance->CX, FIELD_P(instance->P));
+  /* 79e: then go to a0 */
+  instance->PC = instance->CY ? 0x79f : 0x7a0;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_79f(hp45inst_t *instance)
+{
+  /* 79f: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  instance->PC = 0x7a0;
+  return 0;
+}
+
+static int block_7a0(hp45inst_t *instance)
+{
+  /* 7a0: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 7a1: shift A left [ms] */
+  instance->CY = 0;
+  instance->ws = 5;
+  shift(&instance->A, 1, FIELD_MS);
+  instance->PC = 0x7a2;
+  return 0;
+}
+
+static int block_7a2(hp45inst_t *instance)
+{
+  /* 7a2: jsb 2d */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa3;
+  instance->PC = 0x72d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a3(hp45inst_t *instance)
+{
+  /* 7a3: jsb 2f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa4;
+  instance->PC = 0x72f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a4(hp45inst_t *instance)
+{
+  /* 7a4: jsb 2f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa5;
+  instance->PC = 0x72f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a5(hp45inst_t *instance)
+{
+  /* 7a5: jsb 2f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa6;
+  instance->PC = 0x72f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a6(hp45inst_t *instance)
+{
+  /* 7a6: jsb 2f */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa7;
+  instance->PC = 0x72f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a7(hp45inst_t *instance)
+{
+  /* 7a7: jsb 37 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xa8;
+  instance->PC = 0x737;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7a8(hp45inst_t *instance)
+{
+  /* 7a8: m -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  /* 7a9: display off */
+  instance->CY = 0;
+  instance->PC = 0x7aa;
+  if(!instance->DispOn)
+    return 0;
+  instance->DispOn = 0;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int block_7aa(hp45inst_t *instance)
+{
+  /* 7aa: display toggle */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x7ab;
+  instance->DispOn = !instance->DispOn;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int block_7ab(hp45inst_t *instance)
+{
+  /* 7ab: if s10 = 1 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = (instance->S >> 10) & 1;
+  /* 7ac: then go to 7f */
+  instance->PC = instance->CY ? 0x7ad : 0x77f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7ad(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7ad: 1 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 1;
+  /* 7ae: A+1->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  set1(&temp.r, FIELD_WP(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_WP(instance->P));
+  /* 7af: then go to 7f */
+  instance->PC = instance->CY ? 0x7b0 : 0x77f;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7b0(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7b0: 6 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 6;
+  /* 7b1: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7b2: then go to a2 */
+  instance->PC = instance->CY ? 0x7b3 : 0x7a2;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7b3(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7b3: 7 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 7;
+  /* 7b4: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7b5: A-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifge(instance, &instance->A, &instance->CX, FIELD_P(instance->P));
+  /* 7b6: then go to b8 */
+  instance->PC = instance->CY ? 0x7b7 : 0x7b8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7b7(hp45inst_t *instance)
+{
+  /* 7b7: then go to a3 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x7b8 : 0x7a3;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7b8(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7b8: 0->A [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->A, &zero, FIELD_WP(instance->P));
+  /* 7b9: 9 -> p */
+  instance->CY = 0;
+  instance->P = 9;
+  /* 7ba: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7bb: then go to 0d */
+  instance->PC = instance->CY ? 0x7bc : 0x70d;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7bc(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7bc: 10 -> p */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->P = 10;
+  /* 7bd: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7be: A-C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  ifge(instance, &instance->A, &instance->CX, FIELD_P(instance->P));
+  /* 7bf: then go to c1 */
+  instance->PC = instance->CY ? 0x7c0 : 0x7c1;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7c0(hp45inst_t *instance)
+{
+  /* 7c0: then go to a5 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x7c1 : 0x7a5;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7c1(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7c1: 0->C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 7c2: 0->A [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->A, &zero, FIELD_WP(instance->P));
+  /* 7c3: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 7c4: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7c5: then go to ca */
+  instance->PC = instance->CY ? 0x7c6 : 0x7ca;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7c6(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7c6: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 7c7: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 7c8: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7c9: then go to a7 */
+  instance->PC = instance->CY ? 0x7ca : 0x7a7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7ca(hp45inst_t *instance)
+{
+  /* 7ca: A-C [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  ifge(instance, &instance->A, &instance->CX, FIELD_M);
+  /* 7cb: then go to cd */
+  instance->PC = instance->CY ? 0x7cc : 0x7cd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7cc(hp45inst_t *instance)
+{
+  /* 7cc: then go to 09 */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x7cd : 0x709;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7cd(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7cd: 0->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->A, &zero, FIELD_W);
+  /* 7ce: 11 -> p */
+  instance->CY = 0;
+  instance->P = 11;
+  /* 7cf: A+1->A [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_P(instance->P));
+  /* 7d0: then go to 19 */
+  instance->PC = instance->CY ? 0x7d1 : 0x719;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7d1(hp45inst_t *instance)
+{
+  /* 7d1: m -> c */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  /* 7d2: 0->C [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  mov(&instance->CX, &zero, FIELD_WP(instance->P));
+  /* 7d3: 2 -> p */
+  instance->CY = 0;
+  instance->P = 2;
+  /* 7d4: 0-B [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  ifeq0(instance, &instance->B, FIELD_X);
+  /* 7d5: then go to d8 */
+  instance->PC = instance->CY ? 0x7d6 : 0x7d8;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7d6(hp45inst_t *instance)
+{
+  /* 7d6: 4 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 4);
+  instance->P = (instance->P - 1) & 0x0F;
+  /* 7d7: then go to d9 */
+  instance->PC = instance->CY ? 0x7d8 : 0x7d9;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7d8(hp45inst_t *instance)
+{
+  /* 7d8: 6 -> c[p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, 6);
+  instance->P = (instance->P - 1) & 0x0F;
+  instance->PC = 0x7d9;
+  return 0;
+}
+
+static int block_7d9(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7d9: c <-> m */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  memcpy(&temp.r, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp.r, sizeof(reg_t));
+  /* 7da: 0->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 7db: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 7dc: 0->B [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->B, &zero, FIELD_W);
+  instance->PC = 0x7dd;
+  return 0;
+}
+
+static int block_7dd(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7dd: c -> data address */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  /* 7de: B<->C [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 7df: data -> c */
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  /* 7e0: C-1 [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->CX, &temp.r, FIELD_P(instance->P));
+  /* 7e1: then go to e4 */
+  instance->PC = instance->CY ? 0x7e2 : 0x7e4;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7e2(hp45inst_t *instance)
+{
+  /* 7e2: jsb eb */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->LR = 0xe3;
+  instance->PC = 0x7eb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7e3(hp45inst_t *instance)
+{
+  /* 7e3: c -> data */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  instance->PC = 0x7e4;
+  return 0;
+}
+
+static int block_7e4(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7e4: B<->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->B, &instance->CX, FIELD_W);
+  /* 7e5: C+1->C [p] */
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  add(instance, &instance->CX, &temp.r, &instance->CX, FIELD_P(instance->P));
+  /* 7e6: then go to dd */
+  instance->PC = instance->CY ? 0x7e7 : 0x7dd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7e7(hp45inst_t *instance)
+{
+  /* 7e7: shift A right [m] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 1;
+  shift(&instance->A, 0, FIELD_M);
+  /* 7e8: C<->A [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 7e9: jsb eb */
+  instance->LR = 0xea;
+  instance->PC = 0x7eb;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7ea(hp45inst_t *instance)
+{
+  /* 7ea: then go to 7e */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->PC = instance->CY ? 0x7eb : 0x77e;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7eb(hp45inst_t *instance)
+{
+  /* 7eb: 0-C [wp] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 4;
+  ifeq0(instance, &instance->CX, FIELD_WP(instance->P));
+  /* 7ec: then go to fd */
+  instance->PC = instance->CY ? 0x7ed : 0x7fd;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7ed(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7ed: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  /* 7ee: shift A left [w] */
+  instance->CY = 0;
+  instance->ws = 3;
+  shift(&instance->A, 1, FIELD_W);
+  /* 7ef: 8 -> p */
+  instance->CY = 0;
+  instance->P = 8;
+  /* 7f0: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 7f1: 6 -> p */
+  instance->CY = 0;
+  instance->P = 6;
+  /* 7f2: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 7f3: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 7f4: shift A left [wp] */
+  instance->CY = 0;
+  instance->ws = 4;
+  shift(&instance->A, 1, FIELD_WP(instance->P));
+  /* 7f5: 12 -> p */
+  instance->CY = 0;
+  instance->P = 12;
+  /* 7f6: A+1->A [x] */
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  add(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  instance->PC = 0x7f7;
+  return 0;
+}
+
+static int block_7f7(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7f7: A-1 [p] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 0;
+  set1(&temp.r, FIELD_P(instance->P));
+  ifge(instance, &instance->A, &temp.r, FIELD_P(instance->P));
+  /* 7f8: then go to fc */
+  instance->PC = instance->CY ? 0x7f9 : 0x7fc;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7f9(hp45inst_t *instance)
+{
+  scratch_t temp;
+
+  /* 7f9: A-1->A [x] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 2;
+  set1(&temp.r, FIELD_X);
+  sub(instance, &instance->A, &temp.r, &instance->A, FIELD_X);
+  /* 7fa: shift A left [m] */
+  instance->CY = 0;
+  instance->ws = 1;
+  shift(&instance->A, 1, FIELD_M);
+  /* 7fb: then go to f7 */
+  instance->PC = instance->CY ? 0x7fc : 0x7f7;
+  instance->CY = 0;
+  return 0;
+}
+
+static int block_7fc(hp45inst_t *instance)
+{
+  /* 7fc: C<->A [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  exch(&instance->A, &instance->CX, FIELD_W);
+  instance->PC = 0x7fd;
+  return 0;
+}
+
+static int block_7fd(hp45inst_t *instance)
+{
+  /* 7fd: return */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->PC = 0x700 | instance->LR;
+  return 0;
+}
+
+static int block_7fe(hp45inst_t *instance)
+{
+  /* 7fe: 0->C [w] */
+  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+  instance->CY = 0;
+  instance->ws = 3;
+  mov(&instance->CX, &zero, FIELD_W);
+  /* 7ff: jsb 4b */
+  instance->LR = 0x00;
+  instance->PC = 0x74b;
+  instance->CY = 0;
+  return 0;
+}
+
+/* 972 blocks */
+static int (*const blocks[2048])(hp45inst_t*) = {
+  [0x000] = block_000,
+  [0x001] = block_001,
+  [0x002] = block_002,
+  [0x003] = block_003,
+  [0x00a] = block_00a,
+  [0x00b] = block_00b,
+  [0x00d] = block_00d,
+  [0x00e] = block_00e,
+  [0x010] = block_010,
+  [0x011] = block_011,
+  [0x014] = block_014,
+  [0x015] = block_015,
+  [0x016] = block_016,
+  [0x018] = block_018,
+  [0x019] = block_019,
+  [0x01b] = block_01b,
+  [0x022] = block_022,
+  [0x023] = block_023,
+  [0x024] = block_024,
+  [0x025] = block_025,
+  [0x029] = block_029,
+  [0x02b] = block_02b,
+  [0x02c] = block_02c,
+  [0x02d] = block_02d,
+  [0x030] = block_030,
+  [0x032] = block_032,
+  [0x034] = block_034,
+  [0x036] = block_036,
+  [0x037] = block_037,
+  [0x038] = block_038,
+  [0x03a] = block_03a,
+  [0x03e] = block_03e,
+  [0x040] = block_040,
+  [0x046] = block_046,
+  [0x048] = block_048,
+  [0x04a] = block_04a,
+  [0x050] = block_050,
+  [0x051] = block_051,
+  [0x052] = block_052,
+  [0x053] = block_053,
+  [0x058] = block_058,
+  [0x05a] = block_05a,
+  [0x05f] = block_05f,
+  [0x060] = block_060,
+  [0x061] = block_061,
+  [0x064] = block_064,
+  [0x069] = block_069,
+  [0x06a] = block_06a,
+  [0x06d] = block_06d,
+  [0x071] = block_071,
+  [0x072] = block_072,
+  [0x073] = block_073,
+  [0x075] = block_075,
+  [0x076] = block_076,
+  [0x078] = block_078,
+  [0x079] = block_079,
+  [0x07c] = block_07c,
+  [0x07d] = block_07d,
+  [0x07e] = block_07e,
+  [0x07f] = block_07f,
+  [0x082] = block_082,
+  [0x083] = block_083,
+  [0x085] = block_085,
+  [0x086] = block_086,
+  [0x087] = block_087,
+  [0x08d] = block_08d,
+  [0x08e] = block_08e,
+  [0x090] = block_090,
+  [0x091] = block_091,
+  [0x095] = block_095,
+  [0x097] = block_097,
+  [0x09a] = block_09a,
+  [0x09b] = block_09b,
+  [0x09c] = block_09c,
+  [0x09e] = block_09e,
+  [0x0a2] = block_0a2,
+  [0x0a5] = block_0a5,
+  [0x0a6] = block_0a6,
+  [0x0a8] = block_0a8,
+  [0x0aa] = block_0aa,
+  [0x0b1] = block_0b1,
+  [0x0b2] = block_0b2,
+  [0x0b5] = block_0b5,
+  [0x0b6] = block_0b6,
+  [0x0b7] = block_0b7,
+  [0x0b9] = block_0b9,
+  [0x0bd] = block_0bd,
+  [0x0be] = block_0be,
+  [0x0bf] = block_0bf,
+  [0x0c0] = block_0c0,
+  [0x0c2] = block_0c2,
+  [0x0c5] = block_0c5,
+  [0x0c6] = block_0c6,
+  [0x0c9] = block_0c9,
+  [0x0cb] = block_0cb,
+  [0x0cc] = block_0cc,
+  [0x0cd] = block_0cd,
+  [0x0d0] = block_0d0,
+  [0x0d3] = block_0d3,
+  [0x0d5] = block_0d5,
+  [0x0d8] = block_0d8,
+  [0x0d9] = block_0d9,
+  [0x0db] = block_0db,
+  [0x0dd] = block_0dd,
+  [0x0e0] = block_0e0,
+  [0x0e1] = block_0e1,
+  [0x0e2] = block_0e2,
+  [0x0e3] = block_0e3,
+  [0x0e5] = block_0e5,
+  [0x0e6] = block_0e6,
+  [0x0ea] = block_0ea,
+  [0x0eb] = block_0eb,
+  [0x0ef] = block_0ef,
+  [0x0f0] = block_0f0,
+  [0x0f2] = block_0f2,
+  [0x0f3] = block_0f3,
+  [0x0f9] = block_0f9,
+  [0x0fb] = block_0fb,
+  [0x0fd] = block_0fd,
+  [0x0fe] = block_0fe,
+  [0x0ff] = block_0ff,
+  [0x102] = block_102,
+  [0x104] = block_104,
+  [0x107] = block_107,
+  [0x109] = block_109,
+  [0x10b] = block_10b,
+  [0x10c] = block_10c,
+  [0x10e] = block_10e,
+  [0x110] = block_110,
+  [0x111] = block_111,
+  [0x113] = block_113,
+  [0x115] = block_115,
+  [0x116] = block_116,
+  [0x117] = block_117,
+  [0x119] = block_119,
+  [0x11a] = block_11a,
+  [0x11b] = block_11b,
+  [0x11d] = block_11d,
+  [0x121] = block_121,
+  [0x125] = block_125,
+  [0x128] = block_128,
+  [0x12b] = block_12b,
+  [0x12d] = block_12d,
+  [0x130] = block_130,
+  [0x134] = block_134,
+  [0x135] = block_135,
+  [0x138] = block_138,
+  [0x139] = block_139,
+  [0x13a] = block_13a,
+  [0x13c] = block_13c,
+  [0x13f] = block_13f,
+  [0x140] = block_140,
+  [0x142] = block_142,
+  [0x146] = block_146,
+  [0x149] = block_149,
+  [0x153] = block_153,
+  [0x157] = block_157,
+  [0x15b] = block_15b,
+  [0x15d] = block_15d,
+  [0x15f] = block_15f,
+  [0x163] = block_163,
+  [0x164] = block_164,
+  [0x165] = block_165,
+  [0x166] = block_166,
+  [0x168] = block_168,
+  [0x16a] = block_16a,
+  [0x16b] = block_16b,
+  [0x16e] = block_16e,
+  [0x170] = block_170,
+  [0x173] = block_173,
+  [0x174] = block_174,
+  [0x175] = block_175,
+  [0x176] = block_176,
+  [0x177] = block_177,
+  [0x17a] = block_17a,
+  [0x17c] = block_17c,
+  [0x17d] = block_17d,
+  [0x17f] = block_17f,
+  [0x180] = block_180,
+  [0x182] = block_182,
+  [0x186] = block_186,
+  [0x188] = block_188,
+  [0x189] = block_189,
+  [0x18e] = block_18e,
+  [0x195] = block_195,
+  [0x197] = block_197,
+  [0x198] = block_198,
+  [0x19a] = block_19a,
+  [0x19b] = block_19b,
+  [0x19c] = block_19c,
+  [0x19d] = block_19d,
+  [0x1a0] = block_1a0,
+  [0x1a1] = block_1a1,
+  [0x1a3] = block_1a3,
+  [0x1a4] = block_1a4,
+  [0x1a5] = block_1a5,
+  [0x1a6] = block_1a6,
+  [0x1a8] = block_1a8,
+  [0x1a9] = block_1a9,
+  [0x1ab] = block_1ab,
+  [0x1ae] = block_1ae,
+  [0x1b1] = block_1b1,
+  [0x1b2] = block_1b2,
+  [0x1b3] = block_1b3,
+  [0x1b5] = block_1b5,
+  [0x1b9] = block_1b9,
+  [0x1ba] = block_1ba,
+  [0x1bb] = block_1bb,
+  [0x1be] = block_1be,
+  [0x1bf] = block_1bf,
+  [0x1c5] = block_1c5,
+  [0x1c6] = block_1c6,
+  [0x1c8] = block_1c8,
+  [0x1ca] = block_1ca,
+  [0x1cb] = block_1cb,
+  [0x1cc] = block_1cc,
+  [0x1d9] = block_1d9,
+  [0x1da] = block_1da,
+  [0x1db] = block_1db,
+  [0x1dd] = block_1dd,
+  [0x1de] = block_1de,
+  [0x1e1] = block_1e1,
+  [0x1e5] = block_1e5,
+  [0x1e6] = block_1e6,
+  [0x1eb] = block_1eb,
+  [0x1ec] = block_1ec,
+  [0x1ee] = block_1ee,
+  [0x1f0] = block_1f0,
+  [0x1f3] = block_1f3,
+  [0x1f6] = block_1f6,
+  [0x1fb] = block_1fb,
+  [0x1fc] = block_1fc,
+  [0x200] = block_200,
+  [0x201] = block_201,
+  [0x206] = block_206,
+  [0x208] = block_208,
+  [0x20b] = block_20b,
+  [0x20e] = block_20e,
+  [0x211] = block_211,
+  [0x212] = block_212,
+  [0x214] = block_214,
+  [0x216] = block_216,
+  [0x219] = block_219,
+  [0x21b] = block_21b,
+  [0x21d] = block_21d,
+  [0x21f] = block_21f,
+  [0x220] = block_220,
+  [0x222] = block_222,
+  [0x223] = block_223,
+  [0x225] = block_225,
+  [0x226] = block_226,
+  [0x227] = block_227,
+  [0x228] = block_228,
+  [0x229] = block_229,
+  [0x22a] = block_22a,
+  [0x22e] = block_22e,
+  [0x22f] = block_22f,
+  [0x230] = block_230,
+  [0x234] = block_234,
+  [0x237] = block_237,
+  [0x238] = block_238,
+  [0x23b] = block_23b,
+  [0x23d] = block_23d,
+  [0x23f] = block_23f,
+  [0x240] = block_240,
+  [0x241] = block_241,
+  [0x242] = block_242,
+  [0x243] = block_243,
+  [0x244] = block_244,
+  [0x245] = block_245,
+  [0x247] = block_247,
+  [0x248] = block_248,
+  [0x24a] = block_24a,
+  [0x24b] = block_24b,
+  [0x24d] = block_24d,
+  [0x24e] = block_24e,
+  [0x250] = block_250,
+  [0x251] = block_251,
+  [0x252] = block_252,
+  [0x259] = block_259,
+  [0x25b] = block_25b,
+  [0x25c] = block_25c,
+  [0x25e] = block_25e,
+  [0x260] = block_260,
+  [0x264] = block_264,
+  [0x267] = block_267,
+  [0x269] = block_269,
+  [0x26c] = block_26c,
+  [0x26d] = block_26d,
+  [0x272] = block_272,
+  [0x275] = block_275,
+  [0x276] = block_276,
+  [0x278] = block_278,
+  [0x279] = block_279,
+  [0x27a] = block_27a,
+  [0x27c] = block_27c,
+  [0x27d] = block_27d,
+  [0x27e] = block_27e,
+  [0x281] = block_281,
+  [0x286] = block_286,
+  [0x287] = block_287,
+  [0x288] = block_288,
+  [0x28b] = block_28b,
+  [0x28e] = block_28e,
+  [0x291] = block_291,
+  [0x294] = block_294,
+  [0x295] = block_295,
+  [0x296] = block_296,
+  [0x298] = block_298,
+  [0x29b] = block_29b,
+  [0x29c] = block_29c,
+  [0x29d] = block_29d,
+  [0x29f] = block_29f,
+  [0x2a0] = block_2a0,
+  [0x2a2] = block_2a2,
+  [0x2a5] = block_2a5,
+  [0x2a6] = block_2a6,
+  [0x2a7] = block_2a7,
+  [0x2a8] = block_2a8,
+  [0x2aa] = block_2aa,
+  [0x2ab] = block_2ab,
+  [0x2af] = block_2af,
+  [0x2b1] = block_2b1,
+  [0x2b3] = block_2b3,
+  [0x2b4] = block_2b4,
+  [0x2b5] = block_2b5,
+  [0x2b6] = block_2b6,
+  [0x2b9] = block_2b9,
+  [0x2c2] = block_2c2,
+  [0x2c4] = block_2c4,
+  [0x2c5] = block_2c5,
+  [0x2c6] = block_2c6,
+  [0x2c7] = block_2c7,
+  [0x2cb] = block_2cb,
+  [0x2cc] = block_2cc,
+  [0x2cf] = block_2cf,
+  [0x2d1] = block_2d1,
+  [0x2d5] = block_2d5,
+  [0x2d6] = block_2d6,
+  [0x2da] = block_2da,
+  [0x2db] = block_2db,
+  [0x2dd] = block_2dd,
+  [0x2df] = block_2df,
+  [0x2e6] = block_2e6,
+  [0x2ea] = block_2ea,
+  [0x2ec] = block_2ec,
+  [0x2f1] = block_2f1,
+  [0x2f2] = block_2f2,
+  [0x2f5] = block_2f5,
+  [0x2f6] = block_2f6,
+  [0x2fe] = block_2fe,
+  [0x300] = block_300,
+  [0x301] = block_301,
+  [0x302] = block_302,
+  [0x303] = block_303,
+  [0x304] = block_304,
+  [0x305] = block_305,
+  [0x306] = block_306,
+  [0x307] = block_307,
+  [0x308] = block_308,
+  [0x309] = block_309,
+  [0x30a] = block_30a,
+  [0x30b] = block_30b,
+  [0x30c] = block_30c,
+  [0x30d] = block_30d,
+  [0x30e] = block_30e,
+  [0x30f] = block_30f,
+  [0x310] = block_310,
+  [0x311] = block_311,
+  [0x312] = block_312,
+  [0x313] = block_313,
+  [0x314] = block_314,
+  [0x315] = block_315,
+  [0x316] = block_316,
+  [0x317] = block_317,
+  [0x318] = block_318,
+  [0x319] = block_319,
+  [0x31a] = block_31a,
+  [0x31b] = block_31b,
+  [0x31c] = block_31c,
+  [0x31d] = block_31d,
+  [0x31e] = block_31e,
+  [0x31f] = block_31f,
+  [0x320] = block_320,
+  [0x321] = block_321,
+  [0x322] = block_322,
+  [0x323] = block_323,
+  [0x324] = block_324,
+  [0x325] = block_325,
+  [0x326] = block_326,
+  [0x327] = block_327,
+  [0x328] = block_328,
+  [0x329] = block_329,
+  [0x32a] = block_32a,
+  [0x32b] = block_32b,
+  [0x32c] = block_32c,
+  [0x32d] = block_32d,
+  [0x32e] = block_32e,
+  [0x32f] = block_32f,
+  [0x330] = block_330,
+  [0x331] = block_331,
+  [0x332] = block_332,
+  [0x333] = block_333,
+  [0x334] = block_334,
+  [0x335] = block_335,
+  [0x336] = block_336,
+  [0x337] = block_337,
+  [0x338] = block_338,
+  [0x339] = block_339,
+  [0x33a] = block_33a,
+  [0x33b] = block_33b,
+  [0x33c] = block_33c,
+  [0x33d] = block_33d,
+  [0x33e] = block_33e,
+  [0x33f] = block_33f,
+  [0x340] = block_340,
+  [0x341] = block_341,
+  [0x342] = block_342,
+  [0x344] = block_344,
+  [0x345] = block_345,
+  [0x348] = block_348,
+  [0x349] = block_349,
+  [0x34a] = block_34a,
+  [0x34c] = block_34c,
+  [0x34d] = block_34d,
+  [0x34e] = block_34e,
+  [0x350] = block_350,
+  [0x352] = block_352,
+  [0x356] = block_356,
+  [0x357] = block_357,
+  [0x359] = block_359,
+  [0x35a] = block_35a,
+  [0x35c] = block_35c,
+  [0x35e] = block_35e,
+  [0x35f] = block_35f,
+  [0x360] = block_360,
+  [0x361] = block_361,
+  [0x363] = block_363,
+  [0x364] = block_364,
+  [0x366] = block_366,
+  [0x368] = block_368,
+  [0x369] = block_369,
+  [0x36b] = block_36b,
+  [0x36c] = block_36c,
+  [0x36d] = block_36d,
+  [0x36f] = block_36f,
+  [0x370] = block_370,
+  [0x371] = block_371,
+  [0x372] = block_372,
+  [0x374] = block_374,
+  [0x375] = block_375,
+  [0x378] = block_378,
+  [0x379] = block_379,
+  [0x37a] = block_37a,
+  [0x37b] = block_37b,
+  [0x37e] = block_37e,
+  [0x37f] = block_37f,
+  [0x380] = block_380,
+  [0x381] = block_381,
+  [0x382] = block_382,
+  [0x383] = block_383,
+  [0x384] = block_384,
+  [0x385] = block_385,
+  [0x387] = block_387,
+  [0x388] = block_388,
+  [0x38b] = block_38b,
+  [0x38c] = block_38c,
+  [0x38f] = block_38f,
+  [0x391] = block_391,
+  [0x392] = block_392,
+  [0x394] = block_394,
+  [0x395] = block_395,
+  [0x398] = block_398,
+  [0x399] = block_399,
+  [0x39b] = block_39b,
+  [0x39f] = block_39f,
+  [0x3a1] = block_3a1,
+  [0x3a6] = block_3a6,
+  [0x3a7] = block_3a7,
+  [0x3a9] = block_3a9,
+  [0x3ae] = block_3ae,
+  [0x3b1] = block_3b1,
+  [0x3b4] = block_3b4,
+  [0x3b7] = block_3b7,
+  [0x3b9] = block_3b9,
+  [0x3bb] = block_3bb,
+  [0x3be] = block_3be,
+  [0x3c1] = block_3c1,
+  [0x3c4] = block_3c4,
+  [0x3c6] = block_3c6,
+  [0x3c9] = block_3c9,
+  [0x3cb] = block_3cb,
+  [0x3cc] = block_3cc,
+  [0x3d0] = block_3d0,
+  [0x3d2] = block_3d2,
+  [0x3d3] = block_3d3,
+  [0x3d4] = block_3d4,
+  [0x3d6] = block_3d6,
+  [0x3d8] = block_3d8,
+  [0x3db] = block_3db,
+  [0x3df] = block_3df,
+  [0x3e2] = block_3e2,
+  [0x3e5] = block_3e5,
+  [0x3e7] = block_3e7,
+  [0x3e8] = block_3e8,
+  [0x3ea] = block_3ea,
+  [0x3ec] = block_3ec,
+  [0x3ee] = block_3ee,
+  [0x3f3] = block_3f3,
+  [0x3f4] = block_3f4,
+  [0x3f5] = block_3f5,
+  [0x3f6] = block_3f6,
+  [0x3f8] = block_3f8,
+  [0x3f9] = block_3f9,
+  [0x3ff] = block_3ff,
+  [0x400] = block_400,
+  [0x401] = block_401,
+  [0x402] = block_402,
+  [0x403] = block_403,
+  [0x404] = block_404,
+  [0x405] = block_405,
+  [0x406] = block_406,
+  [0x407] = block_407,
+  [0x408] = block_408,
+  [0x409] = block_409,
+  [0x40a] = block_40a,
+  [0x40b] = block_40b,
+  [0x40c] = block_40c,
+  [0x40d] = block_40d,
+  [0x40e] = block_40e,
+  [0x40f] = block_40f,
+  [0x410] = block_410,
+  [0x411] = block_411,
+  [0x412] = block_412,
+  [0x413] = block_413,
+  [0x414] = block_414,
+  [0x415] = block_415,
+  [0x416] = block_416,
+  [0x417] = block_417,
+  [0x418] = block_418,
+  [0x419] = block_419,
+  [0x41a] = block_41a,
+  [0x41b] = block_41b,
+  [0x41c] = block_41c,
+  [0x41d] = block_41d,
+  [0x41e] = block_41e,
+  [0x41f] = block_41f,
+  [0x420] = block_420,
+  [0x421] = block_421,
+  [0x422] = block_422,
+  [0x423] = block_423,
+  [0x424] = block_424,
+  [0x425] = block_425,
+  [0x426] = block_426,
+  [0x427] = block_427,
+  [0x428] = block_428,
+  [0x429] = block_429,
+  [0x42a] = block_42a,
+  [0x42b] = block_42b,
+  [0x42c] = block_42c,
+  [0x42d] = block_42d,
+  [0x42e] = block_42e,
+  [0x42f] = block_42f,
+  [0x430] = block_430,
+  [0x431] = block_431,
+  [0x432] = block_432,
+  [0x433] = block_433,
+  [0x434] = block_434,
+  [0x435] = block_435,
+  [0x436] = block_436,
+  [0x437] = block_437,
+  [0x438] = block_438,
+  [0x439] = block_439,
+  [0x43a] = block_43a,
+  [0x43b] = block_43b,
+  [0x43c] = block_43c,
+  [0x43d] = block_43d,
+  [0x43e] = block_43e,
+  [0x43f] = block_43f,
+  [0x441] = block_441,
+  [0x442] = block_442,
+  [0x443] = block_443,
+  [0x444] = block_444,
+  [0x449] = block_449,
+  [0x44a] = block_44a,
+  [0x44b] = block_44b,
+  [0x44c] = block_44c,
+  [0x44d] = block_44d,
+  [0x44e] = block_44e,
+  [0x452] = block_452,
+  [0x458] = block_458,
+  [0x45a] = block_45a,
+  [0x45b] = block_45b,
+  [0x45c] = block_45c,
+  [0x45e] = block_45e,
+  [0x460] = block_460,
+  [0x461] = block_461,
+  [0x463] = block_463,
+  [0x464] = block_464,
+  [0x465] = block_465,
+  [0x468] = block_468,
+  [0x46b] = block_46b,
+  [0x46e] = block_46e,
+  [0x470] = block_470,
+  [0x471] = block_471,
+  [0x472] = block_472,
+  [0x473] = block_473,
+  [0x474] = block_474,
+  [0x475] = block_475,
+  [0x477] = block_477,
+  [0x479] = block_479,
+  [0x47c] = block_47c,
+  [0x47d] = block_47d,
+  [0x47f] = block_47f,
+  [0x480] = block_480,
+  [0x482] = block_482,
+  [0x484] = block_484,
+  [0x485] = block_485,
+  [0x487] = block_487,
+  [0x488] = block_488,
+  [0x48b] = block_48b,
+  [0x48d] = block_48d,
+  [0x48e] = block_48e,
+  [0x490] = block_490,
+  [0x491] = block_491,
+  [0x493] = block_493,
+  [0x494] = block_494,
+  [0x498] = block_498,
+  [0x499] = block_499,
+  [0x49c] = block_49c,
+  [0x49d] = block_49d,
+  [0x49f] = block_49f,
+  [0x4a0] = block_4a0,
+  [0x4a1] = block_4a1,
+  [0x4a3] = block_4a3,
+  [0x4a4] = block_4a4,
+  [0x4a5] = block_4a5,
+  [0x4a6] = block_4a6,
+  [0x4a7] = block_4a7,
+  [0x4a8] = block_4a8,
+  [0x4a9] = block_4a9,
+  [0x4ad] = block_4ad,
+  [0x4ae] = block_4ae,
+  [0x4b0] = block_4b0,
+  [0x4b2] = block_4b2,
+  [0x4b5] = block_4b5,
+  [0x4b7] = block_4b7,
+  [0x4b9] = block_4b9,
+  [0x4bb] = block_4bb,
+  [0x4bc] = block_4bc,
+  [0x4bd] = block_4bd,
+  [0x4bf] = block_4bf,
+  [0x4c3] = block_4c3,
+  [0x4c5] = block_4c5,
+  [0x4c7] = block_4c7,
+  [0x4c8] = block_4c8,
+  [0x4c9] = block_4c9,
+  [0x4cb] = block_4cb,
+  [0x4d0] = block_4d0,
+  [0x4d2] = block_4d2,
+  [0x4d3] = block_4d3,
+  [0x4d4] = block_4d4,
+  [0x4d5] = block_4d5,
+  [0x4f1] = block_4f1,
+  [0x4f5] = block_4f5,
+  [0x4fe] = block_4fe,
+  [0x4ff] = block_4ff,
+  [0x500] = block_500,
+  [0x501] = block_501,
+  [0x502] = block_502,
+  [0x503] = block_503,
+  [0x504] = block_504,
+  [0x50c] = block_50c,
+  [0x50f] = block_50f,
+  [0x510] = block_510,
+  [0x515] = block_515,
+  [0x516] = block_516,
+  [0x519] = block_519,
+  [0x51a] = block_51a,
+  [0x51b] = block_51b,
+  [0x51c] = block_51c,
+  [0x51e] = block_51e,
+  [0x51f] = block_51f,
+  [0x522] = block_522,
+  [0x523] = block_523,
+  [0x524] = block_524,
+  [0x525] = block_525,
+  [0x526] = block_526,
+  [0x527] = block_527,
+  [0x52b] = block_52b,
+  [0x52c] = block_52c,
+  [0x52d] = block_52d,
+  [0x532] = block_532,
+  [0x536] = block_536,
+  [0x539] = block_539,
+  [0x541] = block_541,
+  [0x542] = block_542,
+  [0x545] = block_545,
+  [0x547] = block_547,
+  [0x548] = block_548,
+  [0x54a] = block_54a,
+  [0x54b] = block_54b,
+  [0x54c] = block_54c,
+  [0x54e] = block_54e,
+  [0x550] = block_550,
+  [0x554] = block_554,
+  [0x556] = block_556,
+  [0x557] = block_557,
+  [0x559] = block_559,
+  [0x55b] = block_55b,
+  [0x55c] = block_55c,
+  [0x55f] = block_55f,
+  [0x560] = block_560,
+  [0x562] = block_562,
+  [0x565] = block_565,
+  [0x566] = block_566,
+  [0x575] = block_575,
+  [0x576] = block_576,
+  [0x57b] = block_57b,
+  [0x57c] = block_57c,
+  [0x57e] = block_57e,
+  [0x5a0] = block_5a0,
+  [0x5a1] = block_5a1,
+  [0x5a3] = block_5a3,
+  [0x5a4] = block_5a4,
+  [0x5a5] = block_5a5,
+  [0x5a6] = block_5a6,
+  [0x5a7] = block_5a7,
+  [0x5b0] = block_5b0,
+  [0x5b4] = block_5b4,
+  [0x5b5] = block_5b5,
+  [0x5ba] = block_5ba,
+  [0x5bb] = block_5bb,
+  [0x5c1] = block_5c1,
+  [0x5c4] = block_5c4,
+  [0x5dc] = block_5dc,
+  [0x5de] = block_5de,
+  [0x5e0] = block_5e0,
+  [0x5e1] = block_5e1,
+  [0x5e3] = block_5e3,
+  [0x5e4] = block_5e4,
+  [0x5ea] = block_5ea,
+  [0x5ec] = block_5ec,
+  [0x5f5] = block_5f5,
+  [0x5f6] = block_5f6,
+  [0x5f9] = block_5f9,
+  [0x5ff] = block_5ff,
+  [0x600] = block_600,
+  [0x601] = block_601,
+  [0x602] = block_602,
+  [0x604] = block_604,
+  [0x606] = block_606,
+  [0x607] = block_607,
+  [0x60a] = block_60a,
+  [0x60e] = block_60e,
+  [0x611] = block_611,
+  [0x612] = block_612,
+  [0x614] = block_614,
+  [0x617] = block_617,
+  [0x619] = block_619,
+  [0x621] = block_621,
+  [0x626] = block_626,
+  [0x629] = block_629,
+  [0x62a] = block_62a,
+  [0x62c] = block_62c,
+  [0x62d] = block_62d,
+  [0x62f] = block_62f,
+  [0x635] = block_635,
+  [0x63a] = block_63a,
+  [0x63b] = block_63b,
+  [0x640] = block_640,
+  [0x641] = block_641,
+  [0x645] = block_645,
+  [0x648] = block_648,
+  [0x64e] = block_64e,
+  [0x652] = block_652,
+  [0x654] = block_654,
+  [0x655] = block_655,
+  [0x657] = block_657,
+  [0x658] = block_658,
+  [0x663] = block_663,
+  [0x664] = block_664,
+  [0x665] = block_665,
+  [0x66c] = block_66c,
+  [0x672] = block_672,
+  [0x673] = block_673,
+  [0x674] = block_674,
+  [0x676] = block_676,
+  [0x678] = block_678,
+  [0x679] = block_679,
+  [0x67c] = block_67c,
+  [0x67e] = block_67e,
+  [0x67f] = block_67f,
+  [0x680] = block_680,
+  [0x681] = block_681,
+  [0x684] = block_684,
+  [0x686] = block_686,
+  [0x687] = block_687,
+  [0x689] = block_689,
+  [0x68d] = block_68d,
+  [0x68f] = block_68f,
+  [0x699] = block_699,
+  [0x6a4] = block_6a4,
+  [0x6a5] = block_6a5,
+  [0x6a9] = block_6a9,
+  [0x6b3] = block_6b3,
+  [0x6b4] = block_6b4,
+  [0x6bc] = block_6bc,
+  [0x6be] = block_6be,
+  [0x6c0] = block_6c0,
+  [0x6c2] = block_6c2,
+  [0x6c4] = block_6c4,
+  [0x6c7] = block_6c7,
+  [0x6c8] = block_6c8,
+  [0x6ca] = block_6ca,
+  [0x6cb] = block_6cb,
+  [0x6cd] = block_6cd,
+  [0x6d1] = block_6d1,
+  [0x6d4] = block_6d4,
+  [0x6d5] = block_6d5,
+  [0x6da] = block_6da,
+  [0x6dd] = block_6dd,
+  [0x6df] = block_6df,
+  [0x6e1] = block_6e1,
+  [0x6e3] = block_6e3,
+  [0x6e5] = block_6e5,
+  [0x6e8] = block_6e8,
+  [0x6ea] = block_6ea,
+  [0x6f0] = block_6f0,
+  [0x6f4] = block_6f4,
+  [0x6f6] = block_6f6,
+  [0x6f8] = block_6f8,
+  [0x6fa] = block_6fa,
+  [0x6fb] = block_6fb,
+  [0x6fd] = block_6fd,
+  [0x6fe] = block_6fe,
+  [0x700] = block_700,
+  [0x701] = block_701,
+  [0x702] = block_702,
+  [0x703] = block_703,
+  [0x704] = block_704,
+  [0x705] = block_705,
+  [0x706] = block_706,
+  [0x707] = block_707,
+  [0x708] = block_708,
+  [0x709] = block_709,
+  [0x70a] = block_70a,
+  [0x70b] = block_70b,
+  [0x70c] = block_70c,
+  [0x70d] = block_70d,
+  [0x70e] = block_70e,
+  [0x70f] = block_70f,
+  [0x710] = block_710,
+  [0x711] = block_711,
+  [0x712] = block_712,
+  [0x713] = block_713,
+  [0x714] = block_714,
+  [0x715] = block_715,
+  [0x716] = block_716,
+  [0x717] = block_717,
+  [0x718] = block_718,
+  [0x719] = block_719,
+  [0x71a] = block_71a,
+  [0x71b] = block_71b,
+  [0x71c] = block_71c,
+  [0x71d] = block_71d,
+  [0x71e] = block_71e,
+  [0x71f] = block_71f,
+  [0x720] = block_720,
+  [0x721] = block_721,
+  [0x722] = block_722,
+  [0x723] = block_723,
+  [0x724] = block_724,
+  [0x725] = block_725,
+  [0x726] = block_726,
+  [0x727] = block_727,
+  [0x728] = block_728,
+  [0x729] = block_729,
+  [0x72a] = block_72a,
+  [0x72b] = block_72b,
+  [0x72c] = block_72c,
+  [0x72d] = block_72d,
+  [0x72e] = block_72e,
+  [0x72f] = block_72f,
+  [0x730] = block_730,
+  [0x731] = block_731,
+  [0x732] = block_732,
+  [0x733] = block_733,
+  [0x734] = block_734,
+  [0x735] = block_735,
+  [0x736] = block_736,
+  [0x737] = block_737,
+  [0x738] = block_738,
+  [0x739] = block_739,
+  [0x73a] = block_73a,
+  [0x73b] = block_73b,
+  [0x73c] = block_73c,
+  [0x73d] = block_73d,
+  [0x73e] = block_73e,
+  [0x73f] = block_73f,
+  [0x740] = block_740,
+  [0x743] = block_743,
+  [0x747] = block_747,
+  [0x748] = block_748,
+  [0x749] = block_749,
+  [0x74b] = block_74b,
+  [0x751] = block_751,
+  [0x755] = block_755,
+  [0x75c] = block_75c,
+  [0x76c] = block_76c,
+  [0x76e] = block_76e,
+  [0x771] = block_771,
+  [0x772] = block_772,
+  [0x774] = block_774,
+  [0x776] = block_776,
+  [0x778] = block_778,
+  [0x779] = block_779,
+  [0x77a] = block_77a,
+  [0x77c] = block_77c,
+  [0x77d] = block_77d,
+  [0x77e] = block_77e,
+  [0x77f] = block_77f,
+  [0x781] = block_781,
+  [0x783] = block_783,
+  [0x784] = block_784,
+  [0x788] = block_788,
+  [0x78c] = block_78c,
+  [0x78e] = block_78e,
+  [0x790] = block_790,
+  [0x793] = block_793,
+  [0x796] = block_796,
+  [0x79b] = block_79b,
+  [0x79f] = block_79f,
+  [0x7a0] = block_7a0,
+  [0x7a2] = block_7a2,
+  [0x7a3] = block_7a3,
+  [0x7a4] = block_7a4,
+  [0x7a5] = block_7a5,
+  [0x7a6] = block_7a6,
+  [0x7a7] = block_7a7,
+  [0x7a8] = block_7a8,
+  [0x7aa] = block_7aa,
+  [0x7ab] = block_7ab,
+  [0x7ad] = block_7ad,
+  [0x7b0] = block_7b0,
+  [0x7b3] = block_7b3,
+  [0x7b7] = block_7b7,
+  [0x7b8] = block_7b8,
+  [0x7bc] = block_7bc,
+  [0x7c0] = block_7c0,
+  [0x7c1] = block_7c1,
+  [0x7c6] = block_7c6,
+  [0x7ca] = block_7ca,
+  [0x7cc] = block_7cc,
+  [0x7cd] = block_7cd,
+  [0x7d1] = block_7d1,
+  [0x7d6] = block_7d6,
+  [0x7d8] = block_7d8,
+  [0x7d9] = block_7d9,
+  [0x7dd] = block_7dd,
+  [0x7e2] = block_7e2,
+  [0x7e3] = block_7e3,
+  [0x7e4] = block_7e4,
+  [0x7e7] = block_7e7,
+  [0x7ea] = block_7ea,
+  [0x7eb] = block_7eb,
+  [0x7ed] = block_7ed,
+  [0x7f7] = block_7f7,
+  [0x7f9] = block_7f9,
+  [0x7fc] = block_7fc,
+  [0x7fd] = block_7fd,
+  [0x7fe] = block_7fe,
+};
+
+/* number of word-cycles of each block, 0 where no block starts */
+static const uint8_t block_len[2048] = {
+    1,   1,   1,   7,   0,   0,   0,   0,   0,   0,   1,   2,   0,   1,   2,   0,
+    1,   3,   0,   0,   1,   1,   2,   0,   1,   2,   0,   7,   0,   0,   0,   0,
+    0,   0,   1,   1,   1,   4,   0,   0,   0,   2,   0,   1,   1,   3,   0,   0,
+    2,   0,   2,   0,   2,   0,   1,   1,   2,   0,   4,   0,   0,   0,   2,   0,
+    6,   0,   0,   0,   0,   0,   2,   0,   2,   0,   6,   0,   0,   0,   0,   0,
+    1,   1,   1,   5,   0,   0,   0,   0,   2,   0,   5,   0,   0,   0,   0,   1,
+    1,   3,   0,   0,   5,   0,   0,   0,   0,   1,   3,   0,   0,   4,   0,   0,
+    0,   1,   1,   2,   0,   1,   2,   0,   1,   3,   0,   0,   1,   1,   1,   3,
+    0,   0,   1,   2,   0,   1,   1,   6,   0,   0,   0,   0,   0,   1,   2,   0,
+    1,   4,   0,   0,   0,   2,   0,   3,   0,   0,   1,   1,   2,   0,   4,   0,
+    0,   0,   3,   0,   0,   1,   2,   0,   2,   0,   7,   0,   0,   0,   0,   0,
+    0,   1,   3,   0,   0,   1,   1,   2,   0,   4,   0,   0,   0,   1,   1,   1,
+    2,   0,   3,   0,   0,   1,   3,   0,   0,   2,   0,   1,   1,   3,   0,   0,
+    3,   0,   0,   2,   0,   3,   0,   0,   1,   2,   0,   2,   0,   3,   0,   0,
+    1,   1,   1,   2,   0,   1,   4,   0,   0,   0,   1,   4,   0,   0,   0,   1,
+    2,   0,   1,   6,   0,   0,   0,   0,   0,   2,   0,   2,   0,   1,   1,   1,
+    0,   0,   2,   0,   3,   0,   0,   2,   0,   2,   0,   1,   2,   0,   2,   0,
+    1,   2,   0,   2,   0,   1,   1,   2,   0,   1,   1,   2,   0,   4,   0,   0,
+    0,   4,   0,   0,   0,   3,   0,   0,   3,   0,   0,   2,   0,   3,   0,   0,
+    4,   0,   0,   0,   1,   3,   0,   0,   1,   1,   2,   0,   3,   0,   0,   1,
+    2,   0,   4,   0,   0,   0,   3,   0,   0,  10,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   4,   0,   0,   0,   4,   0,   0,   0,   2,   0,   2,   0,   4,
+    0,   0,   0,   1,   1,   1,   2,   0,   2,   0,   1,   3,   0,   0,   2,   0,
+    3,   0,   0,   1,   1,   1,   1,   3,   0,   0,   2,   0,   1,   2,   0,   1,
+    2,   0,   4,   0,   0,   0,   2,   0,   1,   5,   0,   0,   0,   0,   7,   0,
+    0,   0,   0,   0,   0,   2,   0,   1,   2,   0,   1,   1,   1,   3,   0,   0,
+    1,   2,   0,   1,   1,   1,   2,   0,   1,   2,   0,   3,   0,   0,   3,   0,
+    0,   1,   1,   2,   0,   4,   0,   0,   0,   1,   1,   3,   0,   0,   1,   6,
+    0,   0,   0,   0,   0,   1,   2,   0,   2,   0,   1,   1,  13,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   2,   0,   1,   3,   0,
+    0,   4,   0,   0,   0,   1,   5,   0,   0,   0,   0,   1,   2,   0,   2,   0,
+    3,   0,   0,   3,   0,   0,   5,   0,   0,   0,   0,   1,   6,   0,   0,   0,
+    1,   5,   0,   0,   0,   0,   2,   0,   3,   0,   0,   3,   0,   0,   3,   0,
+    0,   1,   2,   0,   2,   0,   3,   0,   0,   2,   0,   2,   0,   2,   0,   1,
+    2,   0,   1,   2,   0,   1,   1,   1,   1,   1,   4,   0,   0,   0,   1,   1,
+    4,   0,   0,   0,   3,   0,   0,   1,   3,   0,   0,   2,   0,   2,   0,   1,
+    1,   1,   1,   1,   1,   2,   0,   1,   2,   0,   1,   2,   0,   1,   2,   0,
+    1,   1,   7,   0,   0,   0,   0,   0,   0,   2,   0,   1,   2,   0,   2,   0,
+    4,   0,   0,   0,   3,   0,   0,   2,   0,   3,   0,   0,   1,   5,   0,   0,
+    0,   0,   3,   0,   0,   1,   2,   0,   1,   1,   2,   0,   1,   1,   3,   0,
+    0,   5,   0,   0,   0,   0,   1,   1,   3,   0,   0,   3,   0,   0,   3,   0,
+    0,   3,   0,   0,   1,   1,   2,   0,   3,   0,   0,   1,   1,   2,   0,   1,
+    2,   0,   3,   0,   0,   1,   1,   1,   2,   0,   1,   4,   0,   0,   0,   2,
+    0,   2,   0,   1,   1,   1,   3,   0,   0,   9,   0,   0,   0,   0,   0,   0,
+    0,   0,   2,   0,   1,   1,   1,   4,   0,   0,   0,   1,   3,   0,   0,   2,
+    0,   4,   0,   0,   0,   1,   4,   0,   0,   0,   1,   2,   0,   2,   0,   7,
+    0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   2,   0,   5,   0,   0,   0,
+    0,   1,   3,   0,   0,   1,   8,   0,   0,   0,   0,   0,   0,   0,   2,   0,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   2,   0,   1,   3,   0,   0,   1,   1,   2,   0,   1,   1,   2,   0,
+    2,   0,   4,   0,   0,   0,   1,   2,   0,   1,   2,   0,   2,   0,   1,   1,
+    1,   2,   0,   1,   2,   0,   2,   0,   1,   2,   0,   1,   1,   2,   0,   1,
+    1,   1,   2,   0,   1,   3,   0,   0,   1,   1,   1,   1,   0,   0,   1,   1,
+    1,   1,   1,   1,   1,   2,   0,   1,   3,   0,   0,   1,   3,   0,   0,   2,
+    0,   1,   2,   0,   1,   3,   0,   0,   1,   2,   0,   4,   0,   0,   0,   1,
+    0,   5,   0,   0,   0,   0,   1,   2,   0,   5,   0,   0,   0,   0,   3,   0,
+    0,   3,   0,   0,   3,   0,   0,   2,   0,   2,   0,   3,   0,   0,   3,   0,
+    0,   3,   0,   0,   2,   0,   3,   0,   0,   2,   0,   1,   4,   0,   0,   0,
+    2,   0,   1,   1,   2,   0,   2,   0,   3,   0,   0,   4,   0,   0,   0,   3,
+    0,   0,   3,   0,   0,   2,   0,   1,   2,   0,   2,   0,   2,   0,   5,   0,
+    0,   0,   0,   1,   1,   1,   2,   0,   1,   6,   0,   0,   0,   0,   0,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,
+    0,   1,   1,   1,   5,   0,   0,   0,   0,   1,   1,   1,   1,   1,   4,   0,
+    0,   0,   4,   0,   0,   0,   0,   0,   2,   0,   1,   1,   2,   0,   2,   0,
+    1,   2,   0,   1,   1,   3,   0,   0,   3,   0,   0,   3,   0,   0,   2,   0,
+    1,   1,   1,   1,   1,   2,   0,   2,   0,   2,   0,   0,   1,   2,   0,   1,
+    2,   0,   2,   0,   1,   2,   0,   1,   3,   0,   0,   2,   0,   1,   2,   0,
+    1,   2,   0,   1,   4,   0,   0,   0,   1,   3,   0,   0,   1,   2,   0,   1,
+    1,   2,   0,   1,   1,   1,   1,   1,   1,   4,   0,   0,   0,   1,   2,   0,
+    2,   0,   3,   0,   0,   2,   0,   2,   0,   2,   0,   1,   1,   2,   0,   4,
+    0,   0,   0,   2,   0,   2,   0,   1,   1,   2,   0,   5,   0,   0,   0,   0,
+    2,   0,   1,   1,   1,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,
+    1,   1,   1,   1,   8,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   1,
+    1,   0,   0,   0,   0,   1,   3,   0,   0,   1,   1,   1,   2,   0,   1,   3,
+    0,   0,   1,   1,   1,   1,   1,   4,   0,   0,   0,   1,   1,   5,   0,   0,
+    0,   0,   4,   0,   0,   0,   3,   0,   0,   8,   0,   0,   0,   0,   0,   0,
+    0,   1,   3,   0,   0,   2,   0,   1,   2,   0,   1,   1,   2,   0,   2,   0,
+    4,   0,   0,   0,   2,   0,   1,   2,   0,   2,   0,   1,   3,   0,   0,   1,
+    2,   0,   3,   0,   0,   1,  15,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   1,   2,   0,   1,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   2,   0,   1,   1,   1,   1,   1,   0,   0,   0,   0,   0,   0,   0,   0,
+    4,   0,   0,   0,   1,   5,   0,   0,   0,   0,   1,   6,   0,   0,   0,   0,
+    0,   3,   0,   0,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   2,   0,
+    1,   2,   0,   1,   6,   0,   0,   0,   0,   0,   2,   0,   9,   0,   0,   0,
+    0,   0,   0,   0,   0,   1,   3,   0,   0,   6,   0,   0,   0,   0,   0,   1,
+    1,   1,   2,   0,   2,   0,   1,   3,   0,   0,   4,   0,   0,   0,   3,   0,
+    0,   1,   2,   0,   3,   0,   0,   2,   0,   8,   0,   0,   0,   0,   0,   0,
+    0,   5,   0,   0,   0,   0,   3,   0,   0,   1,   2,   0,   1,   2,   0,   6,
+    0,   0,   0,   0,   0,   5,   0,   0,   0,   0,   1,   5,   0,   0,   0,   0,
+    1,   4,   0,   0,   0,   3,   0,   0,   6,   0,   0,   0,   0,   0,   4,   0,
+    0,   0,   2,   0,   1,   2,   0,   1,  11,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   1,   1,   7,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,
+    0,   0,   1,   1,   2,   0,   2,   0,   1,   2,   0,   0,   2,   0,   1,   1,
+    1,   3,   0,   0,   2,   0,   1,   2,   0,   4,   0,   0,   0,   2,   0,  10,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   1,   4,   0,   0,   0,  10,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   1,   8,   0,   0,   0,   0,   0,   0,   0,   2,   0,   2,   0,
+    2,   0,   2,   0,   3,   0,   0,   1,   2,   0,   1,   2,   0,   4,   0,   0,
+    0,   3,   0,   0,   1,   5,   0,   0,   0,   0,   3,   0,   0,   2,   0,   2,
+    0,   2,   0,   2,   0,   3,   0,   0,   2,   0,   6,   0,   0,   0,   0,   0,
+    4,   0,   0,   0,   2,   0,   2,   0,   2,   0,   1,   2,   0,   1,   1,   0,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+    3,   0,   0,   4,   0,   0,   0,   1,   1,   2,   0,   6,   0,   0,   0,   0,
+    0,   4,   0,   0,   0,   7,   0,   0,   0,   0,   0,   0,  16,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   3,   0,
+    0,   1,   2,   0,   2,   0,   2,   0,   1,   1,   2,   0,   1,   1,   1,   2,
+    0,   2,   0,   1,   4,   0,   0,   0,   4,   0,   0,   0,   2,   0,   2,   0,
+    3,   0,   0,   3,   0,   0,   5,   0,   0,   0,   0,   4,   0,   0,   0,   1,
+    2,   0,   1,   1,   1,   1,   1,   1,   2,   0,   1,   2,   0,   3,   0,   0,
+    3,   0,   0,   4,   0,   0,   0,   1,   4,   0,   0,   0,   4,   0,   0,   0,
+    1,   5,   0,   0,   0,   0,   4,   0,   0,   0,   2,   0,   1,   4,   0,   0,
+    0,   5,   0,   0,   0,   0,   2,   0,   1,   4,   0,   0,   0,   5,   0,   0,
+    0,   0,   1,   1,   3,   0,   0,   3,   0,   0,   1,   2,   0,  10,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   2,   0,   3,   0,   0,   1,   1,   2,   0,
+};
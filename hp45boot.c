@@ -0,0 +1,45 @@
+/* Generated by hp45bootgen from hp45rom.c. Do not edit.
+ * State of the calculator when the firmware first waits for a key,
+ * copied by hp45_init_ready.
+ */
+
+#ifdef HP45_REG_SWAR
+#define BOOT_REG(v) {(v)}
+#elif defined(HP45_REG_PACKED)
+#define BOOT_PAIR(v, i) ((uint8_t)(((uint64_t)(v) >> (8*(i))) & 0xFF))
+#define BOOT_REG(v) {.b = {BOOT_PAIR(v, 0), BOOT_PAIR(v, 1), BOOT_PAIR(v, 2), BOOT_PAIR(v, 3), BOOT_PAIR(v, 4), BOOT_PAIR(v, 5), BOOT_PAIR(v, 6)}}
+#else
+#define BOOT_DIGIT(v, i) ((uint8_t)(((uint64_t)(v) >> (4*(i))) & 0x0F))
+#define BOOT_REG(v) {.nibble = {BOOT_DIGIT(v, 0), BOOT_DIGIT(v, 1), BOOT_DIGIT(v, 2), BOOT_DIGIT(v, 3), BOOT_DIGIT(v, 4), BOOT_DIGIT(v, 5), BOOT_DIGIT(v, 6), BOOT_DIGIT(v, 7), BOOT_DIGIT(v, 8), BOOT_DIGIT(v, 9), BOOT_DIGIT(v, 10), BOOT_DIGIT(v, 11), BOOT_DIGIT(v, 12), BOOT_DIGIT(v, 13)}}
+#endif
+
+static const hp45inst_t BootImage = {
+  .A = BOOT_REG(0x00000000000000),
+  .B = BOOT_REG(0x02009999999999),
+  .CX = BOOT_REG(0x00000000000000),
+  .DY = BOOT_REG(0x00000000000000),
+  .EZ = BOOT_REG(0x00000000000000),
+  .FT = BOOT_REG(0x00000000000000),
+  .M = BOOT_REG(0x90000000000200),
+  .RAM[0] = BOOT_REG(0x00000000000000),
+  .RAM[1] = BOOT_REG(0x00000000000000),
+  .RAM[2] = BOOT_REG(0x00000000000000),
+  .RAM[3] = BOOT_REG(0x00000000000000),
+  .RAM[4] = BOOT_REG(0x00000000000000),
+  .RAM[5] = BOOT_REG(0x00000000000000),
+  .RAM[6] = BOOT_REG(0x00000000000000),
+  .RAM[7] = BOOT_REG(0x00000000000000),
+  .RAM[8] = BOOT_REG(0x00000000000000),
+  .RAM[9] = BOOT_REG(0x00000000000000),
+  .PC = 0x38d,
+  .S = 0x180,
+  .LR = 0x82,
+  .KeyCode = 000,
+  .P = 12,
+  .DataAddr = 8,
+  .ws = 7,
+  .CY = 0,
+  .keydown = 0,
+  .DispOn = 1,
+  .cycles = 248,
+};
@@ -0,0 +1,129 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Boot image generator: powers the calculator on, runs the firmware until it
+ * first waits for a key and prints that state for hp45_init_ready.
+ * Build without a boot image, so hp45_init_ready runs the power-on path:
+ *   cc -DHP45_NO_BOOT_IMAGE -o hp45bootgen hp45bootgen.c hp45sim.c
+ *   ./hp45bootgen > hp45boot.c
+ * The output has CRLF line endings, like the other sources.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+#include "hp45sim.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Print formatted text to stdout with CRLF line endings, like the
+            rest of the sources.
+  * @param  fmt: printf format
+  * @retval None
+  */
+static void out(const char *fmt, ...)
+{
+  char text[1024];
+  const char *p;
+  va_list ap;
+
+  va_start(ap, fmt);
+  vsnprintf(text, sizeof(text), fmt, ap);
+  va_end(ap);
+  for(p = text; *p; p++){
+    if(*p == '\n')putchar('\r');
+    putchar(*p);
+  }
+}
+
+/**
+  * @brief  Print a register as one hex constant, digit 13 first.
+  * @param  name: member name
+  * @param  r: register
+  * @retval None
+  */
+static void print_reg(const char *name, const reg_t *r)
+{
+  int i;
+
+  out("  %s = BOOT_REG(0x", name);
+  for(i = 13; i >= 0; i--){
+    out("%x", HP45_DIGIT(r, i));
+  }
+  out("),\n");
+}
+
+int main(void)
+{
+  static const char *const names[7] = {".A", ".B", ".CX", ".DY", ".EZ", ".FT", ".M"};
+  hp45inst_t instance;
+  char name[16];
+  int i;
+
+#ifdef _WIN32
+  _setmode(_fileno(stdout), _O_BINARY); // out() writes the \r itself
+#endif
+  hp45_init_ready(&instance);
+  out("/* Generated by hp45bootgen from hp45rom.c. Do not edit.\n"
+      " * State of the calculator when the firmware first waits for a key,\n"
+      " * copied by hp45_init_ready.\n"
+      " */\n\n");
+  out("#ifdef HP45_REG_SWAR\n"
+      "#define BOOT_REG(v) {(v)}\n"
+      "#elif defined(HP45_REG_PACKED)\n"
+      "#define BOOT_PAIR(v, i) ((uint8_t)(((uint64_t)(v) >> (8*(i))) & 0xFF))\n"
+      "#define BOOT_REG(v) {.b = {");
+  for(i = 0; i < 7; i++){
+    out("%sBOOT_PAIR(v, %d)", i ? ", " : "", i);
+  }
+  out("}}\n"
+      "#else\n"
+      "#define BOOT_DIGIT(v, i) ((uint8_t)(((uint64_t)(v) >> (4*(i))) & 0x0F))\n"
+      "#define BOOT_REG(v) {.nibble = {");
+  for(i = 0; i < 14; i++){
+    out("%sBOOT_DIGIT(v, %d)", i ? ", " : "", i);
+  }
+  out("}}\n"
+      "#endif\n\n");
+  out("static const hp45inst_t BootImage = {\n");
+  for(i = 0; i < 7; i++){
+    print_reg(names[i], &(&instance.A)[i]);
+  }
+  for(i = 0; i < 10; i++){
+    sprintf(name, ".RAM[%d]", i);
+    print_reg(name, &instance.RAM[i]);
+  }
+  out("  .PC = 0x%03x,\n", instance.PC);
+  out("  .S = 0x%03x,\n", instance.S);
+  out("  .LR = 0x%02x,\n", instance.LR);
+  out("  .KeyCode = 0%02o,\n", instance.KeyCode);
+  out("  .P = %d,\n", instance.P);
+  out("  .DataAddr = %d,\n", instance.DataAddr);
+  out("  .ws = %d,\n", instance.ws);
+  out("  .CY = %d,\n", instance.CY);
+  out("  .keydown = %d,\n", instance.keydown);
+  out("  .DispOn = %d,\n", instance.DispOn);
+  out("  .cycles = %lu,\n", (unsigned long)instance.cycles);
+  out("};\n");
+  return 0;
+}
@@ -0,0 +1,292 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Key press cache: memoizes hp45_press_key. A key press from an idle state
+ * always leads to the same idle state, so the resulting state is recorded
+ * against the state before the press and the key, and identical presses
+ * later become a lookup. Entries are kept in a hash table with a bounded
+ * least recently used list. A cache is not thread safe; use one per thread.
+ * Entries are only valid for the ROM they were recorded with: the cache is
+ * tagged with hp45_rom_fingerprint when created, and the fingerprint seeds
+ * every hash, so entries can never be matched against another ROM image.
+ * Call hp45cache_clear after any other change to the emulated machine.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45snap.h"
+#include "hp45cache.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  uint8_t state[HP45_SNAPSHOT_SIZE];  // state before the press, see state_key
+  uint8_t keycode;
+  uint32_t hash;
+  uint32_t cycles;      // word-cycles the press took
+  int32_t taken;        // return value of hp45_press_key
+  hp45inst_t result;    // state after the press
+  uint32_t chain;       // next entry in the same bucket
+  uint32_t newer, older;// neighbours in the LRU list
+} entry_t;
+
+struct hp45cache{
+  entry_t *entries;
+  uint32_t *buckets;    // first entry of each bucket
+  uint32_t mask;        // number of buckets - 1
+  uint32_t capacity, count;
+  uint32_t newest, oldest;
+  uint32_t rom;         // hp45_rom_fingerprint the entries belong to
+  hp45cache_stats_t stats;
+};
+
+/* Private macros ------------------------------------------------------------*/
+#define NIL   0xFFFFFFFFu   // no entry
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Encode the state a key press depends on: the snapshot without the
+            cycle counter and the key code of the previous key.
+  * @param  instance: HP-45 memory object
+  * @param  state: output, HP45_SNAPSHOT_SIZE bytes
+  * @retval None
+  */
+static void state_key(const hp45inst_t *instance, uint8_t *state)
+{
+  hp45inst_t probe = *instance;
+
+  probe.cycles = 0;
+  probe.KeyCode = 0;
+  hp45_snapshot(&probe, state);
+}
+
+/**
+  * @brief  Hash a state and key (FNV-1a), seeded with the ROM fingerprint.
+  * @param  rom: ROM fingerprint
+  * @param  state: state_key output
+  * @param  keycode: HP-45 native key code
+  * @retval uint32_t: hash
+  */
+static uint32_t hash_of(uint32_t rom, const uint8_t *state, uint8_t keycode)
+{
+  uint32_t hash = rom ^ 2166136261u;
+  int i;
+
+  for(i = 0; i < HP45_SNAPSHOT_SIZE; i++){
+    hash = (hash ^ state[i]) * 16777619u;
+  }
+  return (hash ^ keycode) * 16777619u;
+}
+
+/**
+  * @brief  Take an entry out of the LRU list.
+  * @param  cache: cache
+  * @param  i: entry index
+  * @retval None
+  */
+static void lru_unlink(hp45cache_t *cache, uint32_t i)
+{
+  entry_t *e = &cache->entries[i];
+
+  if(e->newer != NIL)cache->entries[e->newer].older = e->older;
+  else cache->newest = e->older;
+  if(e->older != NIL)cache->entries[e->older].newer = e->newer;
+  else cache->oldest = e->newer;
+}
+
+/**
+  * @brief  Put an entry at the newest end of the LRU list.
+  * @param  cache: cache
+  * @param  i: entry index
+  * @retval None
+  */
+static void lru_push(hp45cache_t *cache, uint32_t i)
+{
+  entry_t *e = &cache->entries[i];
+
+  e->newer = NIL;
+  e->older = cache->newest;
+  if(cache->newest != NIL)cache->entries[cache->newest].newer = i;
+  else cache->oldest = i;
+  cache->newest = i;
+}
+
+/**
+  * @brief  Take an entry out of its hash bucket.
+  * @param  cache: cache
+  * @param  i: entry index
+  * @retval None
+  */
+static void bucket_unlink(hp45cache_t *cache, uint32_t i)
+{
+  uint32_t *link = &cache->buckets[cache->entries[i].hash & cache->mask];
+
+  while(*link != i)link = &cache->entries[*link].chain;
+  *link = cache->entries[i].chain;
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Create an empty cache.
+  * @param  capacity: maximum number of entries, each about 450 bytes
+  * @retval hp45cache_t*: cache, NULL on failure.
+  */
+hp45cache_t *hp45cache_create(uint32_t capacity)
+{
+  hp45cache_t *cache;
+  uint32_t buckets = 1;
+
+  if(!capacity || capacity > 0x40000000u)
+    return NULL;
+  while(buckets < capacity)buckets <<= 1;
+  cache = calloc(1, sizeof(hp45cache_t));
+  if(!cache)
+    return NULL;
+  cache->entries = malloc(capacity*sizeof(entry_t));
+  cache->buckets = malloc(buckets*sizeof(uint32_t));
+  if(!cache->entries || !cache->buckets){
+    hp45cache_destroy(cache);
+    return NULL;
+  }
+  cache->mask = buckets - 1;
+  cache->capacity = capacity;
+  cache->rom = hp45_rom_fingerprint();
+  hp45cache_clear(cache);
+  return cache;
+}
+
+/**
+  * @brief  Free a cache.
+  * @param  cache: cache
+  * @retval None
+  */
+void hp45cache_destroy(hp45cache_t *cache)
+{
+  free(cache->entries);
+  free(cache->buckets);
+  free(cache);
+}
+
+/**
+  * @brief  Drop all entries and reset the counters.
+  * @param  cache: cache
+  * @retval None
+  */
+void hp45cache_clear(hp45cache_t *cache)
+{
+  memset(cache->buckets, 0xFF, (cache->mask + 1)*sizeof(uint32_t));
+  cache->count = 0;
+  cache->newest = cache->oldest = NIL;
+  memset(&cache->stats, 0, sizeof(hp45cache_stats_t));
+}
+
+/**
+  * @brief  Same as hp45_press_key, answered from the cache when the same key
+            was pressed in the same state before. Only the cycle counter and
+            the key code of the previous key are ignored when comparing states.
+            While a profile or trace is attached, the press is always run
+            (and not cached), so every instruction is counted and recorded.
+  * @param  cache: cache
+  * @param  instance: HP-45 memory object, idle
+  * @param  keycode: HP-45 native key code
+  * @retval int32_t: word-cycles run, -1 if the key was not read or the
+                     firmware did not become idle, -2 if the display flashes
+                     an error. Failures are cached too:
+                     they are as deterministic as successful presses.
+  */
+int32_t hp45cache_press_key(hp45cache_t *cache, hp45inst_t *instance, uint8_t keycode)
+{
+  uint8_t state[HP45_SNAPSHOT_SIZE];
+  uint32_t hash, i, cycles;
+  int32_t taken;
+  entry_t *e;
+
+#ifdef HP45_PROFILE
+  if(instance->profile)
+    return hp45_press_key(instance, keycode);
+#endif
+#ifdef HP45_TRACE
+  if(instance->trace)
+    return hp45_press_key(instance, keycode);
+#endif
+  state_key(instance, state);
+  hash = hash_of(cache->rom, state, keycode);
+  for(i = cache->buckets[hash & cache->mask]; i != NIL; i = e->chain){
+    e = &cache->entries[i];
+    if(e->hash == hash && e->keycode == keycode && !memcmp(e->state, state, HP45_SNAPSHOT_SIZE)){
+      cache->stats.hits++;
+      lru_unlink(cache, i);
+      lru_push(cache, i);
+      cycles = instance->cycles;
+#ifdef HP45_DISPLAY_TRACKING
+      e->result.display_gen = instance->display_gen;
+      e->result.display_fn = instance->display_fn;
+      e->result.display_arg = instance->display_arg;
+      e->result.shown_A = instance->shown_A;
+      e->result.shown_B = instance->shown_B;
+      e->result.shown_on = instance->shown_on;
+#endif
+      *instance = e->result;
+      instance->cycles = cycles + e->cycles;
+#ifdef HP45_DISPLAY_TRACKING
+      hp45_display_changed(instance);
+#endif
+      return e->taken;
+    }
+  }
+
+  cache->stats.misses++;
+  cycles = instance->cycles;
+  taken = hp45_press_key(instance, keycode);
+  if(cache->count < cache->capacity){
+    i = cache->count++;
+  }else{
+    i = cache->oldest;
+    lru_unlink(cache, i);
+    bucket_unlink(cache, i);
+    cache->stats.evictions++;
+  }
+  e = &cache->entries[i];
+  memcpy(e->state, state, HP45_SNAPSHOT_SIZE);
+  e->keycode = keycode;
+  e->hash = hash;
+  e->cycles = instance->cycles - cycles;
+  e->taken = taken;
+  e->result = *instance;
+  e->chain = cache->buckets[hash & cache->mask];
+  cache->buckets[hash & cache->mask] = i;
+  lru_push(cache, i);
+  return taken;
+}
+
+/**
+  * @brief  Read the counters.
+  * @param  cache: cache
+  * @param  stats: counters
+  * @retval None
+  */
+void hp45cache_stats(const hp45cache_t *cache, hp45cache_stats_t *stats)
+{
+  *stats = cache->stats;
+  stats->entries = cache->count;
+  stats->capacity = cache->capacity;
+  stats->rom = cache->rom;
+}
@@ -0,0 +1,25 @@
+#ifndef __HP45CACHE_H
+#define __HP45CACHE_H
+
+#include <stdint.h>
+#include "hp45sim.h"
+
+/* Counters since hp45cache_create or the last hp45cache_clear */
+typedef struct{
+  uint64_t hits;          // key presses answered from the cache
+  uint64_t misses;        // key presses executed
+  uint64_t evictions;     // least recently used entries dropped to make room
+  uint32_t entries;       // entries held
+  uint32_t capacity;      // maximum number of entries
+  uint32_t rom;           // hp45_rom_fingerprint of the ROM the entries belong to
+} hp45cache_stats_t;
+
+typedef struct hp45cache hp45cache_t;
+
+hp45cache_t *hp45cache_create(uint32_t);
+void hp45cache_destroy(hp45cache_t*);
+void hp45cache_clear(hp45cache_t*);
+int32_t hp45cache_press_key(hp45cache_t*, hp45inst_t*, uint8_t);
+void hp45cache_stats(const hp45cache_t*, hp45cache_stats_t*);
+
+#endif /* __HP45CACHE_H */
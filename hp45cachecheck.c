@@ -0,0 +1,132 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Key press cache check: presses short random key sequences from power-on,
+ * each key once through hp45cache_press_key and once through hp45_press_key
+ * on a twin calculator, and compares the results and the full state (cycle
+ * count included) after every key. The sequences share prefixes, so most
+ * presses are cache hits; a large cache and one small enough to evict all
+ * the time are checked. Exits 1 on the first difference.
+ *   cc -O2 -o hp45cachecheck hp45cachecheck.c hp45cache.c hp45snap.c hp45utils.c hp45sim.c
+ *   ./hp45cachecheck [presses] [seed]
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45snap.h"
+#include "hp45cache.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     12
+#define RUN_MAX       6       // keys pressed before starting over, at most
+
+/* Private variables ---------------------------------------------------------*/
+/* 4 5 6 ENTER + * / CHS ->P LN 1/X CLX: few enough that sequences repeat */
+static const uint8_t Keys[KEY_COUNT] = {
+  024, 023, 022, 076, 026, 036, 046, 073, 054, 004, 006, 070,
+};
+static const uint32_t Capacities[] = {4096, 8};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Press keys through a cache and on a cold twin, and compare.
+  * @param  capacity: cache entries
+  * @param  presses: number of keys to press
+  * @param  seed: random seed, not 0
+  * @retval int: 0 on success, 1 on a difference, 2 on a setup error.
+  */
+static int check(uint32_t capacity, unsigned long presses, uint32_t seed)
+{
+  static hp45inst_t cached, cold;
+  hp45cache_t *cache = hp45cache_create(capacity);
+  hp45cache_stats_t stats;
+  uint8_t a[HP45_SNAPSHOT_SIZE], b[HP45_SNAPSHOT_SIZE], key;
+  uint32_t x = seed;
+  unsigned long n;
+  int32_t r_cached, r_cold;
+
+  if(!cache){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+  for(n = 0; n < presses; n++){
+    if(n % RUN_MAX == 0 || next_random(&x) % 4 == 0){
+      hp45_init_ready(&cached);
+      hp45_init_ready(&cold);
+    }
+    key = Keys[next_random(&x) % KEY_COUNT];
+    r_cached = hp45cache_press_key(cache, &cached, key);
+    r_cold = hp45_press_key(&cold, key);
+    hp45_snapshot(&cached, a);
+    hp45_snapshot(&cold, b);
+    if(r_cached != r_cold || memcmp(a, b, HP45_SNAPSHOT_SIZE)){
+      hp45cache_stats(cache, &stats);
+      printf("FAIL: capacity %lu, press %lu (key %03o, %llu hits so far) returned %ld from the cache, %ld cold\n",
+             (unsigned long)capacity, n, key, (unsigned long long)stats.hits, (long)r_cached, (long)r_cold);
+      printf("  cached pc %03x cycles %lu, cold pc %03x cycles %lu\n", cached.PC, (unsigned long)cached.cycles,
+             cold.PC, (unsigned long)cold.cycles);
+      hp45cache_destroy(cache);
+      return 1;
+    }
+  }
+  hp45cache_stats(cache, &stats);
+  hp45cache_destroy(cache);
+  if(!stats.hits){
+    printf("FAIL: capacity %lu, no cache hits\n", (unsigned long)capacity);
+    return 1;
+  }
+  printf("ok: capacity %lu, %lu presses, %llu hits, %llu misses, %llu evictions\n", (unsigned long)capacity,
+         presses, (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+         (unsigned long long)stats.evictions);
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  unsigned long presses = argc > 1 ? strtoul(argv[1], NULL, 0) : 20000;
+  uint32_t seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1;
+  unsigned i;
+  int result;
+
+  if(!seed)seed = 1;
+  for(i = 0; i < sizeof(Capacities)/sizeof(Capacities[0]); i++){
+    result = check(Capacities[i], presses, seed);
+    if(result)
+      return result;
+  }
+  return 0;
+}
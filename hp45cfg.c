@@ -0,0 +1,1124 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* ROM static analysis: follows every path the firmware can take from
+ * power-on, decoding words as hp45_run does, and reports the subroutine call
+ * map, ROM bank transitions, loops and a worst-case cycle estimate per key,
+ * or prints the control-flow graph for Graphviz.
+ *   cc -O2 -o hp45cfg hp45cfg.c hp45utils.c hp45sim.c
+ *   ./hp45cfg [-n bound] [-l test=bound ...] > report.txt
+ *   ./hp45cfg -g | dot -Tsvg > rom.svg
+ * The walk tracks the return address, P, the status flags (but s0, the
+ * keyboard) and whether the carry is known, all of which only change by
+ * words that set them, so flag and pointer tests go one way and returns go
+ * only where they can. Digits in the registers are not tracked: a test on
+ * them goes both ways, and a loop ending on one runs a number of times
+ * guessed from the field it tests (see Bound), or as given by -l for the
+ * loop with the exit test at that address (from the loop list).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  uint16_t pc;
+  uint16_t s;       // status flags s1-s11; s0 is the keyboard, never known
+  uint8_t lr;       // return address left by the last jsb
+  uint8_t cy;       // CY_*: carry left by the previous word
+  uint8_t p;        // pointer register
+} state_t;
+
+typedef struct{
+  uint16_t header;  // lowest address the loop is entered at
+  uint16_t words;   // addresses in the loop, inner loops included
+  uint16_t test;    // exit branch the bound comes from, NO_TEST if none
+  uint16_t bound;   // iterations assumed
+  uint8_t depth;    // nesting depth, 1 outermost
+  uint8_t kind;     // L_*
+  uint8_t exits;    // 0 if no path leaves it: it is only reached through a branch that cannot go that way
+} loop_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define CY_ZERO     0
+#define CY_ONE      1
+#define CY_MAYBE    2
+#define STATE_KEY(st) ((uint64_t)(st).pc | (uint64_t)(st).lr<<11 | (uint64_t)(st).cy<<19 \
+                       | (uint64_t)(st).p<<21 | (uint64_t)(st).s<<25)
+#define HASH_EMPTY  UINT64_MAX
+#define SUCC_MAX    40    // successors of one word, the key jump has one per key
+#define LOOPS_MAX   4096
+#define CALLERS_MAX 64    // jsb sites listed per subroutine
+#define NO_TEST     0xFFFF
+#define NO_PATH     (-1.0)
+#define NOT_SOLVED  (-2.0)
+
+#define OPCODE_TEST_KEY 0x014 // if s0 = 1: the firmware polls the keyboard
+
+/* Edge kinds */
+enum{
+  E_NEXT,     // next word
+  E_BRANCH,   // conditional branch taken
+  E_CALL,     // jsb
+  E_RETURN,   // return
+  E_ROM,      // ROM select
+  E_KEY,      // keys -> rom address
+};
+
+/* Loop kinds by exit test; P and flag tests always go one way */
+enum{
+  L_DIGIT,    // arithmetic on one digit (p, xs, s): at most 10 values
+  L_EXPONENT, // arithmetic on the two exponent digits (x): at most 100 values
+  L_ARITH,    // arithmetic on a wider field: a quotient digit, at most 10
+  L_OTHER,    // no exit test on a digit, bound from -n
+  L_KINDS
+};
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t ROM[2048] = {
+  #include "hp45rom.c"
+};
+
+static const char *const KeyNames[] = {
+  "1/X", "LN", "E^X", "FIX", "F", "X^2", "->P", "SIN", "COS", "TAN",
+  "X<>Y", "RDN", "STO", "RCL", "%", "ENTER", "CHS", "EEX", "CLX",
+  "-", "7", "8", "9", "+", "4", "5", "6", "*", "1", "2", "3",
+  "/", "0", ".", "S+",
+};
+#define KEYS (sizeof(KeyNames)/sizeof(KeyNames[0]))
+
+static const char *const KindName[L_KINDS] = {
+  "digit", "exponent", "arith", "other",
+};
+
+static uint8_t KeyCode[KEYS];
+static uint8_t Defined[2048];
+static unsigned Bound[L_KINDS] = {10, 100, 10, 16};
+static uint16_t TestBound[2048];  // iterations of the loop with the exit test at an address, from -l; 0 for Bound
+
+/* state graph: node i has edges First[i] to First[i+1]-1 */
+static uint64_t *HashKey;  // open addressing, STATE_KEY -> node
+static int32_t *HashNode;
+static size_t HashSize;
+static state_t *Node;
+static uint32_t *First;
+static int32_t *EdgeTo;
+static uint8_t *EdgeKind;
+static int NNodes;
+
+/* loop solver */
+static int32_t *Region;   // region of each node, see solve
+static int32_t *Cut;      // region of the loop whose iterations end at a node
+static int32_t *Entry;    // solve that enters a loop at a node, by its Visits stamp
+static int32_t *Visit, *Index, *Low, *CompOf;
+static uint8_t *OnStack;
+static int Regions, Visits;
+static loop_t Loops[LOOPS_MAX];
+static int NLoops, RecordLoops;
+static double *KeyCost;   // key_cost of each entry node, NOT_SOLVED until asked
+
+/* worst case per key jump site and key */
+static uint16_t Site[8];
+static double Worst[8][KEYS];
+static int Sites;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Address of the next word, wrapping within the 256-word ROM page.
+  */
+static uint16_t next_pc(uint16_t pc)
+{
+  return (pc & 0xF00) | ((pc+1) & 0xFF);
+}
+
+/**
+  * @brief  Address of the previous word within the ROM page.
+  */
+static uint16_t prev_pc(uint16_t pc)
+{
+  return (pc & 0xF00) | ((pc-1) & 0xFF);
+}
+
+/**
+  * @brief  Carry left by an arithmetic (type 2) word.
+  * @param  opcode: 10-bit ROM word
+  * @retval uint8_t: CY_*
+  */
+static uint8_t carry_out(uint16_t opcode)
+{
+  switch(opcode>>5){
+    case 1: case 4: case 6: case 8: case 9: case 12: case 17: case 18:
+    case 20: case 22: case 23: case 25: case 29:
+      return CY_ZERO;  // clear, copy, exchange, shift
+    case 7:
+      return CY_ONE;   // 0-C-1->C
+    default:
+      return CY_MAYBE;
+  }
+}
+
+/**
+  * @brief  Node of a state.
+  * @param  s: state
+  * @retval int32_t: node, -1 if the state has not been reached.
+  */
+static int32_t node_of(state_t s)
+{
+  const uint64_t key = STATE_KEY(s);
+  size_t i = (key*0x9E3779B97F4A7C15ull) >> 20 & (HashSize - 1);
+
+  for(; HashKey[i] != HASH_EMPTY; i = (i + 1) & (HashSize - 1)){
+    if(HashKey[i] == key)
+      return HashNode[i];
+  }
+  return -1;
+}
+
+/**
+  * @brief  Enter a new state in the hash table, doubling it when half full.
+  * @param  s: state, not reached before
+  * @param  node: its node
+  * @retval int: 0 on success, -1 out of memory.
+  */
+static int add_node(state_t s, int32_t node)
+{
+  size_t i;
+
+  if((size_t)node*2 >= HashSize){
+    uint64_t *keys = HashKey;
+    int32_t *nodes = HashNode;
+    const size_t size = HashSize;
+
+    HashSize = size ? size*2 : 1<<16;
+    HashKey = malloc(HashSize*sizeof(uint64_t));
+    HashNode = malloc(HashSize*sizeof(int32_t));
+    if(!HashKey || !HashNode)
+      return -1;
+    memset(HashKey, 0xFF, HashSize*sizeof(uint64_t));
+    for(i = 0; i < size; i++){
+      if(keys[i] != HASH_EMPTY)add_node(Node[nodes[i]], nodes[i]);
+    }
+    free(keys);
+    free(nodes);
+  }
+  i = (STATE_KEY(s)*0x9E3779B97F4A7C15ull) >> 20 & (HashSize - 1);
+  while(HashKey[i] != HASH_EMPTY)i = (i + 1) & (HashSize - 1);
+  HashKey[i] = STATE_KEY(s);
+  HashNode[i] = node;
+  return 0;
+}
+
+/**
+  * @brief  States that can follow a state, as hp45_run would move PC, LR,
+            P and the flags.
+  * @param  s: state
+  * @param  out: successors, SUCC_MAX
+  * @param  kind: E_* of each successor
+  * @retval int: number of successors, 0 for an undefined word.
+  */
+static int successors(state_t s, state_t *out, uint8_t *kind)
+{
+  const uint16_t opcode = ROM[s.pc];
+  const uint16_t page = s.pc & 0xF00, next = next_pc(s.pc);
+  const uint8_t o = opcode>>2, N = o>>4;
+  state_t t = s;
+  unsigned k;
+  int n = 0;
+
+  if(!Defined[s.pc])
+    return 0;
+  t.cy = CY_ZERO;
+  switch(opcode & 0x003){
+    case 1: // jsb
+      t.pc = page | o;
+      t.lr = next & 0xFF;
+      out[0] = t;
+      kind[0] = E_CALL;
+      return 1;
+    case 3: // conditional branch, taken when the carry is clear
+      if(s.cy != CY_ONE){
+        t.pc = page | o;
+        out[n] = t;
+        kind[n++] = E_BRANCH;
+      }
+      if(s.cy != CY_ZERO){
+        t.pc = next;
+        out[n] = t;
+        kind[n++] = E_NEXT;
+      }
+      return n;
+  }
+  t.pc = next;
+  switch(hp45_opcode_type(opcode)){
+    case 2:
+      t.cy = carry_out(opcode);
+      break;
+    case 3:
+      switch((o>>2) & 0x03){
+        case 0: if(N)t.s |= 1<<N; break;
+        case 1: t.cy = !N ? CY_MAYBE : (s.s>>N) & 1 ? CY_ONE : CY_ZERO; break;
+        case 2: t.s &= ~(1<<N); break;
+        case 3: t.s = 0; break;
+      }
+      break;
+    case 4:
+      switch((o>>2) & 0x03){
+        case 0: t.p = N; break;
+        case 1: t.p = (s.p - 1) & 0x0F; break;
+        case 2: t.cy = s.p == N ? CY_ONE : CY_ZERO; break;
+        case 3: t.p = (s.p + 1) & 0x0F; break;
+      }
+      break;
+    case 5:
+      if(((o>>2) & 0x03) == 1)t.p = (s.p - 1) & 0x0F;  // n -> c[p]
+      break;
+    case 6:
+      switch((o>>3) & 0x03){
+        case 0:
+          t.pc = (uint16_t)((o>>5)<<8) | (next & 0xFF);
+          out[0] = t;
+          kind[0] = E_ROM;
+          return 1;
+        case 1:
+          t.pc = page | s.lr;
+          out[0] = t;
+          kind[0] = E_RETURN;
+          return 1;
+        case 2:
+          for(k = 0; k < KEYS; k++){
+            t.pc = page | KeyCode[k];
+            out[k] = t;
+            kind[k] = E_KEY;
+          }
+          return KEYS;
+      }
+      break;
+  }
+  out[0] = t;
+  kind[0] = E_NEXT;
+  return 1;
+}
+
+/**
+  * @brief  Find every state reachable from power-on and build the state graph.
+  * @param  None
+  * @retval int: 0 on success, -1 out of memory.
+  */
+static int explore(void)
+{
+  state_t succ[SUCC_MAX];
+  uint8_t kind[SUCC_MAX];
+  size_t cap = 4096, edges = 0, edge_cap = 16384;
+  int i, j, n;
+
+  Node = malloc(cap*sizeof(state_t));
+  if(!Node)
+    return -1;
+  // breadth first from power-on, all registers 0; Node doubles as the queue
+  Node[0] = (state_t){0, 0, 0, CY_ZERO, 0};
+  NNodes = 1;
+  if(add_node(Node[0], 0))
+    return -1;
+  for(i = 0; i < NNodes; i++){
+    n = successors(Node[i], succ, kind);
+    for(j = 0; j < n; j++){
+      if(node_of(succ[j]) >= 0)continue;
+      if((size_t)NNodes == cap){
+        cap *= 2;
+        Node = realloc(Node, cap*sizeof(state_t));
+        if(!Node)
+          return -1;
+      }
+      Node[NNodes] = succ[j];
+      if(add_node(succ[j], NNodes++))
+        return -1;
+    }
+  }
+
+  First = malloc((NNodes + 1)*sizeof(uint32_t));
+  EdgeTo = malloc(edge_cap*sizeof(int32_t));
+  EdgeKind = malloc(edge_cap);
+  if(!First || !EdgeTo || !EdgeKind)
+    return -1;
+  for(i = 0; i < NNodes; i++){
+    First[i] = edges;
+    n = successors(Node[i], succ, kind);
+    if(edges + n > edge_cap){
+      edge_cap *= 2;
+      EdgeTo = realloc(EdgeTo, edge_cap*sizeof(int32_t));
+      EdgeKind = realloc(EdgeKind, edge_cap);
+      if(!EdgeTo || !EdgeKind)
+        return -1;
+    }
+    for(j = 0; j < n; j++){
+      EdgeTo[edges] = node_of(succ[j]);
+      EdgeKind[edges++] = kind[j];
+    }
+  }
+  First[NNodes] = edges;
+
+  Region = calloc(NNodes, sizeof(int32_t));
+  Cut = calloc(NNodes, sizeof(int32_t));
+  Entry = calloc(NNodes, sizeof(int32_t));
+  Visit = calloc(NNodes, sizeof(int32_t));
+  Index = malloc(NNodes*sizeof(int32_t));
+  Low = malloc(NNodes*sizeof(int32_t));
+  CompOf = malloc(NNodes*sizeof(int32_t));
+  OnStack = calloc(NNodes, 1);
+  KeyCost = malloc(NNodes*sizeof(double));
+  if(!Region || !Cut || !Entry || !Visit || !Index || !Low || !CompOf || !OnStack || !KeyCost)
+    return -1;
+  for(i = 0; i < NNodes; i++)KeyCost[i] = NOT_SOLVED;
+  return 0;
+}
+
+/**
+  * @brief  Classify a loop by the branches that leave it.
+  * @param  members: nodes of the loop
+  * @param  count: number of nodes
+  * @param  region: region of the loop
+  * @param  test: output, address of the exit branch used, NO_TEST if none
+  * @retval uint8_t: L_*, the one with the smallest bound if there are
+                     several: the loop ends at the first that exits, and
+                     cycles that miss it are inner loops.
+  */
+static uint8_t loop_kind(const int32_t *members, int count, int region, uint16_t *test)
+{
+  uint8_t kind = L_OTHER, k;
+  uint32_t e;
+  int i, in, out;
+
+  *test = NO_TEST;
+  for(i = 0; i < count; i++){
+    const uint16_t pc = Node[members[i]].pc;
+    const uint16_t prev = ROM[prev_pc(pc)];
+
+    if((ROM[pc] & 0x003) != 3)continue;
+    in = out = 0;
+    for(e = First[members[i]]; e < First[members[i] + 1]; e++){
+      if(Region[EdgeTo[e]] == region)in = 1;
+      else out = 1;
+    }
+    if(!in || !out)continue;
+    k = L_OTHER;
+    if(hp45_opcode_type(prev) == 2){
+      switch((prev>>2) & 7){
+        case 0: case 6: case 7: k = L_DIGIT; break;
+        case 2: k = L_EXPONENT; break;
+        default: k = L_ARITH; break;
+      }
+    }
+    if(*test == NO_TEST || Bound[k] < Bound[kind]){
+      kind = k;
+      *test = pc;
+    }
+  }
+  return kind;
+}
+
+/**
+  * @brief  Add a loop to Loops, or merge it with the one of the same exit
+            test (or head, without one) met from another key or state.
+  * @param  members: nodes of the loop
+  * @param  count: number of nodes
+  * @param  header: address of the head
+  * @param  test: exit branch, see loop_kind
+  * @param  bound: iterations assumed
+  * @param  depth: nesting depth
+  * @param  kind: L_*
+  * @param  exits: 0 if the loop has no exit
+  * @retval None
+  */
+static void record_loop(const int32_t *members, int count, uint16_t header, uint16_t test, unsigned bound,
+                        int depth, uint8_t kind, uint8_t exits)
+{
+  static uint8_t seen[2048];
+  uint16_t words = 0;
+  int i;
+
+  memset(seen, 0, sizeof(seen));
+  for(i = 0; i < count; i++){
+    if(!seen[Node[members[i]].pc]++)words++;
+  }
+  for(i = 0; i < NLoops; i++){
+    if(test != NO_TEST ? Loops[i].test == test : Loops[i].test == NO_TEST && Loops[i].header == header)break;
+  }
+  if(i == NLoops){
+    if(NLoops == LOOPS_MAX)
+      return;
+    Loops[NLoops++] = (loop_t){header, words, test, (uint16_t)bound, (uint8_t)depth, kind, exits};
+    return;
+  }
+  if(header < Loops[i].header)Loops[i].header = header;
+  if(depth < Loops[i].depth)Loops[i].depth = depth;
+  if(words > Loops[i].words)Loops[i].words = words;
+  Loops[i].exits |= exits;
+}
+
+/**
+  * @brief  Longest run through a region of the state graph, in word-cycles.
+            The region is split into strongly connected components; each one
+            with a cycle is a loop, solved recursively. A loop is cut at its
+            exit test: edges into the test end an iteration, and it runs
+            once to the test, bound times from the test back to it, then
+            once to an exit.
+  * @param  roots: entry nodes of the region, then the cut nodes of a loop
+  * @param  entries: number of entry nodes
+  * @param  cuts: number of cut nodes, 0 if the region is not a loop
+  * @param  region: Region of the nodes in it
+  * @param  bound: iterations of a loop
+  * @param  depth: nesting depth, for the loop list
+  * @retval double: longest path from an entry to an edge leaving the region,
+                    NO_PATH if the region has no exit. Paths into a loop
+                    that never exits are left out: such a loop is reached
+                    only through a branch that cannot go that way, since
+                    the firmware always returns to the keyboard.
+  */
+static double solve(const int32_t *roots, int entries, int cuts, int region, unsigned bound, int depth)
+{
+  int32_t *members, *comp_start, *root, *stack, *dfs, *inner;
+  uint32_t *dfs_edge;
+  double *cost, *to_exit, *to_back, first_exit = NO_PATH, first_back = NO_PATH, iter_exit = NO_PATH, iter_back = NO_PATH;
+  int n = 0, comps = 0, sp = 0, dp = 0, index = 0, visit = ++Visits, c, i, cap = 64, ninner, nentry, sub;
+  int32_t v, w;
+  uint32_t e;
+
+  members = malloc(cap*sizeof(int32_t));
+  stack = malloc(cap*sizeof(int32_t));
+  dfs = malloc(cap*sizeof(int32_t));
+  dfs_edge = malloc(cap*sizeof(uint32_t));
+  comp_start = malloc((cap + 1)*sizeof(int32_t));
+  root = malloc(cap*sizeof(int32_t));
+  if(!members || !stack || !dfs || !dfs_edge || !comp_start || !root){
+    fprintf(stderr, "hp45cfg: out of memory\n");
+    exit(2);
+  }
+
+  // iterative Tarjan from every root; components come out in reverse
+  // topological order
+  #define GROW() do{ \
+      if(n >= cap || sp >= cap || dp >= cap || comps >= cap){ \
+        cap *= 2; \
+        members = realloc(members, cap*sizeof(int32_t)); \
+        stack = realloc(stack, cap*sizeof(int32_t)); \
+        dfs = realloc(dfs, cap*sizeof(int32_t)); \
+        dfs_edge = realloc(dfs_edge, cap*sizeof(uint32_t)); \
+        comp_start = realloc(comp_start, (cap + 1)*sizeof(int32_t)); \
+        root = realloc(root, cap*sizeof(int32_t)); \
+        if(!members || !stack || !dfs || !dfs_edge || !comp_start || !root){ \
+          fprintf(stderr, "hp45cfg: out of memory\n"); \
+          exit(2); \
+        } \
+      } \
+    }while(0)
+  #define PUSH(x) do{ \
+      GROW(); \
+      Visit[x] = visit; \
+      Index[x] = Low[x] = index++; \
+      stack[sp++] = (x); \
+      OnStack[x] = 1; \
+      dfs[dp] = (x); \
+      dfs_edge[dp++] = First[x]; \
+    }while(0)
+  for(i = 0; i < entries + cuts; i++){
+    if(Visit[roots[i]] == visit)continue;
+    PUSH(roots[i]);
+    while(dp){
+      v = dfs[dp - 1];
+      if(dfs_edge[dp - 1] < First[v + 1]){
+        w = EdgeTo[dfs_edge[dp - 1]++];
+        if(Region[w] != region || Cut[w] == region)continue;
+        if(Visit[w] != visit)
+          PUSH(w);
+        else if(OnStack[w] && Index[w] < Low[v])
+          Low[v] = Index[w];
+        continue;
+      }
+      dp--;
+      if(dp && Low[v] < Low[dfs[dp - 1]])
+        Low[dfs[dp - 1]] = Low[v];
+      if(Low[v] == Index[v]){
+        GROW();
+        comp_start[comps] = n;
+        root[comps++] = v;
+        do{
+          w = stack[--sp];
+          OnStack[w] = 0;
+          GROW();
+          members[n++] = w;
+        }while(w != v);
+      }
+    }
+  }
+  comp_start[comps] = n;
+  #undef PUSH
+  #undef GROW
+
+  cost = malloc(comps*sizeof(double));
+  to_exit = malloc(comps*sizeof(double));
+  to_back = malloc(comps*sizeof(double));
+  inner = malloc((n + 1)*sizeof(int32_t));
+  if(!cost || !to_exit || !to_back || !inner){
+    fprintf(stderr, "hp45cfg: out of memory\n");
+    exit(2);
+  }
+  // loops inside: a component of more than one node, or one that jumps to
+  // itself. A loop is entered at the roots in it and where another
+  // component leads into it.
+  for(c = 0; c < comps; c++){
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++)CompOf[members[w]] = c;
+  }
+  for(i = 0; i < entries + cuts; i++)Entry[roots[i]] = visit;
+  for(i = 0; i < n; i++){
+    for(e = First[members[i]]; e < First[members[i] + 1]; e++){
+      w = EdgeTo[e];
+      if(Region[w] == region && Cut[w] != region && CompOf[w] != CompOf[members[i]])Entry[w] = visit;
+    }
+  }
+  for(c = 0; c < comps; c++){
+    int loop = comp_start[c + 1] - comp_start[c] > 1;
+    uint16_t test;
+    uint8_t kind;
+    unsigned iterations;
+
+    v = root[c];
+    for(e = First[v]; !loop && e < First[v + 1]; e++){
+      loop = EdgeTo[e] == v && Cut[v] != region;
+    }
+    if(!loop){
+      cost[c] = 1;
+      continue;
+    }
+    ninner = 0;
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++){
+      if(Entry[members[w]] == visit)inner[ninner++] = members[w];
+    }
+    nentry = ninner;
+    sub = ++Regions;
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++)Region[members[w]] = sub;
+    kind = loop_kind(members + comp_start[c], comp_start[c + 1] - comp_start[c], sub, &test);
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++){
+      if(test == NO_TEST ? members[w] == v : Node[members[w]].pc == test){
+        Cut[members[w]] = sub;
+        inner[ninner++] = members[w];
+      }
+    }
+    iterations = test != NO_TEST && TestBound[test] ? TestBound[test] : Bound[kind];
+    cost[c] = solve(inner, nentry, ninner - nentry, sub, iterations, depth + 1);
+    if(RecordLoops)
+      record_loop(members + comp_start[c], comp_start[c + 1] - comp_start[c], Node[inner[0]].pc, test, iterations,
+                  depth + 1, kind, cost[c] >= 0);
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++)Region[members[w]] = region;
+  }
+  // the loops solved inside reused CompOf
+  for(c = 0; c < comps; c++){
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++)CompOf[members[w]] = c;
+  }
+
+  // longest paths, successors first
+  for(c = 0; c < comps; c++){
+    double exit_len = NO_PATH, back_len = NO_PATH;
+
+    for(w = comp_start[c]; w < comp_start[c + 1]; w++){
+      v = members[w];
+      for(e = First[v]; e < First[v + 1]; e++){
+        const int32_t t = EdgeTo[e];
+
+        if(Region[t] != region){
+          if(exit_len < 0)exit_len = 0;
+        }else if(Cut[t] == region){
+          if(back_len < 0)back_len = 0;
+        }else if(CompOf[t] != c){
+          if(to_exit[CompOf[t]] > exit_len)exit_len = to_exit[CompOf[t]];
+          if(to_back[CompOf[t]] > back_len)back_len = to_back[CompOf[t]];
+        }
+      }
+    }
+    to_exit[c] = exit_len < 0 || cost[c] < 0 ? NO_PATH : cost[c] + exit_len;
+    to_back[c] = back_len < 0 || cost[c] < 0 ? NO_PATH : cost[c] + back_len;
+  }
+
+  for(i = 0; i < entries + cuts; i++){
+    c = CompOf[roots[i]];
+    if(i < entries){
+      if(to_exit[c] > first_exit)first_exit = to_exit[c];
+      if(to_back[c] > first_back)first_back = to_back[c];
+    }else{
+      if(to_exit[c] > iter_exit)iter_exit = to_exit[c];
+      if(to_back[c] > iter_back)iter_back = to_back[c];
+    }
+  }
+  // from the test with no way out of the loop, the path cannot be taken
+  if(cuts && first_back >= 0 && iter_exit >= 0){
+    if(first_back + bound*(iter_back < 0 ? 0 : iter_back) + iter_exit > first_exit)
+      first_exit = first_back + bound*(iter_back < 0 ? 0 : iter_back) + iter_exit;
+  }
+  free(members);
+  free(stack);
+  free(dfs);
+  free(dfs_edge);
+  free(comp_start);
+  free(root);
+  free(cost);
+  free(to_exit);
+  free(to_back);
+  free(inner);
+  return first_exit;
+}
+
+/**
+  * @brief  Worst case of one key: the longest run from the key entry state
+            to the next key poll.
+  * @param  entry: node the key jump leads to
+  * @retval double: word-cycles, NO_PATH if no key poll is reached.
+  */
+static double key_cost(int32_t entry)
+{
+  const int region = ++Regions;
+  int32_t *queue;
+  int head = 0, tail = 0;
+  uint32_t e;
+
+  // key jumps from different return addresses often lead to the same state
+  if(KeyCost[entry] != NOT_SOLVED)
+    return KeyCost[entry];
+  queue = malloc(NNodes*sizeof(int32_t));
+  if(!queue){
+    fprintf(stderr, "hp45cfg: out of memory\n");
+    exit(2);
+  }
+  Region[entry] = region;
+  queue[tail++] = entry;
+  while(head < tail){
+    const int32_t v = queue[head++];
+
+    for(e = First[v]; e < First[v + 1]; e++){
+      const int32_t w = EdgeTo[e];
+
+      if(Region[w] == region || EdgeKind[e] == E_KEY || ROM[Node[w].pc] == OPCODE_TEST_KEY)continue;
+      Region[w] = region;
+      queue[tail++] = w;
+    }
+  }
+  free(queue);
+  KeyCost[entry] = solve(&entry, 1, 0, region, 0, 0);
+  return KeyCost[entry];
+}
+
+/**
+  * @brief  Print the control-flow graph of the reachable words for Graphviz:
+            one node per basic block, one cluster per ROM.
+  * @param  None
+  * @retval None
+  */
+static void print_dot(void)
+{
+  static const char *const Style[] = {
+    "",                                           // E_NEXT
+    " [color=blue]",                              // E_BRANCH
+    " [style=dashed, label=\"jsb\"]",             // E_CALL
+    " [style=dotted, label=\"ret\"]",             // E_RETURN
+    " [color=red, penwidth=2, label=\"rom\"]",    // E_ROM
+    " [color=darkgreen, label=\"key\"]",          // E_KEY
+  };
+  static uint8_t edge[2048][2048];  // E_* bit mask of the edges between two addresses
+  uint8_t reach[2048] = {0}, leader[2048], falls[2048];
+  uint16_t preds[2048] = {0}, only_pred[2048], pc, to, end;
+  char text[24];
+  int i, rom, k;
+  uint32_t e;
+
+  for(i = 0; i < NNodes; i++){
+    reach[Node[i].pc] = 1;
+    for(e = First[i]; e < First[i + 1]; e++){
+      edge[Node[i].pc][Node[EdgeTo[e]].pc] |= 1<<EdgeKind[e];
+    }
+  }
+  for(pc = 0; pc < 2048; pc++){
+    falls[pc] = 1;
+    for(to = 0; to < 2048; to++){
+      if(!edge[pc][to])continue;
+      if(edge[pc][to] != 1<<E_NEXT || to != next_pc(pc))falls[pc] = 0;
+      preds[to]++;
+      only_pred[to] = pc;
+    }
+  }
+  // a block starts where control comes from anywhere but the word before
+  for(pc = 0; pc < 2048; pc++){
+    leader[pc] = reach[pc] && (pc == 0 || preds[pc] != 1 || only_pred[pc] != prev_pc(pc) || !falls[prev_pc(pc)]);
+  }
+
+  printf("digraph hp45rom {\n");
+  printf("  node [shape=box, fontname=\"monospace\", fontsize=9];\n");
+  for(rom = 0; rom < 8; rom++){
+    printf("  subgraph cluster_rom%d {\n    label=\"rom %d\";\n", rom, rom);
+    for(pc = rom<<8; pc < (rom + 1)<<8; pc++){
+      if(!leader[pc])continue;
+      printf("    b%03x [label=\"", pc);
+      for(to = pc;; to = next_pc(to)){
+        hp45_disasm(ROM[to], text);
+        printf("%03x  %s\\l", to, text);
+        if(!falls[to] || leader[next_pc(to)])break;
+      }
+      printf("\"];\n");
+    }
+    printf("  }\n");
+  }
+  for(pc = 0; pc < 2048; pc++){
+    if(!leader[pc])continue;
+    for(end = pc; falls[end] && !leader[next_pc(end)]; end = next_pc(end))
+      ;
+    for(to = 0; to < 2048; to++){
+      for(k = E_NEXT; k <= E_KEY; k++){
+        if(edge[end][to] & (1<<k))printf("  b%03x -> b%03x%s;\n", pc, to, Style[k]);
+      }
+    }
+  }
+  printf("}\n");
+}
+
+/**
+  * @brief  Print the subroutine call map: for every jsb target, its callers,
+            the words reached from it until it returns, the ROMs they are in
+            and the subroutines it calls.
+  * @param  None
+  * @retval None
+  */
+static void print_calls(void)
+{
+  static uint16_t callers[2048][CALLERS_MAX];
+  static uint8_t ncallers[2048], seen_pc[2048];
+  static uint32_t ret_first[2049], ret_pos[2048];
+  int32_t *queue = malloc(NNodes*sizeof(int32_t)), *mark = calloc(NNodes, sizeof(int32_t));
+  int32_t *ret_node = malloc(NNodes*sizeof(int32_t));
+  uint16_t pc, to;
+  uint32_t e, r;
+  int i, j, head, tail, returns, words, stamp = 0;
+  unsigned banks;
+  uint8_t calls[2048];
+
+  if(!queue || !mark || !ret_node){
+    fprintf(stderr, "hp45cfg: out of memory\n");
+    exit(2);
+  }
+  // states a return lands in, by address: where a call inside resumes
+  for(i = 0; i < NNodes; i++){
+    if(First[i] < First[i + 1] && EdgeKind[First[i]] == E_RETURN)
+      ret_first[Node[EdgeTo[First[i]]].pc + 1]++;
+  }
+  for(pc = 0; pc < 2048; pc++){
+    ret_first[pc + 1] += ret_first[pc];
+    ret_pos[pc] = ret_first[pc];
+  }
+  for(i = 0; i < NNodes; i++){
+    if(First[i] < First[i + 1] && EdgeKind[First[i]] == E_RETURN)
+      ret_node[ret_pos[Node[EdgeTo[First[i]]].pc]++] = EdgeTo[First[i]];
+  }
+  for(i = 0; i < NNodes; i++){
+    if((ROM[Node[i].pc] & 0x003) != 1)continue;
+    pc = Node[i].pc;
+    to = (pc & 0xF00) | (ROM[pc]>>2);
+    for(j = 0; j < ncallers[to] && callers[to][j] != pc; j++)
+      ;
+    if(j == ncallers[to] && j < CALLERS_MAX)callers[to][ncallers[to]++] = pc;
+  }
+
+  printf("\nSubroutines (jsb targets): entry, words up to its returns, ROMs, callers and calls\n");
+  for(pc = 0; pc < 2048; pc++){
+    if(!ncallers[pc])continue;
+    // walk from every state a call enters with; a call inside resumes after it
+    stamp++;
+    head = tail = returns = words = 0;
+    banks = 0;
+    memset(seen_pc, 0, sizeof(seen_pc));
+    memset(calls, 0, sizeof(calls));
+    for(i = 0; i < NNodes; i++){
+      if(Node[i].pc != pc || mark[i] == stamp)continue;
+      for(j = 0; j < ncallers[pc]; j++){
+        if((next_pc(callers[pc][j]) & 0xFF) == Node[i].lr)break;
+      }
+      if(j == ncallers[pc])continue;
+      mark[i] = stamp;
+      queue[tail++] = i;
+    }
+    while(head < tail){
+      const int32_t v = queue[head++];
+      const state_t s = Node[v];
+
+      if(!seen_pc[s.pc]++){
+        words++;
+        banks |= 1u << (s.pc>>8);
+      }
+      // back in the keyboard loop: the rest belongs to the caller's caller
+      if(ROM[s.pc] == OPCODE_TEST_KEY)continue;
+      for(e = First[v]; e < First[v + 1]; e++){
+        int32_t w = EdgeTo[e];
+
+        if(EdgeKind[e] == E_RETURN){
+          returns = 1;
+          continue;
+        }
+        if(EdgeKind[e] == E_KEY)continue;
+        if(EdgeKind[e] == E_CALL){
+          const uint16_t back = next_pc(s.pc);
+
+          calls[Node[w].pc>>3] |= 1 << (Node[w].pc & 7);
+          for(r = ret_first[back]; r < ret_first[back + 1]; r++){
+            w = ret_node[r];
+            if(Node[w].lr != (back & 0xFF) || mark[w] == stamp)continue;
+            mark[w] = stamp;
+            queue[tail++] = w;
+          }
+          continue;
+        }
+        if(mark[w] == stamp)continue;
+        mark[w] = stamp;
+        queue[tail++] = w;
+      }
+    }
+    printf("  %03x  %4d words  rom", pc, words);
+    for(i = 0; i < 8; i++){
+      if(banks & (1u<<i))printf(" %d", i);
+    }
+    printf("%s\n        callers %d:", returns ? "" : "  (never returns)", ncallers[pc]);
+    for(j = 0; j < ncallers[pc]; j++){
+      printf(" %03x", callers[pc][j]);
+    }
+    printf("\n        calls:");
+    for(to = 0, j = 0; to < 2048; to++){
+      if(calls[to>>3] & (1 << (to & 7))){
+        printf(" %03x", to);
+        j++;
+      }
+    }
+    printf("%s\n", j ? "" : " none");
+  }
+  free(queue);
+  free(mark);
+  free(ret_node);
+}
+
+/**
+  * @brief  Print the ROM select words that can run and where they lead,
+            and a count of transitions per pair of ROMs.
+  * @param  None
+  * @retval None
+  */
+static void print_banks(void)
+{
+  static uint8_t used[2048];
+  unsigned count[8][8], from, to;
+  uint16_t pc;
+  int i;
+
+  memset(count, 0, sizeof(count));
+  for(i = 0; i < NNodes; i++){
+    pc = Node[i].pc;
+    if(hp45_opcode_type(ROM[pc]) == 6 && !((ROM[pc]>>5) & 0x03) && !used[pc]){
+      used[pc] = 1;
+      count[pc>>8][ROM[pc]>>7]++;
+    }
+  }
+  printf("\nROM bank transitions (rom n words), from row to column:\n      ");
+  for(to = 0; to < 8; to++)printf(" rom%u", to);
+  printf("\n");
+  for(from = 0; from < 8; from++){
+    printf("  rom%u", from);
+    for(to = 0; to < 8; to++)printf(count[from][to] ? " %4u" : "    .", count[from][to]);
+    printf("\n");
+  }
+  printf("  sites:");
+  for(i = 0, pc = 0; pc < 2048; pc++){
+    if(!used[pc])continue;
+    printf("%s %03x->%03x", (i++ % 8) ? "" : "\n   ", pc, ((ROM[pc]>>7)<<8) | (next_pc(pc) & 0xFF));
+  }
+  printf("\n");
+}
+
+/**
+  * @brief  qsort comparison of loops by head address, then depth.
+  */
+static int cmp_loop(const void *a, const void *b)
+{
+  const loop_t *x = a, *y = b;
+
+  if(x->header != y->header)
+    return x->header - y->header;
+  return x->depth - y->depth;
+}
+
+/**
+  * @brief  Work out the worst case of every key for every key jump that can
+            run, into Worst, and collect the loops met on the way.
+  * @param  None
+  * @retval None
+  */
+static void analyze_keys(void)
+{
+  int i, j;
+  unsigned k;
+
+  RecordLoops = 1;
+  for(i = 0; i < NNodes; i++){
+    const uint16_t pc = Node[i].pc;
+    const uint16_t opcode = ROM[pc];
+
+    if(hp45_opcode_type(opcode) != 6 || ((opcode>>5) & 0x03) != 2 || !((opcode>>7) & 1))continue;
+    for(j = 0; j < Sites && Site[j] != pc; j++)
+      ;
+    if(j == Sites){
+      if(Sites == 8)continue;
+      Site[Sites] = pc;
+      for(k = 0; k < KEYS; k++)Worst[Sites][k] = NO_PATH;
+      Sites++;
+    }
+    // successors lists the key entries in KeyNames order
+    for(k = 0; k < KEYS; k++){
+      const double c = key_cost(EdgeTo[First[i] + k]);
+
+      if(c > Worst[j][k])Worst[j][k] = c;
+    }
+  }
+  RecordLoops = 0;
+}
+
+/**
+  * @brief  Print the loops that keys run, one line per exit test.
+  * @param  None
+  * @retval None
+  */
+static void print_loops(void)
+{
+  char text[24];
+  int i;
+
+  qsort(Loops, NLoops, sizeof(loop_t), cmp_loop);
+  printf("\nLoops run by keys: head, nesting depth, words, exit test, kind and assumed iterations\n");
+  for(i = 0; i < NLoops; i++){
+    // the word a branch tests is the one before it
+    if(Loops[i].test == NO_TEST)
+      strcpy(text, "-");
+    else
+      hp45_disasm(ROM[prev_pc(Loops[i].test)], text);
+    printf("  %03x  %5u %5u  ", Loops[i].header, Loops[i].depth, Loops[i].words);
+    printf(Loops[i].test == NO_TEST ? "     " : "%03x  ", Loops[i].test);
+    if(!Loops[i].exits)
+      printf("%-22s %-9s no exit, not taken\n", text, KindName[Loops[i].kind]);
+    else
+      printf("%-22s %-9s %u%s\n", text, KindName[Loops[i].kind], Loops[i].bound,
+             Loops[i].test != NO_TEST && TestBound[Loops[i].test] ? " (-l)" : "");
+  }
+}
+
+/**
+  * @brief  Print the worst case of every key, see analyze_keys.
+  * @param  None
+  * @retval None
+  */
+static void print_keys(void)
+{
+  int j;
+  unsigned k;
+
+  printf("\nKey worst case: word-cycles from the key jump to the next key poll,\n"
+         "loops at their assumed iterations (35 word-cycles are 10 ms)\n  key   ");
+  for(j = 0; j < Sites; j++)printf("  from %03x", Site[j]);
+  printf("\n");
+  for(k = 0; k < KEYS; k++){
+    printf("  %-6s", KeyNames[k]);
+    for(j = 0; j < Sites; j++){
+      if(Worst[j][k] < 0)
+        printf(" %9s", "-");
+      else
+        printf(" %9.0f", Worst[j][k]);
+    }
+    printf("\n");
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  char text[24];
+  int opt, graph = 0, i, dead = 0;
+  unsigned k, test, bound;
+  uint8_t reach[2048] = {0};
+  uint16_t pc;
+
+  while((opt = getopt(argc, argv, "gn:l:")) != -1){
+    switch(opt){
+      case 'g': graph = 1; break;
+      case 'n': Bound[L_OTHER] = strtoul(optarg, NULL, 0); break;
+      case 'l':
+        if(sscanf(optarg, "%x=%u", &test, &bound) == 2 && test < 2048 && bound && bound < 65536){
+          TestBound[test] = bound;
+          break;
+        }
+        // fall through
+      default:
+        fprintf(stderr, "usage: %s [-g] [-n bound] [-l test=bound ...]\n"
+                "  -g             print the control-flow graph for Graphviz instead of the report\n"
+                "  -n bound       iterations assumed for loops without a digit test (16)\n"
+                "  -l test=bound  iterations of the loop with its exit test at hex address test\n", argv[0]);
+        return 2;
+    }
+  }
+  for(k = 0; k < KEYS; k++){
+    if(hp45_parse_keys(KeyNames[k], &KeyCode[k], 1) != 1){
+      fprintf(stderr, "hp45cfg: unknown key %s\n", KeyNames[k]);
+      return 2;
+    }
+  }
+  for(pc = 0; pc < 2048; pc++){
+    hp45_disasm(ROM[pc], text);
+    Defined[pc] = strcmp(text, "undefined") != 0;
+  }
+  if(explore()){
+    fprintf(stderr, "hp45cfg: out of memory\n");
+    return 2;
+  }
+  if(graph){
+    print_dot();
+    return 0;
+  }
+
+  for(i = 0; i < NNodes; i++)reach[Node[i].pc] = 1;
+  for(pc = 0; pc < 2048; pc++)dead += !reach[pc];
+  printf("HP-45 ROM: %d words reachable from power-on, %d states (address, return address, carry, P, flags)\n",
+         2048 - dead, NNodes);
+  printf("Unreachable words:");
+  for(pc = 0; pc < 2048; pc++){
+    if(reach[pc] || (pc && !reach[pc - 1]))continue;
+    for(i = pc; i + 1 < 2048 && !reach[i + 1]; i++)
+      ;
+    printf(i > pc ? " %03x-%03x" : " %03x", pc, i);
+  }
+  printf("\n");
+  print_calls();
+  print_banks();
+  analyze_keys();
+  print_loops();
+  print_keys();
+  return 0;
+}
@@ -0,0 +1,231 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Key event queue: lets a UI thread press keys on a calculator that another
+ * thread is running, without locks. Events carry the word-cycle at which
+ * they apply, and hp45keyq_run splits its burst at those cycles, so the same
+ * events give the same run however the bursts are sized. A press is held
+ * until the firmware reads the key and the next press waits until the
+ * firmware is idle again, so keys pressed and released between two bursts
+ * are not lost. Needs C11 atomics.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "hp45sim.h"
+#include "hp45keyq.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_ACCEPT_MAX  20000     // word-cycles to wait for the firmware to read a key
+#define SETTLE_MAX      4000000   // word-cycles to wait for the firmware to become idle
+#define SETTLE_STEP     64        // word-cycles between idle checks, a power of 2
+
+#define STATE_UP        0         // no key down
+#define STATE_PRESSED   1         // key down, not read by the firmware yet
+#define STATE_READ      2         // key down and read, held until its release event
+
+#define DUE(cycle, now) ((int32_t)((now) - (cycle)) >= 0)
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Run with no key down, fast-forwarding while the firmware is idle.
+  * @param  instance: HP-45 memory object
+  * @param  cycles: word-cycles to run
+  * @retval None
+  */
+static void run_free(hp45inst_t *instance, uint32_t cycles)
+{
+  uint32_t burst;
+
+  while(cycles){
+    burst = hp45_fast_forward(instance, cycles);
+    if(!burst){
+      // busy: run a little, then look for the idle loop again
+      burst = cycles > SETTLE_STEP ? SETTLE_STEP : cycles;
+      hp45_run_until(instance, HP45_EVENT_NONE, burst);
+    }
+    cycles -= burst;
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+/**
+  * @brief  Initialize an empty queue. Call before both threads use it.
+  * @param  queue: key event queue
+  * @param  instance: HP-45 memory object the queue is for, no key down
+  * @retval None
+  */
+void hp45keyq_init(hp45keyq_t *queue, const hp45inst_t *instance)
+{
+  atomic_init(&queue->head, 0);
+  atomic_init(&queue->tail, 0);
+  atomic_init(&queue->now, instance->cycles);
+  queue->tail_seen = 0;
+  queue->head_seen = 0;
+  queue->deadline = instance->cycles + SETTLE_MAX;
+  queue->check = instance->cycles;
+  queue->state = STATE_UP;
+}
+
+/**
+  * @brief  Queue a key event. Producer thread only.
+  * @param  queue: key event queue
+  * @param  key: HP-45 key code to press, or HP45_KEYQ_UP to release it
+  * @param  cycle: word-cycle at which to apply it; stamps must not decrease.
+            A stamp that has passed applies at the start of the next run.
+  * @retval int: 0 on success, -1 if the queue is full.
+  */
+int hp45keyq_push(hp45keyq_t *queue, uint8_t key, uint32_t cycle)
+{
+  const uint32_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  hp45keyev_t *ev;
+
+  if(head - queue->tail_seen >= HP45_KEYQ_SIZE){
+    queue->tail_seen = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if(head - queue->tail_seen >= HP45_KEYQ_SIZE)
+      return -1;
+  }
+  ev = &queue->ev[head & (HP45_KEYQ_SIZE - 1)];
+  ev->cycle = cycle;
+  ev->key = key;
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+  return 0;
+}
+
+/**
+  * @brief  Read the cycle counter as of the end of the last hp45keyq_run,
+            to stamp events from the producer thread.
+  * @param  queue: key event queue
+  * @retval uint32_t: word-cycles
+  */
+uint32_t hp45keyq_now(const hp45keyq_t *queue)
+{
+  return atomic_load_explicit(&queue->now, memory_order_relaxed);
+}
+
+/**
+  * @brief  Count events not applied yet. While it is not 0, the host should
+            not sleep on hp45_idle_period.
+  * @param  queue: key event queue
+  * @retval uint32_t: events queued, plus 1 while a key is held down
+  */
+uint32_t hp45keyq_pending(const hp45keyq_t *queue)
+{
+  return atomic_load_explicit(&queue->head, memory_order_acquire)
+       - atomic_load_explicit(&queue->tail, memory_order_relaxed)
+       + (queue->state != STATE_UP);
+}
+
+/**
+  * @brief  Run a calculator, applying the queued events at their cycles.
+            Consumer thread only; use it instead of hp45_run_cycles while
+            the queue is in use.
+  * @param  queue: key event queue
+  * @param  instance: HP-45 memory object
+  * @param  cycles: word-cycles to run
+  * @retval uint32_t: number of events applied
+  */
+uint32_t hp45keyq_run(hp45keyq_t *queue, hp45inst_t *instance, uint32_t cycles)
+{
+  const uint32_t end = instance->cycles + cycles;
+  uint32_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  uint32_t now, n, applied = 0;
+  const hp45keyev_t *ev;
+
+  while((now = instance->cycles) != end){
+    n = end - now;
+    ev = NULL;
+    if(tail != queue->head_seen ||
+       tail != (queue->head_seen = atomic_load_explicit(&queue->head, memory_order_acquire)))
+      ev = &queue->ev[tail & (HP45_KEYQ_SIZE - 1)];
+    else{
+      // nothing queued: keep the stamps recent so they never wrap around
+      queue->check = now;
+      if(queue->state == STATE_UP && DUE(queue->deadline, now))
+        queue->deadline = now;
+    }
+
+    if(queue->state == STATE_PRESSED){
+      // hold the key until the firmware reads it
+      if(DUE(queue->deadline, now)){
+        key_up(instance);
+        queue->state = STATE_UP;
+        queue->deadline = now + SETTLE_MAX;
+        continue;
+      }
+      if(n > queue->deadline - now)
+        n = queue->deadline - now;
+      if(hp45_run_until(instance, HP45_EVENT_KEY, n) == HP45_EVENT_KEY)
+        queue->state = STATE_READ;
+      continue;
+    }
+
+    if(ev && ev->key == HP45_KEYQ_UP){
+      if(DUE(ev->cycle, now)){
+        if(queue->state == STATE_READ){
+          key_up(instance);
+          queue->state = STATE_UP;
+          queue->deadline = now + SETTLE_MAX;
+        }
+        tail++;
+        applied++;
+        continue;
+      }
+      if(n > ev->cycle - now)
+        n = ev->cycle - now;
+    }else if(ev && queue->state == STATE_READ){
+      // pressed again without a release: release first
+      key_up(instance);
+      queue->state = STATE_UP;
+      queue->deadline = now + SETTLE_MAX;
+      continue;
+    }else if(ev){
+      if(!DUE(ev->cycle, now)){
+        if(n > ev->cycle - now)
+          n = ev->cycle - now;
+      }else if(!DUE(queue->check, now)){
+        if(n > queue->check - now)
+          n = queue->check - now;
+      }else if(DUE(queue->deadline, now) || hp45_idle_period(instance)){
+        key_down(instance, ev->key);
+        queue->state = STATE_PRESSED;
+        queue->deadline = now + KEY_ACCEPT_MAX;
+        queue->check = now;
+        tail++;
+        applied++;
+        continue;
+      }else{
+        // test again at the next multiple of SETTLE_STEP, so the outcome
+        // does not depend on where the bursts end
+        queue->check = (now | (SETTLE_STEP - 1)) + 1;
+        continue;
+      }
+    }
+
+    if(queue->state == STATE_READ)
+      hp45_run_until(instance, HP45_EVENT_NONE, n);
+    else
+      run_free(instance, n);
+  }
+  if(applied)
+    atomic_store_explicit(&queue->tail, tail, memory_order_release);
+  atomic_store_explicit(&queue->now, end, memory_order_relaxed);
+  return applied;
+}
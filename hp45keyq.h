@@ -0,0 +1,43 @@
+#ifndef __HP45KEYQ_H
+#define __HP45KEYQ_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "hp45sim.h"
+
+#define HP45_KEYQ_SIZE  64    // events per queue, a power of 2
+#define HP45_KEYQ_UP    0xFF  // key code of a release event
+
+/* A key event, applied when instance->cycles reaches cycle */
+typedef struct{
+  uint32_t cycle;         // word-cycle stamp, e.g. hp45keyq_now() for "as soon as possible"
+  uint8_t key;            // HP-45 key code to press, or HP45_KEYQ_UP
+} hp45keyev_t;
+
+/* Single-producer/single-consumer key event queue for one calculator. One
+ * thread (the UI) pushes events, the thread that runs the calculator applies
+ * them with hp45keyq_run; neither ever blocks the other. Fields are private;
+ * the two groups are kept on separate cache lines.
+ */
+typedef struct{
+  /* written by the producer */
+  hp45keyev_t ev[HP45_KEYQ_SIZE];
+  atomic_uint head;       // events pushed
+  uint32_t tail_seen;     // last tail read by the producer
+  uint8_t pad[56];
+  /* written by the consumer */
+  atomic_uint tail;       // events applied
+  atomic_uint now;        // instance->cycles after the last hp45keyq_run
+  uint32_t head_seen;     // last head read by the consumer
+  uint32_t deadline;      // cycle at which a pressed key is given up, or a released one considered settled
+  uint32_t check;         // next cycle at which a pending press may test for idle firmware
+  uint8_t state;
+} hp45keyq_t;
+
+void hp45keyq_init(hp45keyq_t*, const hp45inst_t*);
+int hp45keyq_push(hp45keyq_t*, uint8_t, uint32_t);
+uint32_t hp45keyq_now(const hp45keyq_t*);
+uint32_t hp45keyq_pending(const hp45keyq_t*);
+uint32_t hp45keyq_run(hp45keyq_t*, hp45inst_t*, uint32_t);
+
+#endif /* __HP45KEYQ_H */
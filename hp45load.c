@@ -0,0 +1,339 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Load generator for hp45serve: opens connections to its Unix socket, keeps
+ * a number of requests in flight on each, and reports requests per second
+ * and latency percentiles as seen by the client. Scripts are taken in turn
+ * from a file, one per line, or from a built-in mix of slow functions; every
+ * answer must match the first answer to the same script.
+ *   cc -O2 -pthread -o hp45load hp45load.c
+ *   ./hp45load -s /tmp/hp45.sock [-n requests] [-c connections] [-d depth] [-f scripts]
+ * Exit status: 0 all answers ok and consistent, 1 otherwise, 2 error.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/* Private macros ------------------------------------------------------------*/
+#define SCRIPTS_MAX     4096
+#define LINE_MAX_LEN    1024
+#define DEPTH_MAX       4096
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  pthread_t thread;
+  unsigned id;
+  uint64_t requests;      // to send on this connection
+  uint64_t *lat;          // latency of each answer, ns
+  uint64_t answered;
+  uint64_t errors;        // "error" answers
+  uint64_t mismatches;    // answers that differ from the first one to the same script
+  int failed;             // connection or protocol failure
+} conn_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const char *Mix[] = {
+  "2 ENTER 3 Y^X", "1.5 SIN", "2 LN", "9 SQRT", "5 N!",
+  "5 ENTER 53 ->R", "12.5 ENTER 3 / LOG", "0.5 ATAN", "1 E^X", "30 COS",
+};
+static const char *Path;
+static char *Scripts[SCRIPTS_MAX];
+static unsigned NScripts;
+static unsigned Depth = 32;
+static char *Expected[SCRIPTS_MAX];   // first answer to each script
+static pthread_mutex_t ExpectedLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Connect to the server.
+  * @param  None
+  * @retval int: socket, -1 on failure.
+  */
+static int connect_unix(void)
+{
+  struct sockaddr_un addr;
+  int fd;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, Path, sizeof(addr.sun_path) - 1);
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(fd < 0)
+    return -1;
+  if(connect(fd, (struct sockaddr*)&addr, sizeof(addr))){
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+  * @brief  Write a whole buffer.
+  * @param  fd: socket
+  * @param  buf: data
+  * @param  len: length
+  * @retval int: 0 on success, -1 on failure.
+  */
+static int write_all(int fd, const char *buf, size_t len)
+{
+  ssize_t n;
+
+  while(len){
+    n = write(fd, buf, len);
+    if(n <= 0)
+      return -1;
+    buf += n;
+    len -= n;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Check an answer against the first answer to the same script.
+  * @param  c: connection
+  * @param  script: index of the script
+  * @param  line: answer, terminated
+  * @retval None
+  */
+static void check(conn_t *c, unsigned script, const char *line)
+{
+  if(strncmp(line, "ok ", 3))
+    c->errors++;
+  pthread_mutex_lock(&ExpectedLock);
+  if(!Expected[script])
+    Expected[script] = strdup(line);
+  else if(strcmp(Expected[script], line))
+    c->mismatches++;
+  pthread_mutex_unlock(&ExpectedLock);
+}
+
+/**
+  * @brief  Connection thread: keep Depth requests in flight until all are answered.
+  * @param  arg: connection
+  * @retval void*: NULL
+  */
+static void *conn_main(void *arg)
+{
+  conn_t *c = arg;
+  uint64_t sent_ns[DEPTH_MAX];
+  unsigned script[DEPTH_MAX];
+  char in[8192], out[LINE_MAX_LEN + 1];
+  uint64_t sent = 0;
+  size_t len = 0, k;
+  char *line, *nl;
+  ssize_t n;
+  int fd = connect_unix();
+
+  if(fd < 0){
+    c->failed = 1;
+    return NULL;
+  }
+  while(c->answered < c->requests){
+    // top up the pipeline
+    while(sent < c->requests && sent - c->answered < Depth){
+      script[sent % Depth] = (c->id + sent) % NScripts;
+      k = strlen(Scripts[script[sent % Depth]]);
+      memcpy(out, Scripts[script[sent % Depth]], k);
+      out[k++] = '\n';
+      sent_ns[sent % Depth] = now_ns();
+      if(write_all(fd, out, k)){
+        c->failed = 1;
+        goto out;
+      }
+      sent++;
+    }
+    n = read(fd, in + len, sizeof(in) - 1 - len);
+    if(n <= 0){
+      c->failed = 1;
+      break;
+    }
+    len += n;
+    in[len] = 0;
+    for(line = in; (nl = strchr(line, '\n')); line = nl + 1){
+      *nl = 0;
+      c->lat[c->answered] = now_ns() - sent_ns[c->answered % Depth];
+      check(c, script[c->answered % Depth], line);
+      c->answered++;
+    }
+    len = in + len - line;
+    memmove(in, line, len);
+  }
+out:
+  close(fd);
+  return NULL;
+}
+
+/**
+  * @brief  qsort comparison of latencies.
+  * @param  a: latency
+  * @param  b: latency
+  * @retval int: order
+  */
+static int cmp_u64(const void *a, const void *b)
+{
+  const uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+
+  return (x > y) - (x < y);
+}
+
+/**
+  * @brief  Read scripts, one per non-empty line.
+  * @param  path: file
+  * @retval int: 0 on success, -1 on failure.
+  */
+static int load_scripts(const char *path)
+{
+  char line[LINE_MAX_LEN + 2];
+  FILE *f = fopen(path, "r");
+  size_t k;
+
+  if(!f){
+    perror(path);
+    return -1;
+  }
+  while(NScripts < SCRIPTS_MAX && fgets(line, sizeof(line), f)){
+    k = strcspn(line, "\r\n");
+    line[k] = 0;
+    if(k)
+      Scripts[NScripts++] = strdup(line);
+  }
+  fclose(f);
+  return NScripts ? 0 : -1;
+}
+
+/**
+  * @brief  Ask the server for its stats line.
+  * @param  None
+  * @retval None
+  */
+static void server_stats(void)
+{
+  char buf[512];
+  size_t len = 0;
+  ssize_t n;
+  int fd = connect_unix();
+
+  if(fd < 0)
+    return;
+  if(!write_all(fd, "stats\n", 6)){
+    while(len < sizeof(buf) - 1 && (n = read(fd, buf + len, sizeof(buf) - 1 - len)) > 0){
+      len += n;
+      if(buf[len - 1] == '\n')
+        break;
+    }
+    buf[len] = 0;
+    printf("server: %s", buf);
+  }
+  close(fd);
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  uint64_t requests = 100000, answered = 0, errors = 0, mismatches = 0, *lat, i;
+  unsigned conns = 4, k;
+  conn_t *c;
+  double t;
+  int opt, failed = 0;
+
+  while((opt = getopt(argc, argv, "s:n:c:d:f:")) != -1){
+    switch(opt){
+      case 's': Path = optarg; break;
+      case 'n': requests = strtoull(optarg, NULL, 0); break;
+      case 'c': conns = strtoul(optarg, NULL, 0); break;
+      case 'd': Depth = strtoul(optarg, NULL, 0); break;
+      case 'f':
+        if(load_scripts(optarg))
+          return 2;
+        break;
+      default:
+        Path = NULL;
+    }
+  }
+  if(!Path || !conns || !Depth || Depth > DEPTH_MAX){
+    fprintf(stderr, "usage: %s -s socket [-n requests] [-c connections] [-d depth] [-f scripts]\n", argv[0]);
+    return 2;
+  }
+  if(!NScripts){
+    for(; NScripts < sizeof(Mix)/sizeof(Mix[0]); NScripts++)Scripts[NScripts] = (char*)Mix[NScripts];
+  }
+  c = calloc(conns, sizeof(conn_t));
+  lat = malloc((requests + 1)*sizeof(uint64_t));
+  if(!c || !lat){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+
+  t = now_ns();
+  for(i = 0, k = 0; k < conns; k++){
+    c[k].id = k;
+    c[k].requests = requests/conns + (k < requests%conns);
+    c[k].lat = lat + i;
+    i += c[k].requests;
+    if(pthread_create(&c[k].thread, NULL, conn_main, &c[k])){
+      fprintf(stderr, "cannot start thread\n");
+      return 2;
+    }
+  }
+  for(k = 0; k < conns; k++){
+    pthread_join(c[k].thread, NULL);
+  }
+  t = (now_ns() - t)*1e-9;
+
+  // gather the latencies of all answers at the start of the array
+  for(k = 0; k < conns; k++){
+    memmove(lat + answered, c[k].lat, c[k].answered*sizeof(uint64_t));
+    answered += c[k].answered;
+    errors += c[k].errors;
+    mismatches += c[k].mismatches;
+    failed |= c[k].failed;
+  }
+  if(failed)
+    fprintf(stderr, "%s: connection failed\n", Path);
+  qsort(lat, answered, sizeof(uint64_t), cmp_u64);
+  printf("requests %llu in %.3f s, %.0f requests/s, %u connections x %u in flight\n",
+         (unsigned long long)answered, t, answered/t, conns, Depth);
+  if(answered){
+    printf("latency p50 %.1f us, p99 %.1f us, max %.1f us\n",
+           lat[answered/2]*1e-3, lat[answered*99/100]*1e-3, lat[answered - 1]*1e-3);
+  }
+  printf("errors %llu, inconsistent answers %llu\n", (unsigned long long)errors, (unsigned long long)mismatches);
+  server_stats();
+  return failed ? 2 : (errors || mismatches) ? 1 : 0;
+}
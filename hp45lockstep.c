@@ -0,0 +1,189 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Lockstep test of the recompiled engine: runs an HP45_RECOMPILED calculator
+ * and an opcode switch calculator side by side from power-on, pressing
+ * random keys and running both with the same random hp45_run_cycles,
+ * hp45_run_until and hp45_fast_forward calls, and compares the results, the
+ * full state (hp45_snapshot) and, with HP45_DISPLAY_TRACKING, the display
+ * generation after every call. Stops at the first difference and exits 1.
+ * Run it after regenerating hp45blocks.c.
+ *   cc -O2 -o hp45lockstep hp45lockstep.c hp45snap.c hp45sim.c
+ *   ./hp45lockstep [calls] [seed]
+ * The recompiled engine is hp45sim.c compiled into this file a second time,
+ * under other names. Add the same HP45_REG_* options as the build under
+ * test; HP45_PREDECODE does not apply.
+ */
+
+/* Recompiled engine ---------------------------------------------------------*/
+#define HP45_RECOMPILED
+#define key_down              rc_key_down
+#define key_up                rc_key_up
+#define hp45_init             rc_hp45_init
+#define hp45_init_ready       rc_hp45_init_ready
+#define hp45_run              rc_hp45_run
+#define hp45_run_cycles       rc_hp45_run_cycles
+#define hp45_run_until        rc_hp45_run_until
+#define hp45_idle_period      rc_hp45_idle_period
+#define hp45_fast_forward     rc_hp45_fast_forward
+#define hp45_rom_fingerprint  rc_hp45_rom_fingerprint
+#define hp45_display_changed  rc_hp45_display_changed
+#define opcode10              rc_opcode10
+#define opcode0100            rc_opcode0100
+#define opcode1100            rc_opcode1100
+#define opcode1000            rc_opcode1000
+#define opcode0000            rc_opcode0000
+#include "hp45sim.c"
+#undef HP45_RECOMPILED
+#undef key_down
+#undef key_up
+#undef hp45_init
+#undef hp45_init_ready
+#undef hp45_run
+#undef hp45_run_cycles
+#undef hp45_run_until
+#undef hp45_idle_period
+#undef hp45_fast_forward
+#undef hp45_rom_fingerprint
+#undef hp45_display_changed
+#undef opcode10
+#undef opcode0100
+#undef opcode1100
+#undef opcode1000
+#undef opcode0000
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     35
+#define BUDGET_MAX    3000    // word-cycles per call, at most
+
+/* Private variables ---------------------------------------------------------*/
+/* the opcode switch engine, hp45sim.c as linked; hp45sim.h above declared
+ * the recompiled one under these names
+ */
+void key_down(hp45inst_t*, uint8_t);
+void key_up(hp45inst_t*);
+void hp45_init(hp45inst_t*);
+uint32_t hp45_run_cycles(hp45inst_t*, uint32_t, uint8_t*);
+uint8_t hp45_run_until(hp45inst_t*, uint8_t, uint32_t);
+uint32_t hp45_fast_forward(hp45inst_t*, uint32_t);
+
+/* native codes of all keys */
+static const uint8_t Keys[KEY_COUNT] = {
+  006, 004, 003, 002, 000, 056, 054, 053, 052, 050, 016, 014,
+  013, 012, 010, 076, 073, 072, 070, 066, 064, 063, 062, 026,
+  024, 023, 022, 036, 034, 033, 032, 046, 044, 043, 042,
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Print the scalar state of a calculator.
+  * @param  name: engine name
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+static void print_state(const char *name, const hp45inst_t *instance)
+{
+  printf("  %-11s pc %03x op %03x cy %u p %2u s %03x lr %02x cycles %lu\n", name, instance->PC,
+         ROM[instance->PC & 0x7FF], instance->CY, instance->P, instance->S, instance->LR,
+         (unsigned long)instance->cycles);
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static hp45inst_t ref, rc;
+  unsigned long calls = argc > 1 ? strtoul(argv[1], NULL, 0) : 200000, n;
+  uint32_t x = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1, budget, r_ref, r_rc;
+  uint8_t a[HP45_SNAPSHOT_SIZE], b[HP45_SNAPSHOT_SIZE], stop_ref, stop_rc, events, key;
+  const char *what;
+
+  if(!x)x = 1;
+  hp45_init(&ref);
+  rc_hp45_init(&rc);
+  for(n = 0; n < calls; n++){
+    budget = next_random(&x) % BUDGET_MAX + 1;
+    stop_ref = stop_rc = 0;
+    r_ref = r_rc = 0;
+    switch(next_random(&x) % 8){
+      case 0: case 1:
+        what = "key_down";
+        key = Keys[next_random(&x) % KEY_COUNT];
+        budget = key;
+        key_down(&ref, key);
+        rc_key_down(&rc, key);
+        break;
+      case 2:
+        what = "key_up";
+        key_up(&ref);
+        rc_key_up(&rc);
+        break;
+      case 3: case 4:
+        what = "hp45_run_until";
+        events = (uint8_t)(next_random(&x) % 8);
+        r_ref = hp45_run_until(&ref, events, budget);
+        r_rc = rc_hp45_run_until(&rc, events, budget);
+        break;
+      case 5:
+        what = "hp45_fast_forward";
+        r_ref = hp45_fast_forward(&ref, budget);
+        r_rc = rc_hp45_fast_forward(&rc, budget);
+        break;
+      default:
+        what = "hp45_run_cycles";
+        r_ref = hp45_run_cycles(&ref, budget, &stop_ref);
+        r_rc = rc_hp45_run_cycles(&rc, budget, &stop_rc);
+        break;
+    }
+    hp45_snapshot(&ref, a);
+    hp45_snapshot(&rc, b);
+    if(r_ref != r_rc || stop_ref != stop_rc || memcmp(a, b, HP45_SNAPSHOT_SIZE)
+#ifdef HP45_DISPLAY_TRACKING
+       || ref.display_gen != rc.display_gen
+#endif
+      ){
+      printf("FAIL: call %lu, %s(%lu) returned %lu (stop %u) on the opcode switch engine, %lu (stop %u) recompiled\n",
+             n, what, (unsigned long)budget, (unsigned long)r_ref, stop_ref, (unsigned long)r_rc, stop_rc);
+      print_state("switch", &ref);
+      print_state("recompiled", &rc);
+      return 1;
+    }
+  }
+  printf("ok: %lu calls, %lu word-cycles in lockstep\n", calls, (unsigned long)ref.cycles);
+  return 0;
+}
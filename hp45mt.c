@@ -0,0 +1,182 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Multithreaded stress test: runs N calculators on N threads at once, each
+ * with its own random key workload, then runs the same workloads one after
+ * the other on one thread and compares the final states (hp45_snapshot).
+ * Prints the throughput of both and exits 1 if any state differs.
+ *   cc -O2 -pthread -o hp45mt hp45mt.c hp45snap.c hp45sim.c
+ *   ./hp45mt [threads] [keys]
+ * The threads run first, so with HP45_PREDECODE their hp45_init calls are
+ * also the first ones. Add the same HP45_* options as the build under test;
+ * building with -fsanitize=thread also checks for data races.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  pthread_t thread;
+  unsigned seed;      // workload number
+  hp45inst_t calc;
+  uint8_t state[HP45_SNAPSHOT_SIZE];  // final state
+} worker_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     35
+#define BURST_MAX     4000    // word-cycles run with the key down, and after it
+
+/* Private variables ---------------------------------------------------------*/
+/* native codes of all keys */
+static const uint8_t Keys[KEY_COUNT] = {
+  006, 004, 003, 002, 000, 056, 054, 053, 052, 050, 016, 014,
+  013, 012, 010, 076, 073, 072, 070, 066, 064, 063, 062, 026,
+  024, 023, 022, 036, 034, 033, 032, 046, 044, 043, 042,
+};
+static unsigned Presses = 2000;   // keys per workload
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Run one workload from power-on: random keys, each held and then
+            released for a random number of cycles through hp45_run_cycles,
+            hp45_run_until and hp45_fast_forward, whether the firmware is
+            done or not. Errors and unfinished functions are part of it.
+  * @param  w: worker, seed in, calc and state out
+  * @retval None
+  */
+static void run_workload(worker_t *w)
+{
+  hp45inst_t *const calc = &w->calc;
+  uint32_t x = 2463534242u ^ (w->seed*2654435761u), budget;
+  unsigned i;
+
+  hp45_init(calc);
+  for(i = 0; i < Presses; i++){
+    key_down(calc, Keys[next_random(&x) % KEY_COUNT]);
+    budget = next_random(&x) % BURST_MAX + 1;
+    if(budget & 1){
+      hp45_run_cycles(calc, budget, NULL);
+    }else{
+      hp45_run_until(calc, HP45_EVENT_KEY, budget);
+    }
+    key_up(calc);
+    budget = next_random(&x) % BURST_MAX + 1;
+    budget -= hp45_fast_forward(calc, budget);
+    hp45_run_cycles(calc, budget, NULL);
+  }
+  hp45_snapshot(calc, w->state);
+}
+
+/**
+  * @brief  Worker thread: run its workload.
+  * @param  arg: worker_t
+  * @retval NULL
+  */
+static void *worker(void *arg)
+{
+  run_workload(arg);
+  return NULL;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  int threads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+  static worker_t serial;
+  worker_t *w;
+  uint64_t start, ns_threads, ns_serial, cycles = 0;
+  int t, started, failed = 0;
+
+  if(argc > 2)Presses = (unsigned)atoi(argv[2]);
+  if(threads < 1)threads = 1;
+  w = calloc(threads, sizeof(worker_t));
+  if(!w){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+
+  start = now_ns();
+  for(started = 0; started < threads; started++){
+    w[started].seed = started;
+    if(pthread_create(&w[started].thread, NULL, worker, &w[started]))
+      break;
+  }
+  for(t = 0; t < started; t++){
+    pthread_join(w[t].thread, NULL);
+    cycles += w[t].calc.cycles;
+  }
+  ns_threads = now_ns() - start;
+  if(started != threads){
+    fprintf(stderr, "could only start %d threads\n", started);
+    return 2;
+  }
+
+  start = now_ns();
+  for(t = 0; t < threads; t++){
+    serial.seed = t;
+    run_workload(&serial);
+    if(memcmp(serial.state, w[t].state, HP45_SNAPSHOT_SIZE)){
+      printf("FAIL: workload %d ended in a different state on its thread\n", t);
+      failed = 1;
+    }
+  }
+  ns_serial = now_ns() - start;
+
+  printf("%d workloads of %u keys, %llu word-cycles\n", threads, Presses, (unsigned long long)cycles);
+  printf("threads: %8.1f ms, %6.1f M cycles/s\n", ns_threads/1e6, cycles*1e3/ns_threads);
+  printf("serial:  %8.1f ms, %6.1f M cycles/s, threads %.2fx faster\n", ns_serial/1e6, cycles*1e3/ns_serial,
+         (double)ns_serial/ns_threads);
+  printf("%s\n", failed ? "FAIL" : "ok: same states");
+  free(w);
+  return failed;
+}
@@ -0,0 +1,210 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Numeric I/O: puts numbers straight into the registers of a calculator and
+ * reads them back, instead of typing digits and reading the display.
+ * Write into an idle calculator; like the result of a key, the number is
+ * then used by the next function key, but the display (registers A and B)
+ * shows the old value until a key is pressed. Decimal strings are converted
+ * without floating point; doubles go through snprintf/strtod, so leave this
+ * file out of builds that have no use for them.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "hp45sim.h"
+#include "hp45num.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define EXP_LIMIT   10000   // exponents beyond this are out of range anyway
+
+/* Public functions ----------------------------------------------------------*/
+/**
+  * @brief  Check that a register holds a number in the form described in
+            hp45num.h, as it does after any key that left no error.
+  * @param  reg: register
+  * @retval int: 1 if it does.
+  */
+int hp45_is_number(const reg_t *reg)
+{
+  int i, zero = 1;
+
+  for(i = 0; i < 14; i++){
+    if(HP45_DIGIT(reg, i) > 9)
+      return 0;
+    if(HP45_DIGIT(reg, i))
+      zero = 0;
+  }
+  if(zero)
+    return 1;
+  return (HP45_DIGIT(reg, 13) == 0 || HP45_DIGIT(reg, 13) == 9)
+      && (HP45_DIGIT(reg, 2) == 0 || HP45_DIGIT(reg, 2) == 9)
+      && HP45_DIGIT(reg, 12) != 0;
+}
+
+/**
+  * @brief  Write a decimal number into a register, rounded half up to 10
+            significant digits.
+  * @param  reg: register, e.g. HP45_X(instance) or HP45_RAM(instance, 3)
+  * @param  text: number such as "-12.5", ".5", "1e-5" or "6.02E23",
+                  white space around it allowed
+  * @retval int: 0 on success, -1 if text is not a number or its magnitude
+                 is out of range; the register is then unchanged.
+  */
+int hp45_set_decimal(reg_t *reg, const char *text)
+{
+  uint8_t digits[11] = {0}, neg = 0;
+  int n = 0, point = 0, seen = 0, e10 = -1, exp = 0, exp_neg = 0, i;
+
+  while(*text == ' ' || *text == '\t')text++;
+  if(*text == '-' || *text == '+')
+    neg = (*text++ == '-');
+  // mantissa: e10 ends as the exponent of the first significant digit
+  for(;; text++){
+    if(*text == '.' && !point){
+      point = 1;
+    }else if(*text >= '0' && *text <= '9'){
+      seen = 1;
+      if(n || *text != '0'){
+        if(n < 11)digits[n] = *text - '0';
+        n++;
+        if(!point)e10++;
+      }else if(point){
+        e10--;
+      }
+    }else{
+      break;
+    }
+  }
+  if(!seen)
+    return -1;
+  if(*text == 'e' || *text == 'E'){
+    text++;
+    if(*text == '-' || *text == '+')
+      exp_neg = (*text++ == '-');
+    if(*text < '0' || *text > '9')
+      return -1;
+    for(; *text >= '0' && *text <= '9'; text++){
+      if(exp < EXP_LIMIT)exp = exp*10 + *text - '0';
+    }
+  }
+  while(*text == ' ' || *text == '\t' || *text == '\n' || *text == '\r')text++;
+  if(*text)
+    return -1;
+
+  if(!n){
+    // zero, whatever the exponent
+    for(i = 0; i < 14; i++)HP45_SET_DIGIT(reg, i, 0);
+    return 0;
+  }
+  e10 += exp_neg ? -exp : exp;
+  if(digits[10] >= 5){
+    for(i = 9; i >= 0 && digits[i] == 9; i--)digits[i] = 0;
+    if(i < 0){
+      // 9.9999999995 rounds to 10
+      digits[0] = 1;
+      e10++;
+    }else{
+      digits[i]++;
+    }
+  }
+  if(e10 > 99 || e10 < -99)
+    return -1;
+
+  HP45_SET_DIGIT(reg, 13, neg ? 9 : 0);
+  for(i = 0; i < 10; i++)HP45_SET_DIGIT(reg, 12 - i, digits[i]);
+  if(e10 < 0)e10 += 1000;
+  HP45_SET_DIGIT(reg, 2, e10/100);
+  HP45_SET_DIGIT(reg, 1, e10/10%10);
+  HP45_SET_DIGIT(reg, 0, e10%10);
+  return 0;
+}
+
+/**
+  * @brief  Write a number into a register, rounded to the nearest 10
+            significant digits.
+  * @param  reg: register, e.g. HP45_X(instance) or HP45_RAM(instance, 3)
+  * @param  value: number
+  * @retval int: 0 on success, -1 if value is not finite or its magnitude is
+                 out of range; the register is then unchanged.
+  */
+int hp45_set_number(reg_t *reg, double value)
+{
+  char text[32];
+
+  if(!isfinite(value))
+    return -1;
+  // snprintf rounds the exact binary value, so it is rounded only once
+  snprintf(text, sizeof(text), "%.9e", value);
+  return hp45_set_decimal(reg, text);
+}
+
+/**
+  * @brief  Read the number in a register as text, with all 10 digits,
+            e.g. "-1.234567890e-05", or "0".
+  * @param  reg: register, e.g. HP45_X(instance)
+  * @param  text: output, at least HP45_DECIMAL_MAX characters
+  * @retval int: length of text, -1 if the register does not hold a number
+                 (text is then "nan").
+  */
+int hp45_get_decimal(const reg_t *reg, char *text)
+{
+  char *p = text;
+  int i, e;
+
+  if(!hp45_is_number(reg)){
+    snprintf(text, HP45_DECIMAL_MAX, "nan");
+    return -1;
+  }
+  if(!HP45_DIGIT(reg, 12)){
+    *p++ = '0';
+    *p = 0;
+    return p - text;
+  }
+  if(HP45_DIGIT(reg, 13) == 9)*p++ = '-';
+  for(i = 12; i >= 3; i--){
+    *p++ = '0' + HP45_DIGIT(reg, i);
+    if(i == 12)*p++ = '.';
+  }
+  e = HP45_DIGIT(reg, 1)*10 + HP45_DIGIT(reg, 0);
+  if(HP45_DIGIT(reg, 2) == 9)e -= 100;
+  *p++ = 'e';
+  *p++ = e < 0 ? '-' : '+';
+  if(e < 0)e = -e;
+  *p++ = '0' + e/10;
+  *p++ = '0' + e%10;
+  *p = 0;
+  return p - text;
+}
+
+/**
+  * @brief  Read the number in a register, rounded to the nearest double.
+  * @param  reg: register, e.g. HP45_X(instance)
+  * @retval double: value, NaN if the register does not hold a number.
+  */
+double hp45_get_number(const reg_t *reg)
+{
+  char text[HP45_DECIMAL_MAX];
+
+  if(hp45_get_decimal(reg, text) < 0)
+    return NAN;
+  return strtod(text, NULL);
+}
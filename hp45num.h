@@ -0,0 +1,35 @@
+#ifndef __HP45NUM_H
+#define __HP45NUM_H
+
+#include <stdint.h>
+#include "hp45sim.h"
+
+/* Number format -------------------------------------------------------------*/
+/* The firmware keeps a number in a register as:
+ *   digit 13     sign of the mantissa, 0 or 9 (negative)
+ *   digits 12-3  mantissa, 10 digits, digit 12 not 0
+ *   digit 2      sign of the exponent, 0 or 9 (negative)
+ *   digits 1-0   exponent; a negative exponent in 10's complement with
+ *                digit 2, e.g. 995 for -5
+ * Zero is all digits 0. Numbers range from 1e-99 to 9.999999999e99.
+ */
+#define HP45_DECIMAL_MAX  17    // length of hp45_get_decimal output, "-1.234567890e-05", with the terminating zero
+
+/* Registers by name, e.g. hp45_set_number(HP45_Y(&calc), 2.0) */
+#define HP45_X(instance)      (&(instance)->CX)
+#define HP45_Y(instance)      (&(instance)->DY)
+#define HP45_Z(instance)      (&(instance)->EZ)
+#define HP45_T(instance)      (&(instance)->FT)
+#define HP45_M(instance)      (&(instance)->M)
+#define HP45_RAM(instance, n) (&(instance)->RAM[n])   // storage register n of STO n and RCL n
+
+#define hp45_set_x(instance, value)   hp45_set_number(HP45_X(instance), (value))
+#define hp45_get_x(instance)          hp45_get_number(HP45_X(instance))
+
+int hp45_is_number(const reg_t*);
+int hp45_set_decimal(reg_t*, const char*);
+int hp45_set_number(reg_t*, double);
+int hp45_get_decimal(const reg_t*, char*);
+double hp45_get_number(const reg_t*);
+
+#endif /* __HP45NUM_H */
@@ -0,0 +1,188 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Numeric I/O check: converts the edge cases of hp45_set_decimal and
+ * hp45_set_number (rounding that carries into the exponent, the ends of the
+ * exponent range, negative zero, malformed text) and compares the register
+ * with the expected digits. Rejected input must leave the register as it
+ * was. Every accepted number must also read back to itself through
+ * hp45_get_decimal, and survive ENTER 0 + on the firmware unchanged, so the
+ * digits are in the form the firmware keeps. Exits 1 if any case fails.
+ *   cc -O2 -o hp45numcheck hp45numcheck.c hp45num.c hp45utils.c hp45sim.c -lm
+ *   ./hp45numcheck
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45num.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  const char *text;       // input of hp45_set_decimal
+  const char *expected;   // hp45_get_decimal of the result, NULL if it must be rejected
+} decimal_case_t;
+
+typedef struct{
+  double value;           // input of hp45_set_number
+  const char *expected;   // as above
+} number_case_t;
+
+/* Private variables ---------------------------------------------------------*/
+static const decimal_case_t Decimals[] = {
+  // rounding half up, carrying into the exponent
+  {"9.9999999995",        "1.000000000e+01"},
+  {"9.99999999949999",    "9.999999999e+00"},
+  {"-9.9999999995",       "-1.000000000e+01"},
+  {"99999999995",         "1.000000000e+11"},
+  {"0.000099999999995",   "1.000000000e-04"},
+  {"1.2345678905",        "1.234567891e+00"},
+  {"1.23456789049999999", "1.234567890e+00"},
+  // ends of the range
+  {"1e-99",               "1.000000000e-99"},
+  {"-1E-99",              "-1.000000000e-99"},
+  {"9.9999999995e-100",   "1.000000000e-99"},
+  {"9.999999999e-100",    NULL},
+  {"1e-100",              NULL},
+  {"9.999999999e99",      "9.999999999e+99"},
+  {"9.9999999995e99",     NULL},
+  {"1e100",               NULL},
+  {"-1e100",              NULL},
+  {"0.1e100",             "1.000000000e+99"},
+  {"1000e97",             NULL},
+  {"1e99999999999999999", NULL},
+  {"1e-99999999999999999", NULL},
+  // zero has no sign
+  {"0",                   "0"},
+  {"-0",                  "0"},
+  {"+0",                  "0"},
+  {"-0.0e-5",             "0"},
+  {"-.0",                 "0"},
+  {"0e999999",            "0"},
+  // text
+  {" 2.5 \n",             "2.500000000e+00"},
+  {"12.",                 "1.200000000e+01"},
+  {".5",                  "5.000000000e-01"},
+  {"",                    NULL},
+  {"-",                   NULL},
+  {".",                   NULL},
+  {"1e",                  NULL},
+  {"1e+",                 NULL},
+  {"1e5x",                NULL},
+  {"1..5",                NULL},
+  {"--1",                 NULL},
+};
+
+static const number_case_t Numbers[] = {
+  {-0.0,                  "0"},
+  {0.5,                   "5.000000000e-01"},
+  {-2.0,                  "-2.000000000e+00"},
+  {1e-99,                 "1.000000000e-99"},
+  {9.999999999e99,        "9.999999999e+99"},
+  {1e100,                 NULL},
+  {1e-100,                NULL},
+  {DBL_MIN,               NULL},
+  {DBL_MAX,               NULL},
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Check a converted number against the expected result.
+  * @param  input: input as text, for messages
+  * @param  result: return value of the conversion
+  * @param  reg: register converted into
+  * @param  before: register before the conversion
+  * @param  expected: hp45_get_decimal of the result, NULL if it must be rejected
+  * @retval int: 0 if it matches, 1 if not.
+  */
+static int check(const char *input, int result, const reg_t *reg, const reg_t *before, const char *expected)
+{
+  static const uint8_t Script[] = {076, 044, 026};  // ENTER 0 +
+  char text[HP45_DECIMAL_MAX], again[HP45_DECIMAL_MAX];
+  hp45inst_t calc;
+  reg_t copy;
+  int i;
+
+  if(!expected){
+    if(result != -1 || memcmp(reg, before, sizeof(reg_t))){
+      printf("FAIL: \"%s\" was not rejected, or the register changed\n", input);
+      return 1;
+    }
+    return 0;
+  }
+  hp45_get_decimal(reg, text);
+  if(result || !hp45_is_number(reg) || strcmp(text, expected)){
+    printf("FAIL: \"%s\" returned %d and gave %s, expected %s\n", input, result, text, expected);
+    return 1;
+  }
+  for(i = 0; i < 14 && !strcmp(expected, "0"); i++){
+    if(HP45_DIGIT(reg, i)){
+      printf("FAIL: \"%s\" gave a zero with digit %d set\n", input, i);
+      return 1;
+    }
+  }
+  if(hp45_set_decimal(&copy, text) || memcmp(&copy, reg, sizeof(reg_t))){
+    printf("FAIL: \"%s\" does not read back as %s\n", input, text);
+    return 1;
+  }
+  hp45_init_ready(&calc);
+  *HP45_X(&calc) = *reg;
+  for(i = 0; i < (int)sizeof(Script); i++){
+    hp45_press_key(&calc, Script[i]);
+  }
+  hp45_get_decimal(HP45_X(&calc), again);
+  if(strcmp(text, again)){
+    printf("FAIL: \"%s\" gave %s, which the firmware turned into %s\n", input, text, again);
+    return 1;
+  }
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(void)
+{
+  reg_t reg, before;
+  char input[32];
+  unsigned i;
+  int failed = 0;
+
+  hp45_set_decimal(&before, "3.141592654");
+  for(i = 0; i < sizeof(Decimals)/sizeof(Decimals[0]); i++){
+    reg = before;
+    failed |= check(Decimals[i].text, hp45_set_decimal(&reg, Decimals[i].text), &reg, &before,
+                    Decimals[i].expected);
+  }
+  for(i = 0; i < sizeof(Numbers)/sizeof(Numbers[0]); i++){
+    reg = before;
+    snprintf(input, sizeof(input), "%.17g", Numbers[i].value);
+    failed |= check(input, hp45_set_number(&reg, Numbers[i].value), &reg, &before, Numbers[i].expected);
+  }
+  reg = before;
+  failed |= check("NAN", hp45_set_number(&reg, NAN), &reg, &before, NULL);
+  failed |= check("INFINITY", hp45_set_number(&reg, -INFINITY), &reg, &before, NULL);
+  if(failed)
+    return 1;
+  printf("ok: %u decimal and %u double conversions\n", (unsigned)(sizeof(Decimals)/sizeof(Decimals[0])),
+         (unsigned)(sizeof(Numbers)/sizeof(Numbers[0])) + 2);
+  return 0;
+}
@@ -0,0 +1,163 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Session player: replays a recording made with hp45rec as fast as possible
+ * and verifies its final state, or shows the display at given cycles.
+ * Can also record a key script, with a pause between keys.
+ *   cc -O2 -o hp45play hp45play.c hp45replay.c hp45snap.c hp45utils.c hp45sim.c
+ *   ./hp45play session.h45r
+ *   ./hp45play session.h45r 350000 7000000
+ *   ./hp45play -r session.h45r "12 ENTER 3 * F LN" 35000
+ * Exit status: 0 verified, 1 diverged, 2 error.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45replay.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define CYCLES_PER_S    3500      // word-cycles per second of calculator time
+#define KEYS_MAX        4096
+#define KEY_ACCEPT_MAX  20000     // word-cycles to wait for the firmware to read a key
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval double: seconds
+  */
+static double now_s(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+/**
+  * @brief  Record a key script, keys held until read, with idle pauses.
+  * @param  path: recording to write
+  * @param  script: key names, see hp45_parse_keys
+  * @param  pause: idle word-cycles after each key
+  * @retval int: exit status
+  */
+static int record(const char *path, const char *script, uint32_t pause)
+{
+  static uint8_t codes[KEYS_MAX];
+  const int n = hp45_parse_keys(script, codes, KEYS_MAX);
+  hp45inst_t calc;
+  hp45rec_t rec;
+  FILE *f;
+  int i, status;
+
+  if(n < 0){
+    fprintf(stderr, "bad key script\n");
+    return 2;
+  }
+  if(!(f = fopen(path, "wb"))){
+    perror(path);
+    return 2;
+  }
+  hp45_init_ready(&calc);
+  hp45rec_start(&rec, f, &calc, 60*CYCLES_PER_S);
+  for(i = 0; i < n; i++){
+    hp45rec_key_down(&rec, &calc, codes[i]);
+    hp45_run_until(&calc, HP45_EVENT_KEY, KEY_ACCEPT_MAX);
+    hp45rec_key_up(&rec, &calc);
+    hp45_settle(&calc);
+    hp45_run_cycles(&calc, pause - hp45_fast_forward(&calc, pause), NULL);
+    hp45rec_tick(&rec, &calc);
+  }
+  status = hp45rec_finish(&rec, &calc);
+  if(fclose(f) || status){
+    fprintf(stderr, "%s: write error\n", path);
+    return 2;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Print the replay position and display.
+  * @param  rp: replay
+  * @param  calc: HP-45 memory object
+  * @retval None
+  */
+static void show(const hp45replay_t *rp, const hp45inst_t *calc)
+{
+  char text[32];
+
+  hp45_display_text(calc, text);
+  printf("cycle %llu (%.1f s): [%s]\n", (unsigned long long)rp->cycle, (double)rp->cycle/CYCLES_PER_S, text);
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  hp45inst_t calc;
+  hp45replay_t rp;
+  FILE *f;
+  double t;
+  int i, result = HP45_REPLAY_OK;
+
+  if(argc >= 4 && argv[1][0] == '-' && argv[1][1] == 'r')
+    return record(argv[2], argv[3], argc > 4 ? (uint32_t)strtoul(argv[4], NULL, 0) : CYCLES_PER_S);
+  if(argc < 2){
+    fprintf(stderr, "usage: %s recording [cycle...]\n"
+                    "       %s -r recording script [pause-cycles]\n", argv[0], argv[0]);
+    return 2;
+  }
+  if(!(f = fopen(argv[1], "rb"))){
+    perror(argv[1]);
+    return 2;
+  }
+  hp45_init(&calc);
+  if(hp45replay_open(&rp, f, &calc) != HP45_REPLAY_OK){
+    fprintf(stderr, "%s: not a recording for this ROM\n", argv[1]);
+    return 2;
+  }
+  t = now_s();
+  for(i = 2; i < argc && result >= HP45_REPLAY_OK; i++){
+    result = hp45replay_seek(&rp, &calc, strtoull(argv[i], NULL, 0));
+    show(&rp, &calc);
+  }
+  if(argc == 2){
+    result = hp45replay_play(&rp, &calc, UINT64_MAX);
+    show(&rp, &calc);
+    printf("replayed %.1f s of calculator time in %.3f s, %u checkpoints\n",
+           (double)rp.cycle/CYCLES_PER_S, now_s() - t, rp.count ? rp.count - 1 : 0);
+  }
+  hp45replay_close(&rp);
+  fclose(f);
+  switch(result){
+    case HP45_REPLAY_OK:
+      return 0;
+    case HP45_REPLAY_END:
+      printf("final state verified\n");
+      return 0;
+    case HP45_REPLAY_DIVERGED:
+      printf("diverged at cycle %llu\n", (unsigned long long)rp.cycle);
+      return 1;
+  }
+  fprintf(stderr, "%s: truncated or malformed, or cannot seek back\n", argv[1]);
+  return 2;
+}
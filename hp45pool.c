@@ -0,0 +1,445 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Job pool: worker threads run keystroke jobs on their own calculator.
+ * Each worker has a queue; submitted jobs are dealt round robin, a worker
+ * takes the oldest job of its own queue and, when that is empty, steals the
+ * newest job of another worker. Needs POSIX threads and C11 atomics.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45snap.h"
+#include "hp45cache.h"
+#include "hp45num.h"
+#include "hp45pool.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  _Alignas(64) hp45inst_t inst; // calculator of this worker, on its own cache lines
+  pthread_mutex_t lock;         // protects the queue and the counters
+  hp45job_t **ring;             // queue of jobs, ring buffer
+  unsigned head, count, size;   // oldest job, number of jobs, size of ring (power of 2)
+  hp45pool_stats_t stats;       // counters of jobs run by this worker
+  hp45cache_t *cache;           // key press cache, NULL if disabled
+  pthread_t thread;
+  hp45pool_t *pool;
+  unsigned id;
+} worker_t;
+
+struct hp45pool{
+  worker_t *workers;
+  unsigned nworkers;
+  atomic_uint next;             // worker receiving the next submitted job
+  atomic_uint queued;           // jobs waiting in any queue
+  atomic_uint pending;          // jobs submitted but not finished
+  pthread_mutex_t lock;         // protects stop, used by the condition variables
+  pthread_cond_t work;          // signalled when a job is queued
+  pthread_cond_t idle;          // signalled when pending drops to 0
+  int stop;
+  uint64_t start_ns;
+};
+
+/* Private macros ------------------------------------------------------------*/
+#define QUEUE_INIT  64      // initial size of a worker queue
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Append a job to a worker queue, growing it when full.
+  * @param  w: worker
+  * @param  job: job
+  * @retval int: 0 on success, -1 if out of memory.
+  */
+static int push(worker_t *w, hp45job_t *job)
+{
+  hp45job_t **ring;
+  unsigned i;
+
+  pthread_mutex_lock(&w->lock);
+  if(w->count == w->size){
+    ring = malloc(2*w->size*sizeof(hp45job_t*));
+    if(!ring){
+      pthread_mutex_unlock(&w->lock);
+      return -1;
+    }
+    for(i = 0; i < w->count; i++)ring[i] = w->ring[(w->head + i) & (w->size - 1)];
+    free(w->ring);
+    w->ring = ring;
+    w->head = 0;
+    w->size *= 2;
+  }
+  w->ring[(w->head + w->count) & (w->size - 1)] = job;
+  w->count++;
+  pthread_mutex_unlock(&w->lock);
+  return 0;
+}
+
+/**
+  * @brief  Take a job from a worker queue.
+  * @param  w: worker
+  * @param  newest: nonzero to take the newest job (stealing), else the oldest
+  * @retval hp45job_t*: job, NULL if the queue is empty.
+  */
+static hp45job_t *take(worker_t *w, int newest)
+{
+  hp45job_t *job = NULL;
+
+  pthread_mutex_lock(&w->lock);
+  if(w->count){
+    w->count--;
+    if(newest){
+      job = w->ring[(w->head + w->count) & (w->size - 1)];
+    }else{
+      job = w->ring[w->head];
+      w->head = (w->head + 1) & (w->size - 1);
+    }
+  }
+  pthread_mutex_unlock(&w->lock);
+  return job;
+}
+
+/**
+  * @brief  Find work for a worker: its own queue first, then steal.
+  * @param  w: worker
+  * @param  stolen: set to 1 if the job came from another worker
+  * @retval hp45job_t*: job, NULL if all queues are empty.
+  */
+static hp45job_t *find_job(worker_t *w, int *stolen)
+{
+  hp45pool_t *pool = w->pool;
+  hp45job_t *job;
+  unsigned i;
+
+  *stolen = 0;
+  if((job = take(w, 0)))
+    return job;
+  for(i = 1; i < pool->nworkers; i++){
+    if((job = take(&pool->workers[(w->id + i) % pool->nworkers], 1))){
+      *stolen = 1;
+      return job;
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Run one job on a calculator.
+  * @param  instance: HP-45 memory object, overwritten
+  * @param  cache: key press cache, may be NULL
+  * @param  job: job
+  * @retval None
+  */
+static void run_job(hp45inst_t *instance, hp45cache_t *cache, hp45job_t *job)
+{
+  int32_t taken = 0;
+  uint8_t codes[HP45_JOB_KEYS_MAX];
+  int n, i;
+
+  job->status = HP45_JOB_OK;
+  n = hp45_parse_keys(job->script, codes, HP45_JOB_KEYS_MAX);
+  if(job->start)
+    hp45_fork(job->start, instance, 1);
+  else
+    hp45_init_ready(instance);
+  if(n < 0 || (job->input && hp45_set_decimal(HP45_X(instance), job->input))){
+    job->status = HP45_JOB_BAD_SCRIPT;
+  }else{
+    for(i = 0; i < n; i++){
+      taken = cache ? hp45cache_press_key(cache, instance, codes[i]) : hp45_press_key(instance, codes[i]);
+      if(taken == -1){
+        job->status = HP45_JOB_STUCK;
+        break;
+      }
+    }
+    // a later key clears an error, like on the calculator
+    if(taken == -2)
+      job->status = HP45_JOB_ERROR;
+  }
+  job->cycles = instance->cycles;
+  if(job->want & HP45_JOB_X)
+    job->x = instance->CX;
+  if(job->want & HP45_JOB_DISPLAY)
+    make_display(instance, job->display);
+  if(job->want & HP45_JOB_TEXT)
+    hp45_display_text(instance, job->text);
+}
+
+/**
+  * @brief  Worker thread: run jobs, sleep while there are none.
+  * @param  arg: worker
+  * @retval void*: NULL
+  */
+static void *worker_main(void *arg)
+{
+  worker_t *w = arg;
+  hp45pool_t *pool = w->pool;
+  hp45job_t *job;
+  hp45cache_stats_t cache;
+  uint64_t wait;
+  int stolen;
+
+  for(;;){
+    job = find_job(w, &stolen);
+    if(!job){
+      pthread_mutex_lock(&pool->lock);
+      while(!atomic_load(&pool->queued) && !pool->stop)
+        pthread_cond_wait(&pool->work, &pool->lock);
+      if(pool->stop){
+        pthread_mutex_unlock(&pool->lock);
+        return NULL;
+      }
+      pthread_mutex_unlock(&pool->lock);
+      continue;
+    }
+    atomic_fetch_sub(&pool->queued, 1);
+    job->start_ns = now_ns();
+    run_job(&w->inst, w->cache, job);
+    job->end_ns = now_ns();
+
+    wait = job->start_ns - job->submit_ns;
+    pthread_mutex_lock(&w->lock);
+    w->stats.jobs++;
+    w->stats.cycles += job->cycles;
+    w->stats.steals += stolen;
+    w->stats.queue_ns += wait;
+    if(wait > w->stats.queue_max_ns)
+      w->stats.queue_max_ns = wait;
+    w->stats.run_ns += job->end_ns - job->start_ns;
+    if(w->cache){
+      hp45cache_stats(w->cache, &cache);
+      w->stats.cache_hits = cache.hits;
+      w->stats.cache_misses = cache.misses;
+    }
+    pthread_mutex_unlock(&w->lock);
+    if(job->done)
+      job->done(job);
+
+    if(atomic_fetch_sub(&pool->pending, 1) == 1){
+      pthread_mutex_lock(&pool->lock);
+      pthread_cond_broadcast(&pool->idle);
+      pthread_mutex_unlock(&pool->lock);
+    }
+  }
+}
+
+/**
+  * @brief  Stop and join the running workers, then free the pool.
+  * @param  pool: pool
+  * @param  started: number of worker threads started
+  * @retval None
+  */
+static void shutdown(hp45pool_t *pool, unsigned started)
+{
+  unsigned i;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->stop = 1;
+  pthread_cond_broadcast(&pool->work);
+  pthread_mutex_unlock(&pool->lock);
+  for(i = 0; i < started; i++){
+    pthread_join(pool->workers[i].thread, NULL);
+  }
+  for(i = 0; i < pool->nworkers; i++){
+    pthread_mutex_destroy(&pool->workers[i].lock);
+    free(pool->workers[i].ring);
+    if(pool->workers[i].cache)
+      hp45cache_destroy(pool->workers[i].cache);
+  }
+  pthread_mutex_destroy(&pool->lock);
+  pthread_cond_destroy(&pool->work);
+  pthread_cond_destroy(&pool->idle);
+  free(pool->workers);
+  free(pool);
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Start a pool of worker threads.
+  * @param  threads: number of workers, 0 for one per online CPU
+  * @retval hp45pool_t*: pool, NULL on failure.
+  */
+hp45pool_t *hp45pool_create(unsigned threads)
+{
+  hp45pool_t *pool;
+  worker_t *w;
+  unsigned i, started = 0;
+
+  if(!threads){
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cpus > 0 ? cpus : 1;
+  }
+  pool = calloc(1, sizeof(hp45pool_t));
+  if(!pool)
+    return NULL;
+  pool->workers = aligned_alloc(_Alignof(worker_t), threads*sizeof(worker_t));
+  if(!pool->workers){
+    free(pool);
+    return NULL;
+  }
+  memset(pool->workers, 0, threads*sizeof(worker_t));
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->work, NULL);
+  pthread_cond_init(&pool->idle, NULL);
+  pool->start_ns = now_ns();
+  pool->nworkers = threads;
+  for(i = 0; i < threads; i++){
+    w = &pool->workers[i];
+    pthread_mutex_init(&w->lock, NULL);
+    w->size = QUEUE_INIT;
+    w->ring = malloc(w->size*sizeof(hp45job_t*));
+    w->pool = pool;
+    w->id = i;
+  }
+  for(i = 0; i < threads && pool->workers[i].ring; i++);
+  // start the threads only when all workers exist, as they steal from each other
+  if(i == threads){
+    for(started = 0; started < threads; started++){
+      if(pthread_create(&pool->workers[started].thread, NULL, worker_main, &pool->workers[started]))
+        break;
+    }
+  }
+  if(started < threads){
+    shutdown(pool, started);
+    return NULL;
+  }
+  return pool;
+}
+
+/**
+  * @brief  Give every worker a key press cache (see hp45cache.c), so key
+            sequences repeated from the same state are looked up instead of
+            executed. Call before the first hp45pool_submit.
+  * @param  pool: pool
+  * @param  entries: capacity of each worker's cache
+  * @retval int: 0 on success, -1 if out of memory (no cache is enabled).
+  */
+int hp45pool_set_cache(hp45pool_t *pool, uint32_t entries)
+{
+  unsigned i;
+
+  for(i = 0; i < pool->nworkers; i++){
+    pool->workers[i].cache = hp45cache_create(entries);
+    if(!pool->workers[i].cache){
+      while(i--){
+        hp45cache_destroy(pool->workers[i].cache);
+        pool->workers[i].cache = NULL;
+      }
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  Queue a job. Its results are valid after hp45pool_wait, or
+            when its done callback is called.
+  * @param  pool: pool
+  * @param  job: job, with script and want filled in
+  * @retval int: 0 on success, -1 if out of memory.
+  */
+int hp45pool_submit(hp45pool_t *pool, hp45job_t *job)
+{
+  worker_t *w = &pool->workers[atomic_fetch_add(&pool->next, 1) % pool->nworkers];
+
+  job->submit_ns = now_ns();
+  atomic_fetch_add(&pool->pending, 1);
+  if(push(w, job)){
+    atomic_fetch_sub(&pool->pending, 1);
+    return -1;
+  }
+  pthread_mutex_lock(&pool->lock);
+  atomic_fetch_add(&pool->queued, 1);
+  pthread_cond_signal(&pool->work);
+  pthread_mutex_unlock(&pool->lock);
+  return 0;
+}
+
+/**
+  * @brief  Wait until every submitted job has finished.
+  * @param  pool: pool
+  * @retval None
+  */
+void hp45pool_wait(hp45pool_t *pool)
+{
+  pthread_mutex_lock(&pool->lock);
+  while(atomic_load(&pool->pending))
+    pthread_cond_wait(&pool->idle, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+  * @brief  Sum the counters of all workers. Throughput is jobs (or cycles)
+            per wall_ns; mean queue latency is queue_ns/jobs.
+  * @param  pool: pool
+  * @param  stats: counters
+  * @retval None
+  */
+void hp45pool_stats(hp45pool_t *pool, hp45pool_stats_t *stats)
+{
+  worker_t *w;
+  unsigned i;
+
+  memset(stats, 0, sizeof(hp45pool_stats_t));
+  for(i = 0; i < pool->nworkers; i++){
+    w = &pool->workers[i];
+    pthread_mutex_lock(&w->lock);
+    stats->jobs += w->stats.jobs;
+    stats->cycles += w->stats.cycles;
+    stats->steals += w->stats.steals;
+    stats->queue_ns += w->stats.queue_ns;
+    if(w->stats.queue_max_ns > stats->queue_max_ns)
+      stats->queue_max_ns = w->stats.queue_max_ns;
+    stats->run_ns += w->stats.run_ns;
+    stats->cache_hits += w->stats.cache_hits;
+    stats->cache_misses += w->stats.cache_misses;
+    pthread_mutex_unlock(&w->lock);
+  }
+  stats->wall_ns = now_ns() - pool->start_ns;
+  stats->workers = pool->nworkers;
+}
+
+/**
+  * @brief  Stop the workers and free the pool. Jobs already queued are run first.
+  * @param  pool: pool
+  * @retval None
+  */
+void hp45pool_destroy(hp45pool_t *pool)
+{
+  shutdown(pool, pool->nworkers);
+}
@@ -0,0 +1,66 @@
+#ifndef __HP45POOL_H
+#define __HP45POOL_H
+
+#include <stdint.h>
+#include "hp45sim.h"
+
+/* Results requested by a job -----------------------------------------------*/
+#define HP45_JOB_X          0x01  // copy register C (the X register) to hp45job_t.x
+#define HP45_JOB_DISPLAY    0x02  // convert the display into hp45job_t.display with make_display
+#define HP45_JOB_TEXT       0x04  // render the display into hp45job_t.text with hp45_display_text
+
+/* Job status ----------------------------------------------------------------*/
+#define HP45_JOB_OK          0
+#define HP45_JOB_BAD_SCRIPT  (-1) // unknown key name, more than HP45_JOB_KEYS_MAX keys, or a bad input
+#define HP45_JOB_STUCK       (-2) // a key was not read, or the firmware never became idle
+#define HP45_JOB_ERROR       (-3) // the last key left the display flashing an error, e.g. 1/x of 0
+
+#define HP45_JOB_KEYS_MAX   256   // keys per script
+
+/* A headless keystroke job: power on, or fork start, set X to input, press
+ * the keys of the script one by one, then report the requested results. The job, and start,
+ * must stay valid until hp45pool_wait returns, or until done is called.
+ */
+typedef struct hp45job{
+  const hp45inst_t *start; // idle calculator to fork, e.g. after a common key prefix; NULL to power on
+  const char *input;      // number put into the X register before the first key, see hp45_set_decimal; NULL for none
+  const char *script;     // key names separated by white space, see hp45_parse_keys
+  uint8_t want;           // HP45_JOB_X | HP45_JOB_DISPLAY | HP45_JOB_TEXT
+  void (*done)(struct hp45job*); // called from the worker thread when the job has finished, or NULL;
+                          // the pool no longer touches the job once it is called
+  void *user;             // free for the caller, e.g. for done
+  /* filled in by the pool */
+  int status;             // HP45_JOB_OK or an error
+  reg_t x;                // register C after the last key
+  uint8_t display[14];    // LED scan buffer after the last key
+  char text[32];          // display text after the last key
+  uint32_t cycles;        // cycle counter at the end: power-on included, or counted on from start
+  uint64_t submit_ns;     // CLOCK_MONOTONIC time of hp45pool_submit
+  uint64_t start_ns;      // ... when a worker picked the job up
+  uint64_t end_ns;        // ... when the job finished
+} hp45job_t;
+
+/* Counters over all jobs finished since hp45pool_create */
+typedef struct{
+  uint64_t jobs;          // jobs finished
+  uint64_t cycles;        // word-cycles executed by finished jobs
+  uint64_t steals;        // jobs taken from another worker's queue
+  uint64_t queue_ns;      // sum of start_ns - submit_ns
+  uint64_t queue_max_ns;  // largest start_ns - submit_ns
+  uint64_t run_ns;        // sum of end_ns - start_ns
+  uint64_t wall_ns;       // time since hp45pool_create
+  uint64_t cache_hits;    // key presses answered by the caches, see hp45pool_set_cache
+  uint64_t cache_misses;  // key presses executed with caches enabled
+  unsigned workers;       // number of worker threads
+} hp45pool_stats_t;
+
+typedef struct hp45pool hp45pool_t;
+
+hp45pool_t *hp45pool_create(unsigned);
+int hp45pool_set_cache(hp45pool_t*, uint32_t);
+int hp45pool_submit(hp45pool_t*, hp45job_t*);
+void hp45pool_wait(hp45pool_t*);
+void hp45pool_stats(hp45pool_t*, hp45pool_stats_t*);
+void hp45pool_destroy(hp45pool_t*);
+
+#endif /* __HP45POOL_H */
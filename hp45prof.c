@@ -0,0 +1,235 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Profile reports for HP45_PROFILE builds: breakdowns per instruction type,
+ * type 2 operation and word select, hot firmware routines and hot addresses,
+ * each mapped back to its line and column in hp45rom.c.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45prof.h"
+
+#ifdef HP45_PROFILE
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  uint16_t pc;
+  uint64_t count;
+} hot_t;
+
+/* Private macros ------------------------------------------------------------*/
+/* Layout of hp45rom.c: a 5 line header, then 16 words per line and a blank
+ * line after each 256-word ROM.
+ */
+#define ROM_FIRST_LINE      6
+#define ROM_WORDS_PER_LINE  16
+#define ROM_LINE(pc)        (ROM_FIRST_LINE + ((pc)>>8)*(256/ROM_WORDS_PER_LINE + 1) + ((pc) & 0xFF)/ROM_WORDS_PER_LINE)
+#define ROM_COLUMN(pc)      (((pc) % ROM_WORDS_PER_LINE)*7 + 1)
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t ROM[2048] = {
+  #include "hp45rom.c"
+};
+
+static const char *const TypeName[11] = {
+  NULL, "jsb/branch", "arithmetic", "status", "pointer", "data/display",
+  "rom select/misc", "unused 7", "unused 8", "unused 9", "nop",
+};
+
+static const char *const FieldName[8] = {"p", "m", "x", "w", "wp", "ms", "xs", "s"};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Find the routine an address belongs to: the closest subroutine
+            entry (jsb target) at or before it in the same ROM, else the start
+            of the ROM.
+  * @param  entry: entry flags of all addresses, see mark_entries
+  * @param  pc: address
+  * @retval uint16_t: entry address
+  */
+static uint16_t routine_of(const uint8_t *entry, uint16_t pc)
+{
+  while((pc & 0xFF) && !entry[pc])pc--;
+  return pc;
+}
+
+/**
+  * @brief  Flag every jsb target of the ROM as a subroutine entry.
+  * @param  entry: output, 2048 flags
+  * @retval None
+  */
+static void mark_entries(uint8_t *entry)
+{
+  uint16_t pc;
+
+  memset(entry, 0, 2048);
+  for(pc = 0; pc < 2048; pc++){
+    if((ROM[pc] & 0x003) == 1)
+      entry[(pc & 0xF00) | (ROM[pc]>>2)] = 1;
+  }
+}
+
+/**
+  * @brief  Print one line of a breakdown.
+  * @param  out: output stream
+  * @param  name: label
+  * @param  count: executions
+  * @param  total: all executions
+  * @retval None
+  */
+static void print_share(FILE *out, const char *name, uint64_t count, uint64_t total)
+{
+  if(count)
+    fprintf(out, "  %-18s %14llu %6.2f%%\n", name, (unsigned long long)count, 100.0*count/total);
+}
+
+/**
+  * @brief  Sort hot_t by count, descending (insertion sort on the top entries).
+  * @param  hot: array
+  * @param  n: number of elements
+  * @param  item: new element
+  * @param  top: capacity of hot
+  * @retval unsigned: new number of elements
+  */
+static unsigned insert_hot(hot_t *hot, unsigned n, hot_t item, unsigned top)
+{
+  unsigned i;
+
+  if(n == top && (!n || item.count <= hot[n - 1].count))
+    return n;
+  if(n < top)n++;
+  for(i = n - 1; i > 0 && hot[i - 1].count < item.count; i--){
+    hot[i] = hot[i - 1];
+  }
+  hot[i] = item;
+  return n;
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Print a text report: totals per instruction type, type 2 operation
+            and word select, then the hottest routines and addresses with
+            their position in hp45rom.c and disassembly.
+  * @param  profile: counters
+  * @param  out: output stream
+  * @param  top: number of routines and addresses listed
+  * @retval None
+  */
+void hp45prof_report(const hp45profile_t *profile, FILE *out, unsigned top)
+{
+  uint8_t entry[2048];
+  uint64_t routine[2048];
+  hot_t hot[2048];
+  uint64_t type[11] = {0}, arith[32] = {0}, ws[8] = {0}, total = 0;
+  char name[32];
+  unsigned n, i;
+  uint16_t pc;
+  hot_t item;
+
+  if(top > 2048)top = 2048;
+  mark_entries(entry);
+  memset(routine, 0, sizeof(routine));
+  for(pc = 0; pc < 2048; pc++){
+    const uint64_t count = profile->pc[pc];
+
+    total += count;
+    type[hp45_opcode_type(ROM[pc])] += count;
+    if((ROM[pc] & 0x003) == 2){
+      arith[ROM[pc]>>5] += count;
+      ws[(ROM[pc]>>2) & 7] += count;
+    }
+    routine[routine_of(entry, pc)] += count;
+  }
+  fprintf(out, "HP-45 profile: %llu instructions\n", (unsigned long long)total);
+  if(!total)
+    return;
+
+  fprintf(out, "\nBy instruction type:\n");
+  for(i = 1; i <= 10; i++){
+    sprintf(name, "%2u %s", i, TypeName[i]);
+    print_share(out, name, type[i], total);
+  }
+  fprintf(out, "\nBy type 2 operation:\n");
+  for(i = 0; i < 32; i++){
+    hp45_disasm((i<<5) | 2, name);
+    *strchr(name, '[') = 0;
+    print_share(out, name, arith[i], total);
+  }
+  fprintf(out, "\nBy word select:\n");
+  for(i = 0; i < 8; i++){
+    print_share(out, FieldName[i], ws[i], total);
+  }
+
+  fprintf(out, "\nHot routines (from a jsb target to the next one):\n");
+  fprintf(out, "  entry  hp45rom.c     %14s %7s\n", "count", "share");
+  for(n = 0, pc = 0; pc < 2048; pc++){
+    item.pc = pc;
+    item.count = routine[pc];
+    if(item.count)n = insert_hot(hot, n, item, top);
+  }
+  for(i = 0; i < n; i++){
+    sprintf(name, "%d:%d", ROM_LINE(hot[i].pc), ROM_COLUMN(hot[i].pc));
+    fprintf(out, "  %03x%s   %-12s  %14llu %6.2f%%\n", hot[i].pc, entry[hot[i].pc] ? " " : "*", name,
+            (unsigned long long)hot[i].count, 100.0*hot[i].count/total);
+  }
+  fprintf(out, "  (* no jsb target: code from the start of the ROM)\n");
+
+  fprintf(out, "\nHot addresses:\n");
+  fprintf(out, "  addr  hp45rom.c     opcode  %-22s %14s %7s\n", "instruction", "count", "share");
+  for(n = 0, pc = 0; pc < 2048; pc++){
+    item.pc = pc;
+    item.count = profile->pc[pc];
+    if(item.count)n = insert_hot(hot, n, item, top);
+  }
+  for(i = 0; i < n; i++){
+    char text[24];
+
+    hp45_disasm(ROM[hot[i].pc], text);
+    sprintf(name, "%d:%d", ROM_LINE(hot[i].pc), ROM_COLUMN(hot[i].pc));
+    fprintf(out, "  %03x   %-12s  0x%03x   %-22s %14llu %6.2f%%\n", hot[i].pc, name, ROM[hot[i].pc], text,
+            (unsigned long long)hot[i].count, 100.0*hot[i].count/total);
+  }
+}
+
+/**
+  * @brief  Print the counters as CSV, one row per executed address:
+            address,rom_line,rom_column,opcode,type,instruction,routine,count
+  * @param  profile: counters
+  * @param  out: output stream
+  * @retval None
+  */
+void hp45prof_csv(const hp45profile_t *profile, FILE *out)
+{
+  uint8_t entry[2048];
+  char text[24];
+  uint16_t pc;
+
+  mark_entries(entry);
+  fprintf(out, "address,rom_line,rom_column,opcode,type,instruction,routine,count\n");
+  for(pc = 0; pc < 2048; pc++){
+    if(!profile->pc[pc])continue;
+    hp45_disasm(ROM[pc], text);
+    fprintf(out, "0x%03x,%d,%d,0x%03x,%u,%s,0x%03x,%llu\n", pc, ROM_LINE(pc), ROM_COLUMN(pc), ROM[pc],
+            hp45_opcode_type(ROM[pc]), text, routine_of(entry, pc), (unsigned long long)profile->pc[pc]);
+  }
+}
+#endif /* HP45_PROFILE */
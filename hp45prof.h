@@ -0,0 +1,12 @@
+#ifndef __HP45PROF_H
+#define __HP45PROF_H
+
+#include <stdio.h>
+#include "hp45sim.h"
+
+#ifdef HP45_PROFILE
+void hp45prof_report(const hp45profile_t*, FILE*, unsigned);
+void hp45prof_csv(const hp45profile_t*, FILE*);
+#endif
+
+#endif /* __HP45PROF_H */
@@ -0,0 +1,476 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Static recompiler: translates the ROM into straight-line C functions,
+ * one per basic block, for the HP45_RECOMPILED engine of hp45sim.c.
+ * Usage: hp45recomp > hp45blocks.c
+ * The output has CRLF line endings, like the other sources.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static const uint16_t ROM[2048] = {
+  #include "hp45rom.c"
+};
+
+/* opcode>>3 of type 2 instructions -> C statements and mnemonic.
+ * %1/%2 are replaced by operand registers, %f by the field.
+ */
+static const struct{
+  const char *code;
+  const char *name;
+} type2[32] = {
+  [0]  = {"ifeq0(instance, &instance->B, %f);", "0-B"},
+  [1]  = {"mov(&instance->B, &zero, %f);", "0->B"},
+  [2]  = {"ifge(instance, &instance->A, &instance->CX, %f);", "A-C"},
+  [3]  = {"set1(&temp.r, %f); ifge(instance, &instance->CX, &temp.r, %f);", "C-1"},
+  [4]  = {"mov(&instance->CX, &instance->B, %f);", "B->C"},
+  [5]  = {"sub(instance, &zero, &instance->CX, &instance->CX, %f);", "0-C->C"},
+  [6]  = {"mov(&instance->CX, &zero, %f);", "0->C"},
+  [7]  = {"sub(instance, &zero, &instance->CX, &instance->CX, %f); set1(&temp.r, %f); "
+          "sub(instance, &instance->CX, &temp.r, &instance->CX, %f); instance->CY = 1;", "0-C-1->C"},
+  [8]  = {"shift(&instance->A, 1, %f);", "shift A left"},
+  [9]  = {"mov(&instance->B, &instance->A, %f);", "A->B"},
+  [10] = {"sub(instance, &instance->A, &instance->CX, &instance->CX, %f);", "A-C->C"},
+  [11] = {"set1(&temp.r, %f); sub(instance, &instance->CX, &temp.r, &instance->CX, %f);", "C-1->C"},
+  [12] = {"mov(&instance->A, &instance->CX, %f);", "C->A"},
+  [13] = {"ifeq0(instance, &instance->CX, %f);", "0-C"},
+  [14] = {"add(instance, &instance->A, &instance->CX, &instance->CX, %f);", "A+C->C"},
+  [15] = {"set1(&temp.r, %f); add(instance, &instance->CX, &temp.r, &instance->CX, %f);", "C+1->C"},
+  [16] = {"ifge(instance, &instance->A, &instance->B, %f);", "A-B"},
+  [17] = {"exch(&instance->B, &instance->CX, %f);", "B<->C"},
+  [18] = {"shift(&instance->CX, 0, %f);", "shift C right"},
+  [19] = {"set1(&temp.r, %f); ifge(instance, &instance->A, &temp.r, %f);", "A-1"},
+  [20] = {"shift(&instance->B, 0, %f);", "shift B right"},
+  [21] = {"add(instance, &instance->CX, &instance->CX, &instance->CX, %f);", "C+C->C"},
+  [22] = {"shift(&instance->A, 0, %f);", "shift A right"},
+  [23] = {"mov(&instance->A, &zero, %f);", "0->A"},
+  [24] = {"sub(instance, &instance->A, &instance->B, &instance->A, %f);", "A-B->A"},
+  [25] = {"exch(&instance->A, &instance->B, %f);", "A<->B"},
+  [26] = {"sub(instance, &instance->A, &instance->CX, &instance->A, %f);", "A-C->A"},
+  [27] = {"set1(&temp.r, %f); sub(instance, &instance->A, &temp.r, &instance->A, %f);", "A-1->A"},
+  [28] = {"add(instance, &instance->A, &instance->B, &instance->A, %f);", "A+B->A"},
+  [29] = {"exch(&instance->A, &instance->CX, %f);", "C<->A"},
+  [30] = {"add(instance, &instance->A, &instance->CX, &instance->A, %f);", "A+C->A"},
+  [31] = {"set1(&temp.r, %f); add(instance, &instance->A, &temp.r, &instance->A, %f);", "A+1->A"},
+};
+
+static const char *const field_expr[8] = {
+  "FIELD_P(instance->P)", "FIELD_M", "FIELD_X", "FIELD_W",
+  "FIELD_WP(instance->P)", "FIELD_MS", "FIELD_XS", "FIELD_S",
+};
+static const char *const field_name[8] = {"p", "m", "x", "w", "wp", "ms", "xs", "s"};
+
+/* Instruction classes as seen by the block builder */
+enum{
+  I_PLAIN,    // falls through to the next address
+  I_SETS,     // falls through, writes S (key flag must be merged again)
+  I_BRANCH,   // conditional branch
+  I_JSB,      // subroutine call
+  I_RET,      // subroutine return
+  I_ROMSEL,   // ROM select
+  I_KEYJMP,   // keyboard entry, HP45_EVENT_KEY
+  I_DISPLAY,  // display toggle/off, may raise HP45_EVENT_DISPLAY
+  I_UNDEF,    // undefined opcode
+};
+
+static uint8_t leader[2048];
+static char body[64*1024];  // statements of the block being emitted
+static size_t body_len;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Address of the next word, wrapping within the 256-word ROM page.
+  */
+static uint16_t next_pc(uint16_t pc)
+{
+  return (pc & 0xF00) | ((pc+1) & 0xFF);
+}
+
+/**
+  * @brief  Append formatted text to the body of the block being emitted.
+  */
+static void emit(const char *fmt, ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  body_len += vsnprintf(body + body_len, sizeof(body) - body_len, fmt, ap);
+  va_end(ap);
+}
+
+/**
+  * @brief  Print formatted text to stdout with CRLF line endings, like the
+            rest of the sources.
+  */
+static void out(const char *fmt, ...)
+{
+  static char text[sizeof(body) + 256];
+  const char *p;
+  va_list ap;
+
+  va_start(ap, fmt);
+  vsnprintf(text, sizeof(text), fmt, ap);
+  va_end(ap);
+  for(p = text; *p; p++){
+    if(*p == '\n')putchar('\r');
+    putchar(*p);
+  }
+}
+
+/**
+  * @brief  Append C statements one per line, indented for the function body.
+  */
+static void emit_code(const char *code)
+{
+  const char *p;
+
+  while(*code){
+    emit("  ");
+    for(p = code; *p && *p != '\n' && !(p[0] == ';' && p[1] == ' '); p++)
+      ;
+    if(*p == ';'){
+      emit("%.*s\n", (int)(p + 1 - code), code);
+      code = p + 2;
+    }else{
+      emit("%.*s\n", (int)(p - code), code);
+      code = *p ? p + 1 : p;
+    }
+  }
+}
+
+/**
+  * @brief  Classify an instruction and produce its C statements and mnemonic.
+            Mirrors the decoding of hp45_run.
+  * @param  opcode: 10-bit ROM word
+  * @param  code: buffer for C statements, may be NULL
+  * @param  name: buffer for mnemonic, may be NULL
+  * @param  result: pointer to store the value the instruction returns
+  * @retval int: instruction class I_*
+  */
+static int translate(uint16_t opcode, char *code, char *name, int *result)
+{
+  const uint8_t o = opcode>>2;
+  const uint8_t N = o>>4;
+  char c[512] = "", n[64] = "";
+  int cls = I_PLAIN;
+
+  *result = 0;
+  switch(opcode & 0x003){
+    case 0:
+      switch(o & 0x03){
+        case 0: // type 6-10
+          if(o & 0x04){
+            switch((o>>3) & 0x03){
+              case 0: cls = I_ROMSEL; sprintf(n, "rom %d", o>>5); break;
+              case 1: cls = I_RET; strcpy(n, "return"); break;
+              case 2:
+                if((o>>5) & 1){
+                  cls = I_KEYJMP; strcpy(n, "keys -> rom address");
+                }else{
+                  cls = I_UNDEF; *result = -1;
+                }
+                break;
+              case 3:
+                if(((o>>5) & 0x5) == 0x4){
+                  strcpy(c, "instance->DataAddr = HP45_DIGIT(&instance->CX, 12);");
+                  strcpy(n, "c -> data address");
+                }else if((o>>5) == 0x5){
+                  strcpy(c, "if(instance->DataAddr < 10)\n  memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));");
+                  strcpy(n, "c -> data");
+                }else{
+                  cls = I_UNDEF; *result = -2;
+                }
+                break;
+            }
+          }else if(o & 0x08){
+            cls = I_UNDEF; *result = -3;
+          }else if(o & 0x10){
+            cls = I_UNDEF; *result = -4;
+          }else if(o){
+            cls = I_UNDEF; *result = -5;
+          }else{
+            strcpy(n, "nop");
+          }
+          break;
+        case 1: // type 3: status
+          switch((o>>2) & 0x03){
+            case 0:
+              if(N >= 12){ cls = I_UNDEF; *result = -2; break; }
+              cls = I_SETS; sprintf(c, "instance->S |= 1<<%d;", N); sprintf(n, "1 -> s%d", N);
+              break;
+            case 1:
+              if(N >= 12){ cls = I_UNDEF; *result = -4; break; }
+              sprintf(c, "instance->CY = (instance->S >> %d) & 1;", N); sprintf(n, "if s%d = 1", N);
+              break;
+            case 2:
+              if(N >= 12){ cls = I_UNDEF; *result = -7; break; }
+              cls = I_SETS; sprintf(c, "instance->S &= ~(1<<%d);", N); sprintf(n, "0 -> s%d", N);
+              break;
+            case 3:
+              if(N){ cls = I_UNDEF; *result = -10; break; }
+              cls = I_SETS; strcpy(c, "instance->S = 0;"); strcpy(n, "clear status");
+              break;
+          }
+          break;
+        case 2: // type 5: data entry/display
+          switch((o>>2) & 0x03){
+            case 0: cls = I_UNDEF; *result = -1; break;
+            case 1:
+              if(N >= 10){ cls = I_UNDEF; *result = -2; break; }
+              sprintf(c, "if(instance->P < 14)\n  HP45_SET_DIGIT(&instance->CX, instance->P, %d); "
+                      "instance->P = (instance->P - 1) & 0x0F;", N);
+              sprintf(n, "%d -> c[p]", N);
+              break;
+            default:
+              switch(N){
+                case 0: cls = I_DISPLAY; strcpy(n, "display toggle"); break;
+                case 2:
+                  strcpy(c, "memcpy(&temp.r, &instance->CX, sizeof(reg_t)); memcpy(&instance->CX, &instance->M, sizeof(reg_t)); "
+                         "memcpy(&instance->M, &temp.r, sizeof(reg_t));");
+                  strcpy(n, "c <-> m");
+                  break;
+                case 4:
+                  strcpy(c, "memcpy(&instance->FT, &instance->EZ, sizeof(reg_t)); memcpy(&instance->EZ, &instance->DY, sizeof(reg_t)); "
+                         "memcpy(&instance->DY, &instance->CX, sizeof(reg_t));");
+                  strcpy(n, "c -> stack");
+                  break;
+                case 6:
+                  strcpy(c, "memcpy(&instance->A, &instance->DY, sizeof(reg_t)); memcpy(&instance->DY, &instance->EZ, sizeof(reg_t)); "
+                         "memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));");
+                  strcpy(n, "stack -> a");
+                  break;
+                case 8: cls = I_DISPLAY; strcpy(n, "display off"); break;
+                case 10: strcpy(c, "memcpy(&instance->CX, &instance->M, sizeof(reg_t));"); strcpy(n, "m -> c"); break;
+                case 11:
+                  strcpy(c, "if(instance->DataAddr < 10)\n  memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));");
+                  strcpy(n, "data -> c");
+                  break;
+                case 12:
+                  strcpy(c, "memcpy(&temp.r, &instance->CX, sizeof(reg_t)); memcpy(&instance->CX, &instance->DY, sizeof(reg_t)); "
+                         "memcpy(&instance->DY, &instance->EZ, sizeof(reg_t)); memcpy(&instance->EZ, &instance->FT, sizeof(reg_t)); "
+                         "memcpy(&instance->FT, &temp.r, sizeof(reg_t));");
+                  strcpy(n, "down rotate");
+                  break;
+                case 14: strcpy(c, "memset(instance, 0, sizeof(reg_t)*7);"); strcpy(n, "clear registers"); break;
+                case 1: case 5: case 9: case 13: cls = I_UNDEF; *result = -3; break;
+                default: cls = I_UNDEF; *result = -4; break;
+              }
+          }
+          break;
+        case 3: // type 4: pointer
+          switch((o>>2) & 0x03){
+            case 0: sprintf(c, "instance->P = %d;", N); sprintf(n, "%d -> p", N); break;
+            case 1: strcpy(c, "instance->P = (instance->P - 1) & 0x0F;"); strcpy(n, "p - 1 -> p"); break;
+            case 2: sprintf(c, "instance->CY = (instance->P == %d);", N); sprintf(n, "if p # %d", N); break;
+            case 3: strcpy(c, "instance->P = (instance->P + 1) & 0x0F;"); strcpy(n, "p + 1 -> p"); break;
+          }
+          break;
+      }
+      break;
+    case 1: cls = I_JSB; sprintf(n, "jsb %02x", o); break;
+    case 2: { // type 2: arithmetic/register
+      const char *t = type2[o>>3].code;
+      char *p = c + sprintf(c, "instance->ws = %d; ", o & 7);
+
+      while(*t){
+        if(t[0] == '%' && t[1] == 'f'){
+          p += sprintf(p, "%s", field_expr[o & 7]);
+          t += 2;
+        }else{
+          *p++ = *t++;
+        }
+      }
+      *p = 0;
+      sprintf(n, "%s [%s]", type2[o>>3].name, field_name[o & 7]);
+      break;
+    }
+    case 3: cls = I_BRANCH; sprintf(n, "then go to %02x", o); break;
+  }
+  if(cls == I_UNDEF)
+    sprintf(n, "undefined (%d)", *result);
+  if(code)strcpy(code, c);
+  if(name)strcpy(name, n);
+  return cls;
+}
+
+/**
+  * @brief  Mark block leaders: power-on address, branch and call targets,
+            return points, ROM select targets, keyboard entry targets and
+            fall-through addresses after block-ending instructions.
+  * @param  None
+  * @retval None
+  */
+static void find_leaders(void)
+{
+  uint16_t pc, k;
+  int result;
+
+  leader[0] = 1;
+  for(pc = 0; pc < 2048; pc++){
+    const uint16_t opcode = ROM[pc];
+    const uint16_t next = next_pc(pc);
+
+    switch(translate(opcode, NULL, NULL, &result)){
+      case I_BRANCH:
+        leader[(pc & 0xF00) | (opcode>>2)] = 1;
+        leader[next] = 1;
+        break;
+      case I_JSB:
+        leader[(pc & 0xF00) | (opcode>>2)] = 1;
+        leader[next] = 1;
+        break;
+      case I_ROMSEL:
+        leader[(next & 0x0FF) | ((opcode>>7)<<8)] = 1;
+        break;
+      case I_KEYJMP:
+        for(k = 0; k < 64; k++){
+          leader[(pc & 0xF00) | k] = 1;
+        }
+        break;
+      case I_DISPLAY:
+      case I_UNDEF:
+        leader[next] = 1;
+        break;
+    }
+  }
+}
+
+/**
+  * @brief  Emit the C function of the block starting at the given address.
+  * @param  start: leader address
+  * @retval int: number of instructions in the block
+  */
+static int emit_block(uint16_t start)
+{
+  char code[512], name[64];
+  uint16_t pc = start, next;
+  int len = 0, cls, result, merge = 1;
+
+  body_len = 0;
+  for(;;){
+    const uint16_t opcode = ROM[pc];
+
+    cls = translate(opcode, code, name, &result);
+    next = next_pc(pc);
+    len++;
+    emit("  /* %03x: %s */\n", pc, name);
+    if(merge){
+      emit("  instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;\n");
+      merge = 0;
+    }
+    switch(cls){
+      case I_PLAIN:
+      case I_SETS:
+        if(strncmp(code, "instance->CY = ", 15)){
+          emit("  instance->CY = 0;\n");
+        }
+        emit_code(code);
+        merge = (cls == I_SETS);
+        break;
+      case I_BRANCH:
+        emit("  instance->PC = instance->CY ? 0x%03x : 0x%03x;\n", next, (pc & 0xF00) | (opcode>>2));
+        emit("  instance->CY = 0;\n  return 0;\n");
+        break;
+      case I_JSB:
+        emit("  instance->LR = 0x%02x;\n", next & 0xFF);
+        emit("  instance->PC = 0x%03x;\n", (pc & 0xF00) | (opcode>>2));
+        emit("  instance->CY = 0;\n  return 0;\n");
+        break;
+      case I_RET:
+        emit("  instance->CY = 0;\n");
+        emit("  instance->PC = 0x%03x | instance->LR;\n  return 0;\n", pc & 0xF00);
+        break;
+      case I_ROMSEL:
+        emit("  instance->CY = 0;\n");
+        emit("  instance->PC = 0x%03x;\n  return 0;\n", (next & 0x0FF) | ((opcode>>7)<<8));
+        break;
+      case I_KEYJMP:
+        emit("  instance->CY = 0;\n");
+        emit("  instance->PC = 0x%03x | instance->KeyCode;\n  return HP45_EVENT_KEY;\n", pc & 0xF00);
+        break;
+      case I_DISPLAY:
+        emit("  instance->CY = 0;\n  instance->PC = 0x%03x;\n", next);
+        if(opcode & 0x200){ // display off
+          emit("  if(!instance->DispOn)\n    return 0;\n  instance->DispOn = 0;\n");
+        }else{
+          emit("  instance->DispOn = !instance->DispOn;\n");
+        }
+        emit("  return HP45_EVENT_DISPLAY;\n");
+        break;
+      case I_UNDEF:
+        emit("  instance->CY = 0;\n  instance->PC = 0x%03x;\n  return %d;\n", next, result);
+        break;
+    }
+    if(cls > I_SETS)break;
+    pc = next;
+    if(leader[pc] || len == 255){
+      emit("  instance->PC = 0x%03x;\n  return 0;\n", pc);
+      break;
+    }
+  }
+  out("static int block_%03x(hp45inst_t *instance)\n{\n", start);
+  if(strstr(body, "temp."))out("  scratch_t temp;\n\n");
+  out("%s", body);
+  out("}\n\n");
+  return len;
+}
+
+/* Public functions  ---------------------------------------------------------*/
+int main(void)
+{
+  static uint8_t length[2048];
+  uint16_t pc;
+  int n = 0;
+
+#ifdef _WIN32
+  _setmode(_fileno(stdout), _O_BINARY); // out() writes the \r itself
+#endif
+  find_leaders();
+  out("/* Generated by hp45recomp from hp45rom.c. Do not edit.\n"
+      " * Included by hp45sim.c when HP45_RECOMPILED is defined.\n"
+      " */\n\n");
+  for(pc = 0; pc < 2048; pc++){
+    if(leader[pc]){
+      length[pc] = emit_block(pc);
+      n++;
+    }
+  }
+  out("/* %d blocks */\n", n);
+  out("static int (*const blocks[2048])(hp45inst_t*) = {\n");
+  for(pc = 0; pc < 2048; pc++){
+    if(leader[pc])out("  [0x%03x] = block_%03x,\n", pc, pc);
+  }
+  out("};\n\n");
+  out("/* number of word-cycles of each block, 0 where no block starts */\n");
+  out("static const uint8_t block_len[2048] = {");
+  for(pc = 0; pc < 2048; pc++){
+    out("%s%3d,", (pc % 16) ? " " : "\n  ", length[pc]);
+  }
+  out("\n};\n");
+  return 0;
+}
@@ -0,0 +1,501 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Session recording and replay. The calculator is deterministic, so a
+ * session is fully described by its starting state and the word-cycles at
+ * which keys went down and up. The recorder streams these as a few bytes per
+ * event, with a snapshot every so often; replay runs from event to event as
+ * fast as the host allows, skipping idle stretches in constant time, checks
+ * every snapshot it passes, and seeks by restarting from the nearest one.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+#include "hp45replay.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define HEADER_SIZE   12
+#define RECORD_MAX    (1 + 5 + HP45_SNAPSHOT_SIZE)  // tag, delta, largest payload
+#define SETTLE_STEP   64          // word-cycles run between idle checks
+#define GAP_MAX       0x80000000u // word-cycles between records before hp45rec_tick adds a checkpoint
+
+#define TAG_KEY_DOWN  'D'
+#define TAG_KEY_UP    'U'
+#define TAG_CHECK     'C'
+#define TAG_END       'E'
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t Magic[4] = {'H', '4', '5', 'R'};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Hash a snapshot (FNV-1a).
+  * @param  snap: snapshot
+  * @retval uint32_t: hash
+  */
+static uint32_t snapshot_hash(const uint8_t *snap)
+{
+  uint32_t hash = 2166136261u;
+  int i;
+
+  for(i = 0; i < HP45_SNAPSHOT_SIZE; i++){
+    hash = (hash ^ snap[i]) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+  * @brief  Append a record.
+  * @param  rec: recorder
+  * @param  tag: record type
+  * @param  now: instance->cycles
+  * @param  payload: record payload
+  * @param  len: length of payload
+  * @retval None
+  */
+static void put_record(hp45rec_t *rec, uint8_t tag, uint32_t now, const uint8_t *payload, size_t len)
+{
+  uint8_t buf[RECORD_MAX];
+  uint32_t delta = now - rec->last;
+  size_t n = 0;
+
+  buf[n++] = tag;
+  do{
+    buf[n++] = (uint8_t)((delta & 0x7F) | (delta > 0x7F ? 0x80 : 0));
+    delta >>= 7;
+  }while(delta);
+  memcpy(buf + n, payload, len);
+  if(fwrite(buf, n + len, 1, rec->out) != 1)
+    rec->error = -1;
+  rec->last = now;
+}
+
+/**
+  * @brief  Append a checkpoint.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+static void put_checkpoint(hp45rec_t *rec, const hp45inst_t *instance)
+{
+  uint8_t snap[HP45_SNAPSHOT_SIZE];
+
+  hp45_snapshot(instance, snap);
+  put_record(rec, TAG_CHECK, instance->cycles, snap, sizeof(snap));
+  rec->checkpoint = instance->cycles;
+}
+
+/**
+  * @brief  Append a checkpoint if one is due.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+static void check_due(hp45rec_t *rec, const hp45inst_t *instance)
+{
+  if((rec->interval && instance->cycles - rec->checkpoint >= rec->interval)
+     || instance->cycles - rec->last >= GAP_MAX)
+    put_checkpoint(rec, instance);
+}
+
+/**
+  * @brief  Read the tag and cycle delta of a record.
+  * @param  in: recording, positioned at a record
+  * @param  delta: receives the word-cycles since the previous record
+  * @retval int: tag, -1 at the end of the file or on a malformed record.
+  */
+static int get_header(FILE *in, uint32_t *delta)
+{
+  const int tag = getc(in);
+  int c, shift;
+
+  if(tag != TAG_KEY_DOWN && tag != TAG_KEY_UP && tag != TAG_CHECK && tag != TAG_END)
+    return -1;
+  *delta = 0;
+  for(shift = 0; shift < 35; shift += 7){
+    if((c = getc(in)) == EOF)
+      return -1;
+    *delta |= (uint32_t)(c & 0x7F) << shift;
+    if(!(c & 0x80))
+      return tag;
+  }
+  return -1;
+}
+
+/**
+  * @brief  Read the next record into the replay state.
+  * @param  rp: replay
+  * @retval int: 0 on success, -1 at the end of the file or on a malformed record.
+  */
+static int read_record(hp45replay_t *rp)
+{
+  uint8_t hash[4];
+  uint32_t delta;
+  int tag, c;
+
+  if((tag = get_header(rp->in, &delta)) < 0)
+    return -1;
+  rp->next = rp->cycle + delta;
+  switch(tag){
+    case TAG_KEY_DOWN:
+      if((c = getc(rp->in)) == EOF)
+        return -1;
+      rp->key = (uint8_t)c;
+      break;
+    case TAG_CHECK:
+      if(fread(rp->snap, sizeof(rp->snap), 1, rp->in) != 1)
+        return -1;
+      break;
+    case TAG_END:
+      if(fread(hash, sizeof(hash), 1, rp->in) != 1)
+        return -1;
+      rp->hash = hash[0] | hash[1] << 8 | hash[2] << 16 | (uint32_t)hash[3] << 24;
+      break;
+  }
+  rp->tag = (uint8_t)tag;
+  return 0;
+}
+
+/**
+  * @brief  Load a snapshot, keeping what the host attached to the instance.
+  * @param  instance: HP-45 memory object
+  * @param  snap: snapshot
+  * @retval int: 0 on success, -1 if snap is not a snapshot of this version.
+  */
+static int restore(hp45inst_t *instance, const uint8_t *snap)
+{
+  hp45inst_t state;
+
+  if(hp45_restore(&state, snap, HP45_SNAPSHOT_SIZE))
+    return -1;
+#ifdef HP45_PROFILE
+  state.profile = instance->profile;
+#endif
+#ifdef HP45_TRACE
+  state.trace = instance->trace;
+#endif
+#ifdef HP45_DISPLAY_TRACKING
+  state.display_gen = instance->display_gen;
+  state.display_fn = instance->display_fn;
+  state.display_arg = instance->display_arg;
+  state.shown_A = instance->shown_A;
+  state.shown_B = instance->shown_B;
+  state.shown_on = instance->shown_on;
+#endif
+  *instance = state;
+#ifdef HP45_DISPLAY_TRACKING
+  hp45_display_changed(instance);
+#endif
+  return 0;
+}
+
+/**
+  * @brief  Run a number of word-cycles, fast-forwarding while idle.
+  * @param  instance: HP-45 memory object
+  * @param  cycles: word-cycles to run
+  * @retval None
+  */
+static void advance(hp45inst_t *instance, uint64_t cycles)
+{
+  uint32_t burst;
+
+  while(cycles){
+    burst = cycles > 0x40000000u ? 0x40000000u : (uint32_t)cycles;
+    burst = hp45_fast_forward(instance, burst);
+    if(!burst){
+      // busy: run a little, then look for the idle loop again
+      burst = cycles > SETTLE_STEP ? SETTLE_STEP : (uint32_t)cycles;
+      hp45_run_until(instance, HP45_EVENT_NONE, burst);
+    }
+    cycles -= burst;
+  }
+}
+
+/**
+  * @brief  List the places replay can restart from: the start, and every
+            checkpoint up to the end record.
+  * @param  rp: replay, positioned at the first record
+  * @retval int: 0 on success, -1 if out of memory.
+  */
+static int build_index(hp45replay_t *rp)
+{
+  const long first = ftell(rp->in);
+  hp45replay_mark_t *marks;
+  uint32_t capacity = 16, delta;
+  uint64_t cycle = 0;
+  int tag;
+
+  rp->marks = malloc(capacity*sizeof(hp45replay_mark_t));
+  if(!rp->marks)
+    return -1;
+  rp->marks[0].cycle = 0;
+  rp->marks[0].offset = HEADER_SIZE;
+  rp->count = 1;
+  // a recording still being written has no end record; index what is there
+  while((tag = get_header(rp->in, &delta)) >= 0){
+    cycle += delta;
+    if(tag == TAG_END){
+      rp->length = cycle;
+      break;
+    }
+    if(tag == TAG_CHECK){
+      if(rp->count == capacity){
+        marks = realloc(rp->marks, 2*capacity*sizeof(hp45replay_mark_t));
+        if(!marks)
+          return -1;
+        rp->marks = marks;
+        capacity *= 2;
+      }
+      rp->marks[rp->count].cycle = cycle;
+      rp->marks[rp->count].offset = ftell(rp->in);
+      rp->count++;
+    }
+    if(fseek(rp->in, tag == TAG_KEY_DOWN ? 1 : tag == TAG_CHECK ? HP45_SNAPSHOT_SIZE : 0, SEEK_CUR))
+      break;
+  }
+  clearerr(rp->in);
+  return fseek(rp->in, first, SEEK_SET) ? -1 : 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+/**
+  * @brief  Start recording a calculator.
+  * @param  rec: recorder
+  * @param  out: output file, opened in binary mode
+  * @param  instance: HP-45 memory object, in its starting state
+  * @param  interval: word-cycles between checkpoints, 0 for none;
+            e.g. 210000 for one per minute of calculator time
+  * @retval int: 0 on success, -1 on write error.
+  */
+int hp45rec_start(hp45rec_t *rec, FILE *out, const hp45inst_t *instance, uint32_t interval)
+{
+  uint8_t header[HEADER_SIZE + HP45_SNAPSHOT_SIZE] = {0};
+  const uint32_t rom = hp45_rom_fingerprint();
+  int b;
+
+  memcpy(header, Magic, sizeof(Magic));
+  header[4] = HP45_REPLAY_VERSION;
+  for(b = 0; b < 4; b++){
+    header[8 + b] = (uint8_t)(rom >> (8*b));
+  }
+  hp45_snapshot(instance, header + HEADER_SIZE);
+  rec->out = out;
+  rec->last = instance->cycles;
+  rec->checkpoint = instance->cycles;
+  rec->interval = interval;
+  rec->error = fwrite(header, sizeof(header), 1, out) != 1 ? -1 : 0;
+  return rec->error;
+}
+
+/**
+  * @brief  Press a key and record it; use in place of key_down.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object
+  * @param  keycode: HP-45 native key code
+  * @retval None
+  */
+void hp45rec_key_down(hp45rec_t *rec, hp45inst_t *instance, uint8_t keycode)
+{
+  check_due(rec, instance);
+  put_record(rec, TAG_KEY_DOWN, instance->cycles, &keycode, 1);
+  key_down(instance, keycode);
+}
+
+/**
+  * @brief  Release the key and record it; use in place of key_up.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+void hp45rec_key_up(hp45rec_t *rec, hp45inst_t *instance)
+{
+  check_due(rec, instance);
+  put_record(rec, TAG_KEY_UP, instance->cycles, NULL, 0);
+  key_up(instance);
+}
+
+/**
+  * @brief  Add a checkpoint if one is due. Call it now and then, e.g. after
+            each burst, so long stretches without keys get checkpoints too.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+void hp45rec_tick(hp45rec_t *rec, const hp45inst_t *instance)
+{
+  check_due(rec, instance);
+}
+
+/**
+  * @brief  End a recording with the hash of the final state, and flush it.
+  * @param  rec: recorder
+  * @param  instance: HP-45 memory object, in its final state
+  * @retval int: 0 if the whole recording was written, -1 on write error.
+  */
+int hp45rec_finish(hp45rec_t *rec, const hp45inst_t *instance)
+{
+  uint8_t snap[HP45_SNAPSHOT_SIZE], hash[4];
+  uint32_t h;
+  int b;
+
+  check_due(rec, instance);
+  hp45_snapshot(instance, snap);
+  h = snapshot_hash(snap);
+  for(b = 0; b < 4; b++){
+    hash[b] = (uint8_t)(h >> (8*b));
+  }
+  put_record(rec, TAG_END, instance->cycles, hash, sizeof(hash));
+  if(fflush(rec->out))
+    rec->error = -1;
+  return rec->error;
+}
+
+/**
+  * @brief  Open a recording and restore its starting state. If the file is
+            seekable, its checkpoints are indexed for hp45replay_seek.
+            Free with hp45replay_close.
+  * @param  rp: replay
+  * @param  in: recording, opened in binary mode
+  * @param  instance: HP-45 memory object, receives the starting state;
+            profile, trace and display callback fields are kept
+  * @retval int: HP45_REPLAY_OK, or HP45_REPLAY_BAD_FILE.
+  */
+int hp45replay_open(hp45replay_t *rp, FILE *in, hp45inst_t *instance)
+{
+  uint8_t header[HEADER_SIZE + HP45_SNAPSHOT_SIZE];
+  uint32_t rom = 0;
+  int b;
+
+  memset(rp, 0, sizeof(hp45replay_t));
+  rp->in = in;
+  if(fread(header, sizeof(header), 1, in) != 1 || memcmp(header, Magic, sizeof(Magic))
+     || header[4] != HP45_REPLAY_VERSION)
+    return HP45_REPLAY_BAD_FILE;
+  for(b = 0; b < 4; b++){
+    rom |= (uint32_t)header[8 + b] << (8*b);
+  }
+  if(rom != hp45_rom_fingerprint() || restore(instance, header + HEADER_SIZE))
+    return HP45_REPLAY_BAD_FILE;
+  if(ftell(in) == (long)sizeof(header) && build_index(rp)){
+    hp45replay_close(rp);
+    return HP45_REPLAY_BAD_FILE;
+  }
+  return HP45_REPLAY_OK;
+}
+
+/**
+  * @brief  Replay forward, as fast as possible, checking the state against
+            every checkpoint passed.
+  * @param  rp: replay
+  * @param  instance: HP-45 memory object, at the current replay position
+  * @param  cycle: word-cycles since the start of the recording to stop at;
+            UINT64_MAX to play to the end. Events at this cycle are applied.
+  * @retval int: HP45_REPLAY_OK at cycle, HP45_REPLAY_END at the end of the
+                 recording, HP45_REPLAY_DIVERGED with rp->cycle at the
+                 mismatching record, or HP45_REPLAY_BAD_FILE, also if cycle
+                 is behind the current position.
+  */
+int hp45replay_play(hp45replay_t *rp, hp45inst_t *instance, uint64_t cycle)
+{
+  uint8_t snap[HP45_SNAPSHOT_SIZE];
+
+  if(cycle < rp->cycle)
+    return HP45_REPLAY_BAD_FILE;
+  for(;;){
+    if(!rp->tag && read_record(rp))
+      return HP45_REPLAY_BAD_FILE;
+    if(rp->next > cycle){
+      advance(instance, cycle - rp->cycle);
+      rp->cycle = cycle;
+      return HP45_REPLAY_OK;
+    }
+    advance(instance, rp->next - rp->cycle);
+    rp->cycle = rp->next;
+    switch(rp->tag){
+      case TAG_KEY_DOWN:
+        key_down(instance, rp->key);
+        break;
+      case TAG_KEY_UP:
+        key_up(instance);
+        break;
+      case TAG_CHECK:
+        hp45_snapshot(instance, snap);
+        if(memcmp(snap, rp->snap, sizeof(snap))){
+          rp->tag = 0;
+          return HP45_REPLAY_DIVERGED;
+        }
+        break;
+      case TAG_END:
+        hp45_snapshot(instance, snap);
+        return snapshot_hash(snap) == rp->hash ? HP45_REPLAY_END : HP45_REPLAY_DIVERGED;
+    }
+    rp->tag = 0;
+  }
+}
+
+/**
+  * @brief  Move to any cycle of the recording: restore the last checkpoint
+            at or before it, unless playing on from the current position is
+            shorter, then replay the rest.
+  * @param  rp: replay; without an index, i.e. on a pipe, it can only go forward
+  * @param  instance: HP-45 memory object
+  * @param  cycle: word-cycles since the start of the recording
+  * @retval int: as hp45replay_play; HP45_REPLAY_BAD_FILE for a cycle behind
+                 the current position of a replay without an index.
+  */
+int hp45replay_seek(hp45replay_t *rp, hp45inst_t *instance, uint64_t cycle)
+{
+  uint32_t lo = 0, hi = rp->count, mid;
+
+  if(!rp->marks)
+    return hp45replay_play(rp, instance, cycle);
+  // last mark at or before cycle; marks[0] is at cycle 0
+  while(hi - lo > 1){
+    mid = (lo + hi)/2;
+    if(rp->marks[mid].cycle <= cycle)
+      lo = mid;
+    else
+      hi = mid;
+  }
+  if(cycle < rp->cycle || rp->marks[lo].cycle > rp->cycle){
+    if(fseek(rp->in, rp->marks[lo].offset, SEEK_SET)
+       || fread(rp->snap, sizeof(rp->snap), 1, rp->in) != 1
+       || restore(instance, rp->snap))
+      return HP45_REPLAY_BAD_FILE;
+    rp->cycle = rp->marks[lo].cycle;
+    rp->tag = 0;
+  }
+  return hp45replay_play(rp, instance, cycle);
+}
+
+/**
+  * @brief  Free the checkpoint index. The file is not closed.
+  * @param  rp: replay
+  * @retval None
+  */
+void hp45replay_close(hp45replay_t *rp)
+{
+  free(rp->marks);
+  rp->marks = NULL;
+  rp->count = 0;
+}
@@ -0,0 +1,67 @@
+#ifndef __HP45REPLAY_H
+#define __HP45REPLAY_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+
+/* Recording file ------------------------------------------------------------*/
+/* "H45R", version, 3 zero bytes, hp45_rom_fingerprint (32-bit little-endian),
+ * hp45_snapshot of the calculator when recording started, then records.
+ * A record is a tag byte, the word-cycles since the previous record (or the
+ * start) as an unsigned LEB128 number, and a payload:
+ *   'D' key_down: key code, 1 byte
+ *   'U' key_up: none
+ *   'C' checkpoint: hp45_snapshot of the calculator at this cycle
+ *   'E' end: FNV-1a hash of the final hp45_snapshot (32-bit little-endian)
+ */
+#define HP45_REPLAY_VERSION   1
+
+/* Replay results */
+#define HP45_REPLAY_OK        0     // reached the requested cycle
+#define HP45_REPLAY_END       1     // reached the end of the recording, final state verified
+#define HP45_REPLAY_BAD_FILE  (-1)  // not a recording of this version and ROM, truncated, or out of memory
+#define HP45_REPLAY_DIVERGED  (-2)  // state differs from a checkpoint or the final hash
+
+/* Records the key events of one calculator */
+typedef struct{
+  FILE *out;
+  uint32_t last;          // instance->cycles at the previous record
+  uint32_t checkpoint;    // instance->cycles at the previous checkpoint
+  uint32_t interval;      // word-cycles between checkpoints, 0 for none
+  int error;              // a write failed
+} hp45rec_t;
+
+/* A place replay can restart from */
+typedef struct{
+  uint64_t cycle;         // word-cycles since the start of the recording
+  long offset;            // file position of its snapshot
+} hp45replay_mark_t;
+
+/* Plays a recording back */
+typedef struct{
+  FILE *in;
+  uint64_t cycle;         // word-cycles since the start of the recording
+  uint64_t next;          // cycle of the next record
+  uint8_t tag;            // next record, 0 if not read yet
+  uint8_t key;            // ... its key code
+  uint32_t hash;          // ... its final state hash
+  uint8_t snap[HP45_SNAPSHOT_SIZE]; // ... its checkpoint
+  hp45replay_mark_t *marks; // start and checkpoints, NULL if the file is not seekable
+  uint32_t count;
+  uint64_t length;        // cycle of the end record, 0 if unknown
+} hp45replay_t;
+
+int hp45rec_start(hp45rec_t*, FILE*, const hp45inst_t*, uint32_t);
+void hp45rec_key_down(hp45rec_t*, hp45inst_t*, uint8_t);
+void hp45rec_key_up(hp45rec_t*, hp45inst_t*);
+void hp45rec_tick(hp45rec_t*, const hp45inst_t*);
+int hp45rec_finish(hp45rec_t*, const hp45inst_t*);
+
+int hp45replay_open(hp45replay_t*, FILE*, hp45inst_t*);
+int hp45replay_play(hp45replay_t*, hp45inst_t*, uint64_t);
+int hp45replay_seek(hp45replay_t*, hp45inst_t*, uint64_t);
+void hp45replay_close(hp45replay_t*);
+
+#endif /* __HP45REPLAY_H */
@@ -0,0 +1,217 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Replay check: records a session of random keys, runs and idle stretches
+ * into a temporary file, keeping the live state at some of the cycles. Then
+ * plays the recording once from the start, which must pass every sample,
+ * checkpoint and the final hash, and seeks back and forth with one replay:
+ * every seek must give the same state as the live session, or, at cycles
+ * between samples, as playing a fresh replay from the start. Exits 1 on the
+ * first difference.
+ *   cc -O2 -o hp45replaycheck hp45replaycheck.c hp45replay.c hp45snap.c hp45sim.c
+ *   ./hp45replaycheck [bursts] [seeks] [seed]
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+#include "hp45replay.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  uint64_t cycle;                   // word-cycles since the start of the recording
+  uint8_t snap[HP45_SNAPSHOT_SIZE]; // live state there, after the events at that cycle
+} sample_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     35
+#define BUDGET_MAX    3000    // word-cycles per burst, at most
+#define IDLE_MAX      200000  // word-cycles of an idle stretch, at most
+#define INTERVAL      20000   // word-cycles between checkpoints
+#define SAMPLE_EVERY  8       // bursts between samples
+
+/* Private variables ---------------------------------------------------------*/
+/* native codes of all keys */
+static const uint8_t Keys[KEY_COUNT] = {
+  006, 004, 003, 002, 000, 056, 054, 053, 052, 050, 016, 014,
+  013, 012, 010, 076, 073, 072, 070, 066, 064, 063, 062, 026,
+  024, 023, 022, 036, 034, 033, 032, 046, 044, 043, 042,
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Compare a calculator with a snapshot.
+  * @param  instance: HP-45 memory object
+  * @param  snap: snapshot
+  * @retval int: 1 if they are the same state.
+  */
+static int same_state(const hp45inst_t *instance, const uint8_t *snap)
+{
+  uint8_t now[HP45_SNAPSHOT_SIZE];
+
+  hp45_snapshot(instance, now);
+  return !memcmp(now, snap, HP45_SNAPSHOT_SIZE);
+}
+
+/**
+  * @brief  Play a recording from the start to a cycle with a fresh replay,
+            leaving the file position as it was.
+  * @param  file: recording, shared with another replay
+  * @param  instance: HP-45 memory object, receives the state at cycle
+  * @param  cycle: word-cycles since the start of the recording
+  * @retval int: as hp45replay_play.
+  */
+static int full_replay(FILE *file, hp45inst_t *instance, uint64_t cycle)
+{
+  const long position = ftell(file);
+  hp45replay_t rp;
+  int result;
+
+  rewind(file);
+  result = hp45replay_open(&rp, file, instance);
+  if(result == HP45_REPLAY_OK)
+    result = hp45replay_play(&rp, instance, cycle);
+  hp45replay_close(&rp);
+  fseek(file, position, SEEK_SET);
+  return result;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static hp45inst_t calc, play, fresh;
+  const unsigned long bursts = argc > 1 ? strtoul(argv[1], NULL, 0) : 4000;
+  const unsigned long seeks = argc > 2 ? strtoul(argv[2], NULL, 0) : 400;
+  uint32_t x = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 0) : 1, budget, start;
+  unsigned long n, count = 0, between = 0;
+  uint64_t cycle, length;
+  sample_t *samples = malloc((bursts/SAMPLE_EVERY + 1)*sizeof(sample_t));
+  FILE *file = tmpfile();
+  uint8_t snap[HP45_SNAPSHOT_SIZE];
+  uint32_t marks;
+  hp45rec_t rec;
+  hp45replay_t rp;
+  int result, expected;
+
+  if(!x)x = 1;
+  if(!samples || !file){
+    fprintf(stderr, "cannot create the recording\n");
+    return 2;
+  }
+  hp45_init(&calc);
+  start = calc.cycles;
+  hp45rec_start(&rec, file, &calc, INTERVAL);
+  for(n = 0; n < bursts; n++){
+    switch(next_random(&x) % 8){
+      case 0: // press a key
+        hp45rec_key_down(&rec, &calc, Keys[next_random(&x) % KEY_COUNT]);
+        break;
+      case 1:
+        hp45rec_key_up(&rec, &calc);
+        break;
+    }
+    if(n % SAMPLE_EVERY == 0){
+      samples[count].cycle = (uint32_t)(calc.cycles - start);
+      hp45_snapshot(&calc, samples[count].snap);
+      count++;
+    }
+    budget = next_random(&x) % BUDGET_MAX + 1;
+    if(next_random(&x) % 16 == 0)
+      hp45_fast_forward(&calc, next_random(&x) % IDLE_MAX + 1);
+    hp45_run_cycles(&calc, budget, NULL);
+    hp45rec_tick(&rec, &calc);
+  }
+  length = (uint32_t)(calc.cycles - start);
+  if(hp45rec_finish(&rec, &calc)){
+    fprintf(stderr, "cannot write the recording\n");
+    return 2;
+  }
+
+  // one replay from the start through every sample to the end
+  rewind(file);
+  if(hp45replay_open(&rp, file, &play) != HP45_REPLAY_OK || rp.count < 2 || rp.length != length){
+    printf("FAIL: the recording does not open, or its index is wrong (%lu marks, length %llu of %llu)\n",
+           (unsigned long)rp.count, (unsigned long long)rp.length, (unsigned long long)length);
+    return 1;
+  }
+  for(n = 0; n < count; n++){
+    result = hp45replay_play(&rp, &play, samples[n].cycle);
+    if(result != HP45_REPLAY_OK || !same_state(&play, samples[n].snap)){
+      printf("FAIL: playing from the start, cycle %llu returned %d or differs from the session\n",
+             (unsigned long long)samples[n].cycle, result);
+      return 1;
+    }
+  }
+  result = hp45replay_play(&rp, &play, UINT64_MAX);
+  hp45_snapshot(&calc, snap);
+  if(result != HP45_REPLAY_END || !same_state(&play, snap)){
+    printf("FAIL: playing to the end returned %d, or the final state differs\n", result);
+    return 1;
+  }
+
+  // seek back and forth on the same replay
+  for(n = 0; n < seeks; n++){
+    if(n % 4 == 3){
+      // anywhere, compared with a fresh replay from the start
+      cycle = ((uint64_t)next_random(&x) << 32 | next_random(&x)) % (length + 1);
+      result = hp45replay_seek(&rp, &play, cycle);
+      expected = full_replay(file, &fresh, cycle);
+      hp45_snapshot(&fresh, snap);
+      if(result != expected || !same_state(&play, snap)){
+        printf("FAIL: seek %lu to cycle %llu returned %d, playing from the start %d, or the states differ\n", n,
+               (unsigned long long)cycle, result, expected);
+        return 1;
+      }
+      between++;
+    }else{
+      const sample_t *const s = &samples[next_random(&x) % count];
+
+      result = hp45replay_seek(&rp, &play, s->cycle);
+      if(result != HP45_REPLAY_OK || !same_state(&play, s->snap)){
+        printf("FAIL: seek %lu to cycle %llu returned %d or differs from the session\n", n,
+               (unsigned long long)s->cycle, result);
+        return 1;
+      }
+    }
+  }
+  marks = rp.count;
+  hp45replay_close(&rp);
+  fseek(file, 0, SEEK_END);
+  printf("ok: %llu word-cycles, %lu bytes, %lu checkpoints, %lu samples, %lu seeks (%lu between samples)\n",
+         (unsigned long long)length, (unsigned long)ftell(file), (unsigned long)marks - 1, count, seeks, between);
+  fclose(file);
+  free(samples);
+  return 0;
+}
@@ -0,0 +1,338 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Real-time scheduler: runs many calculators at the speed of the real
+ * HP-45 from one thread. Every instance is due once per period on a timer
+ * wheel; when due, it runs all the cycles it owes since it was added, so
+ * late or irregular wake-ups never make it fall behind. Idle instances are
+ * fast-forwarded. Key events from other threads come in through hp45keyq.
+ * Needs POSIX clock_nanosleep for hp45sched_run, and C11 atomics.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "hp45sim.h"
+#include "hp45keyq.h"
+#include "hp45sched.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  hp45inst_t *instance;   // NULL when free or removed
+  hp45keyq_t *keyq;       // key events applied during bursts, may be NULL
+  hp45sched_fn fn;
+  void *arg;
+  uint64_t due;           // tick at which it runs next
+  uint64_t epoch_ns;      // time at which it owed 0 cycles
+  uint64_t done;          // cycles run since epoch_ns
+  uint32_t period;        // in ticks
+  int32_t next;           // next entry in the same slot or the free list
+} entry_t;
+
+struct hp45sched{
+  entry_t *entries;
+  uint32_t capacity;
+  uint32_t count;         // instances scheduled
+  int32_t free;           // first free entry
+  int32_t slot[HP45_SCHED_SLOTS];
+  uint64_t start_ns;      // time of tick 0
+  uint64_t tick_ns;
+  uint64_t tick;          // last tick processed
+  hp45sched_stats_t stats;
+  double late_m2;         // sum of squared deviations of lateness
+};
+
+/* Private macros ------------------------------------------------------------*/
+#define NIL          (-1)
+#define CYCLE_NUM    7        // 35 word-cycles per 10 ms: 7 per 2000000 ns
+#define CYCLE_DEN    2000000u
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Put an entry into the slot of its due tick.
+  * @param  sched: scheduler
+  * @param  i: entry
+  * @retval None
+  */
+static void wheel_insert(hp45sched_t *sched, int32_t i)
+{
+  int32_t *head = &sched->slot[sched->entries[i].due % HP45_SCHED_SLOTS];
+
+  sched->entries[i].next = *head;
+  *head = i;
+}
+
+/**
+  * @brief  Run the cycles an instance owes, then schedule its next burst.
+  * @param  sched: scheduler
+  * @param  e: entry, due now
+  * @param  now: current time
+  * @param  tick: current tick
+  * @retval None
+  */
+static void serve(hp45sched_t *sched, entry_t *e, uint64_t now, uint64_t tick)
+{
+  const uint64_t due_ns = sched->start_ns + e->due*sched->tick_ns;
+  const uint64_t late = now > due_ns ? now - due_ns : 0;
+  const uint64_t owed = (now - e->epoch_ns)*CYCLE_NUM/CYCLE_DEN - e->done;
+  hp45sched_stats_t *s = &sched->stats;
+  uint32_t burst, skipped;
+  uint64_t left;
+  double delta;
+
+  for(left = owed; left; left -= burst){
+    burst = left > 0x40000000u ? 0x40000000u : (uint32_t)left;
+    if(e->keyq){
+      hp45keyq_run(e->keyq, e->instance, burst);
+      continue;
+    }
+    skipped = hp45_fast_forward(e->instance, burst);
+    if(skipped < burst)
+      hp45_run_until(e->instance, HP45_EVENT_NONE, burst - skipped);
+  }
+  e->done += owed;
+  if(e->fn)
+    e->fn(e->instance, e->arg);
+
+  // running statistics of lateness (Welford)
+  s->runs++;
+  s->cycles += owed;
+  if(late > s->late_max_ns)s->late_max_ns = late;
+  if(late > e->period*sched->tick_ns)s->overruns++;
+  delta = late - s->late_mean_ns;
+  s->late_mean_ns += delta/s->runs;
+  sched->late_m2 += delta*(late - s->late_mean_ns);
+
+  // next burst one period after the last due tick, not after now, so it
+  // does not drift; if that has passed already, as soon as possible
+  e->due += e->period;
+  if(e->due <= tick)
+    e->due = tick + 1;
+}
+
+/* Public functions ----------------------------------------------------------*/
+/**
+  * @brief  Read the clock used by hp45sched_run.
+  * @param  None
+  * @retval uint64_t: CLOCK_MONOTONIC time in nanoseconds
+  */
+uint64_t hp45sched_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Create a scheduler.
+  * @param  capacity: maximum number of instances
+  * @param  tick_us: timer wheel resolution in microseconds, 0 for 1000
+  * @param  now: current time in nanoseconds, normally hp45sched_now()
+  * @retval hp45sched_t*: scheduler, NULL if out of memory.
+  */
+hp45sched_t *hp45sched_create(uint32_t capacity, uint32_t tick_us, uint64_t now)
+{
+  hp45sched_t *sched;
+  uint32_t i;
+
+  if(!capacity || capacity > 0x40000000u)
+    return NULL;
+  sched = calloc(1, sizeof(hp45sched_t));
+  if(!sched)
+    return NULL;
+  sched->entries = calloc(capacity, sizeof(entry_t));
+  if(!sched->entries){
+    free(sched);
+    return NULL;
+  }
+  sched->capacity = capacity;
+  for(i = 0; i < capacity; i++){
+    sched->entries[i].next = i + 1 < capacity ? (int32_t)(i + 1) : NIL;
+  }
+  sched->free = 0;
+  for(i = 0; i < HP45_SCHED_SLOTS; i++){
+    sched->slot[i] = NIL;
+  }
+  sched->tick_ns = (uint64_t)(tick_us ? tick_us : 1000)*1000;
+  sched->start_ns = now;
+  return sched;
+}
+
+/**
+  * @brief  Free a scheduler. The instances are not touched.
+  * @param  sched: scheduler
+  * @retval None
+  */
+void hp45sched_destroy(hp45sched_t *sched)
+{
+  if(!sched)
+    return;
+  free(sched->entries);
+  free(sched);
+}
+
+/**
+  * @brief  Start running an instance in real time from the current tick.
+  * @param  sched: scheduler
+  * @param  instance: HP-45 memory object, must stay valid until removed
+  * @param  period: ticks between bursts, 1 to HP45_SCHED_SLOTS-1;
+            e.g. 10 with 1ms ticks runs 35 cycles per burst
+  * @param  fn: called after each burst, may be NULL
+  * @param  arg: passed to fn
+  * @retval int: id for hp45sched_remove, -1 if full or period is out of range.
+  */
+int hp45sched_add(hp45sched_t *sched, hp45inst_t *instance, uint32_t period, hp45sched_fn fn, void *arg)
+{
+  const int32_t i = sched->free;
+  entry_t *e;
+
+  if(i == NIL || !period || period >= HP45_SCHED_SLOTS)
+    return -1;
+  e = &sched->entries[i];
+  sched->free = e->next;
+  e->instance = instance;
+  e->keyq = NULL;
+  e->fn = fn;
+  e->arg = arg;
+  e->period = period;
+  e->epoch_ns = sched->start_ns + sched->tick*sched->tick_ns;
+  e->done = 0;
+  // spread the first bursts over the period so instances added together do
+  // not all wake up on the same tick
+  e->due = sched->tick + 1 + sched->count % period;
+  wheel_insert(sched, i);
+  sched->count++;
+  return i;
+}
+
+/**
+  * @brief  Feed an instance from a key event queue, so other threads can
+            press keys on it while the scheduler runs it.
+  * @param  sched: scheduler
+  * @param  id: returned by hp45sched_add
+  * @param  queue: initialized with hp45keyq_init for this instance, NULL to detach
+  * @retval None
+  */
+void hp45sched_set_keyq(hp45sched_t *sched, int id, hp45keyq_t *queue)
+{
+  if(id < 0 || (uint32_t)id >= sched->capacity || !sched->entries[id].instance)
+    return;
+  sched->entries[id].keyq = queue;
+}
+
+/**
+  * @brief  Stop running an instance. Its entry is reused once its slot comes round.
+  * @param  sched: scheduler
+  * @param  id: returned by hp45sched_add
+  * @retval None
+  */
+void hp45sched_remove(hp45sched_t *sched, int id)
+{
+  if(id < 0 || (uint32_t)id >= sched->capacity || !sched->entries[id].instance)
+    return;
+  sched->entries[id].instance = NULL;
+  sched->count--;
+}
+
+/**
+  * @brief  Run every instance that is due.
+  * @param  sched: scheduler
+  * @param  now: current time in nanoseconds, on the clock given to hp45sched_create
+  * @retval uint64_t: time at which the next instance is due, 0 if none is scheduled.
+  */
+uint64_t hp45sched_poll(hp45sched_t *sched, uint64_t now)
+{
+  const uint64_t target = now > sched->start_ns ? (now - sched->start_ns)/sched->tick_ns : 0;
+  uint64_t t, last;
+  int32_t i, next;
+  entry_t *e;
+
+  // every entry is due within one turn of the wheel, so after a long
+  // pause a single turn serves them all
+  last = target - sched->tick > HP45_SCHED_SLOTS ? sched->tick + HP45_SCHED_SLOTS : target;
+  for(t = sched->tick + 1; t <= last; t++){
+    i = sched->slot[t % HP45_SCHED_SLOTS];
+    sched->slot[t % HP45_SCHED_SLOTS] = NIL;
+    for(; i != NIL; i = next){
+      e = &sched->entries[i];
+      next = e->next;
+      if(!e->instance){
+        e->next = sched->free;
+        sched->free = i;
+        continue;
+      }
+      if(e->due == t)
+        serve(sched, e, now, target);
+      wheel_insert(sched, i);
+    }
+  }
+  if(target > sched->tick)
+    sched->tick = target;
+
+  for(t = sched->tick + 1; t <= sched->tick + HP45_SCHED_SLOTS; t++){
+    if(sched->slot[t % HP45_SCHED_SLOTS] != NIL)
+      return sched->start_ns + t*sched->tick_ns;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Run the scheduled instances in real time, sleeping in between.
+  * @param  sched: scheduler created with hp45sched_now() as the time
+  * @param  duration_ns: how long to run
+  * @retval None
+  */
+void hp45sched_run(hp45sched_t *sched, uint64_t duration_ns)
+{
+  const uint64_t start = hp45sched_now(), end = start + duration_ns;
+  uint64_t now = start, next, t;
+  struct timespec ts;
+
+  while(now < end){
+    next = hp45sched_poll(sched, now);
+    t = hp45sched_now();
+    sched->stats.busy_ns += t - now;
+    now = t;
+    if(!next || next > end)
+      next = end;
+    if(next > now){
+      ts.tv_sec = next/1000000000u;
+      ts.tv_nsec = next%1000000000u;
+      clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    }
+    now = hp45sched_now();
+  }
+  sched->stats.wall_ns += now - start;
+}
+
+/**
+  * @brief  Read the counters.
+  * @param  sched: scheduler
+  * @param  stats: receives the counters
+  * @retval None
+  */
+void hp45sched_stats(const hp45sched_t *sched, hp45sched_stats_t *stats)
+{
+  *stats = sched->stats;
+  stats->jitter_ns = sched->stats.runs > 1 ? sqrt(sched->late_m2/(sched->stats.runs - 1)) : 0;
+  stats->instances = sched->count;
+}
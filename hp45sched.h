@@ -0,0 +1,40 @@
+#ifndef __HP45SCHED_H
+#define __HP45SCHED_H
+
+#include <stdint.h>
+#include "hp45sim.h"
+#include "hp45keyq.h"
+
+#define HP45_SCHED_SLOTS  256   // timer wheel slots; a period must be shorter than the wheel
+
+/* Called after each burst of an instance, e.g. to refresh its display */
+typedef void (*hp45sched_fn)(hp45inst_t*, void*);
+
+/* Counters since hp45sched_create. Lateness is how long after its due tick
+ * an instance was run.
+ */
+typedef struct{
+  uint64_t runs;          // bursts executed
+  uint64_t cycles;        // word-cycles executed or fast-forwarded
+  uint64_t overruns;      // bursts later than their own period
+  uint64_t late_max_ns;   // largest lateness
+  double late_mean_ns;    // mean lateness
+  double jitter_ns;       // standard deviation of lateness
+  uint64_t busy_ns;       // time hp45sched_run spent running bursts
+  uint64_t wall_ns;       // time hp45sched_run spent in total
+  uint32_t instances;     // instances scheduled
+} hp45sched_stats_t;
+
+typedef struct hp45sched hp45sched_t;
+
+uint64_t hp45sched_now(void);
+hp45sched_t *hp45sched_create(uint32_t, uint32_t, uint64_t);
+void hp45sched_destroy(hp45sched_t*);
+int hp45sched_add(hp45sched_t*, hp45inst_t*, uint32_t, hp45sched_fn, void*);
+void hp45sched_set_keyq(hp45sched_t*, int, hp45keyq_t*);
+void hp45sched_remove(hp45sched_t*, int);
+uint64_t hp45sched_poll(hp45sched_t*, uint64_t);
+void hp45sched_run(hp45sched_t*, uint64_t);
+void hp45sched_stats(const hp45sched_t*, hp45sched_stats_t*);
+
+#endif /* __HP45SCHED_H */
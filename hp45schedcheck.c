@@ -0,0 +1,185 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Scheduler check on a virtual clock: schedules N calculators with random
+ * periods of 1 to 20 ticks and polls hp45sched_poll at irregular times, with
+ * one 700 ms stall. After every poll each calculator must have run exactly the
+ * word-cycles owed for the time since it was added (35 per 10 ms), less at
+ * most one period's worth, and never more. Calculators are removed and added
+ * again on the way, which must reuse their entries. Exits 1 on the first
+ * failure.
+ *   cc -O2 -o hp45schedcheck hp45schedcheck.c hp45sched.c hp45keyq.c hp45sim.c -lm
+ *   ./hp45schedcheck [instances] [seconds] [seed]
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "hp45sim.h"
+#include "hp45sched.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  hp45inst_t calc;
+  uint64_t epoch_ns;  // time it was added at, as hp45sched_add counts it
+  uint32_t base;      // calc.cycles when it was added
+  uint32_t period;    // in ticks
+  uint64_t bursts;    // callbacks
+  uint64_t back_ns;   // time to add it again at, 0 while scheduled
+  int id;
+} client_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define TICK_NS       1000000u    // 1 ms ticks
+#define PERIOD_MAX    20
+#define STEP_MAX      3000000u    // longest regular gap between polls
+#define STALL_NS      700000000u  // one long stall
+#define AWAY_NS       300000000u  // time a removed calculator stays out, more than a wheel turn
+#define CYCLES_OF(ns) ((ns)*7/2000000u)
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Burst callback: count it.
+  * @param  instance: HP-45 memory object
+  * @param  arg: client_t
+  * @retval None
+  */
+static void count_burst(hp45inst_t *instance, void *arg)
+{
+  (void)instance;
+  ((client_t*)arg)->bursts++;
+}
+
+/**
+  * @brief  Schedule a calculator from the current tick.
+  * @param  sched: scheduler
+  * @param  c: client
+  * @param  now: time of the last poll
+  * @param  start: time of tick 0
+  * @param  x: random state
+  * @retval int: 0, -1 if hp45sched_add refused it.
+  */
+static int add(hp45sched_t *sched, client_t *c, uint64_t now, uint64_t start, uint32_t *x)
+{
+  c->period = next_random(x) % PERIOD_MAX + 1;
+  c->id = hp45sched_add(sched, &c->calc, c->period, count_burst, c);
+  c->epoch_ns = start + (now - start)/TICK_NS*TICK_NS;
+  c->base = c->calc.cycles;
+  c->back_ns = 0;
+  return c->id < 0 ? -1 : 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  const uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 0) : 2000;
+  const uint64_t end = (argc > 2 ? strtoull(argv[2], NULL, 0) : 5)*1000000000ull;
+  uint32_t x = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 0) : 1, i;
+  const uint64_t start = 1000000000ull;   // any time will do
+  uint64_t now = start, owed, got, slack, polls = 0, readded = 0, runs = 0, cycles = 0;
+  int stalled = 0;
+  hp45sched_stats_t stats;
+  hp45sched_t *sched = hp45sched_create(count, TICK_NS/1000, start);
+  client_t *clients = calloc(count, sizeof(client_t));
+
+  if(!x)x = 1;
+  if(!sched || !clients || !count){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+  for(i = 0; i < count; i++){
+    hp45_init(&clients[i].calc);
+    if(add(sched, &clients[i], now, start, &x)){
+      printf("FAIL: hp45sched_add refused calculator %lu of %lu\n", (unsigned long)i, (unsigned long)count);
+      return 1;
+    }
+  }
+  while(now - start < end){
+    if(!stalled && now - start > end/2){
+      now += STALL_NS;
+      stalled = 1;
+    }else{
+      now += next_random(&x) % STEP_MAX + 1;
+    }
+    hp45sched_poll(sched, now);
+    polls++;
+    for(i = 0; i < count; i++){
+      client_t *const c = &clients[i];
+
+      if(c->back_ns){
+        if(now >= c->back_ns){
+          if(add(sched, c, now, start, &x)){
+            printf("FAIL: a removed entry was not reused, calculator %lu\n", (unsigned long)i);
+            return 1;
+          }
+          readded++;
+        }
+        continue;
+      }
+      owed = CYCLES_OF(now - c->epoch_ns);
+      got = (uint32_t)(c->calc.cycles - c->base);
+      slack = CYCLES_OF((uint64_t)c->period*TICK_NS) + 1;
+      if(got > owed || owed - got > slack){
+        printf("FAIL: %.3f s, calculator %lu (period %lu) ran %llu word-cycles, owes %llu\n",
+               (now - start)/1e9, (unsigned long)i, (unsigned long)c->period, (unsigned long long)got,
+               (unsigned long long)owed);
+        return 1;
+      }
+      if(next_random(&x) % 20000 == 0){
+        hp45sched_remove(sched, c->id);
+        runs += c->bursts;
+        cycles += got;
+        c->bursts = 0;
+        c->back_ns = now + AWAY_NS;
+      }
+    }
+  }
+
+  hp45sched_stats(sched, &stats);
+  for(i = 0; i < count; i++){
+    runs += clients[i].bursts;
+    if(!clients[i].back_ns)
+      cycles += (uint32_t)(clients[i].calc.cycles - clients[i].base);
+  }
+  if(stats.runs != runs || stats.cycles != cycles){
+    printf("FAIL: statistics report %llu bursts and %llu word-cycles, counted %llu and %llu\n",
+           (unsigned long long)stats.runs, (unsigned long long)stats.cycles, (unsigned long long)runs,
+           (unsigned long long)cycles);
+    return 1;
+  }
+  printf("ok: %lu calculators, %.1f s in %llu polls, %llu bursts, %llu word-cycles, %llu removed and added again\n",
+         (unsigned long)count, (now - start)/1e9, (unsigned long long)polls, (unsigned long long)runs,
+         (unsigned long long)cycles, (unsigned long long)readded);
+  hp45sched_destroy(sched);
+  free(clients);
+  return 0;
+}
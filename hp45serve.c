@@ -0,0 +1,588 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Evaluation server: runs keystroke scripts on a job pool and answers with
+ * the display and the X register. Reads one script per line from stdin, or
+ * from the clients of a Unix socket, and answers the lines of a client in
+ * order; a client may send many lines before reading any answer.
+ * Needs POSIX threads and C11 atomics.
+ *   cc -O2 -pthread -o hp45serve hp45serve.c hp45pool.c hp45cache.c hp45num.c hp45snap.c hp45utils.c hp45sim.c -lm
+ *   echo "2 ENTER 3 Y^X" | ./hp45serve
+ *   ./hp45serve -s /tmp/hp45.sock [-t threads] [-c cache-entries]
+ * Protocol, one line each way:
+ *   [x=<number>] <script>
+ *               ok <X register, e.g. 8.000000002e+00> <word-cycles> [<display>]
+ *               error math | error bad-script | error stuck | error too-long
+ *   stats       stats requests=<n> errors=<n> rps=<n> p50_us=<t> p99_us=<t> max_us=<t> ...
+ * x=<number> puts the number into the X register before the first key, see
+ * hp45_set_decimal, which costs nothing compared with typing it.
+ * Latency is counted from the arrival of a line to its answer being queued.
+ * The totals are also printed to stderr on exit (end of stdin, SIGINT or SIGTERM).
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "hp45sim.h"
+#include "hp45pool.h"
+#include "hp45num.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define REQUEST_MAX     1024      // longest request line
+#define SLOTS           256       // requests in flight per client, a power of 2
+#define CLIENTS_MAX     256
+#define ANSWER_MAX      128       // longest answer line but stats
+#define OUT_SIZE        (SLOTS*ANSWER_MAX)
+
+#define KIND_JOB        0         // a script, answered when its job has finished
+#define KIND_STATS      1         // the stats command
+#define KIND_TOO_LONG   2         // a line longer than REQUEST_MAX
+
+#define HIST_SUB        32        // latency histogram buckets per power of 2
+#define HIST_SIZE       (HIST_SUB*40)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  hp45job_t job;
+  char script[REQUEST_MAX + 1];
+  uint64_t recv_ns;       // arrival of the line
+  uint8_t kind;
+  atomic_int ready;       // the job has finished
+} slot_t;
+
+typedef struct{
+  int in, out;            // file descriptors, the same one for a socket
+  int eof;                // no more input
+  int skip;               // discarding the rest of an over-long line
+  char buf[REQUEST_MAX + 4096]; // input not parsed yet
+  size_t len;
+  slot_t *slots;          // requests in arrival order, ring buffer
+  unsigned head, count;
+  char *out_buf;          // answers not written yet
+  size_t out_pos, out_len;
+} client_t;
+
+typedef struct{
+  uint64_t requests;      // answered
+  uint64_t errors;        // answered with an error
+  uint64_t first_ns;      // arrival of the first request
+  uint64_t last_ns;       // last answer
+  uint64_t max_ns;
+  uint64_t hist[HIST_SIZE];
+} stats_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hp45pool_t *Pool;
+static stats_t Stats;
+static int WakeFd[2];               // pipe written by workers when jobs finish
+static atomic_int WakePending;      // a byte is in the pipe, or about to be
+static volatile sig_atomic_t Stop;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000u + ts.tv_nsec;
+}
+
+/**
+  * @brief  Signal handler: ask the main loop to stop.
+  * @param  sig: signal number
+  * @retval None
+  */
+static void on_signal(int sig)
+{
+  (void)sig;
+  Stop = 1;
+}
+
+/**
+  * @brief  Job done callback, called from a worker thread: mark the slot and
+            wake the main loop, writing to the pipe only once per wake-up.
+  * @param  job: finished job
+  * @retval None
+  */
+static void job_done(hp45job_t *job)
+{
+  slot_t *slot = job->user;
+
+  atomic_store_explicit(&slot->ready, 1, memory_order_release);
+  if(!atomic_exchange(&WakePending, 1)){
+    if(write(WakeFd[1], "", 1) < 0){
+      // the pipe is full, so the main loop wakes up anyway
+    }
+  }
+}
+
+/**
+  * @brief  Histogram bucket of a latency: exact below HIST_SUB ns, then
+            HIST_SUB buckets per power of 2, about 3% wide.
+  * @param  ns: latency
+  * @retval unsigned: bucket
+  */
+static unsigned hist_bucket(uint64_t ns)
+{
+  unsigned e;
+
+  if(ns < HIST_SUB)
+    return ns;
+  e = 63 - __builtin_clzll(ns);     // 5 or more
+  if(e - 4 >= HIST_SIZE/HIST_SUB)
+    return HIST_SIZE - 1;
+  return (e - 4)*HIST_SUB + ((ns >> (e - 5)) & (HIST_SUB - 1));
+}
+
+/**
+  * @brief  Lowest latency of a histogram bucket.
+  * @param  bucket: bucket
+  * @retval uint64_t: nanoseconds
+  */
+static uint64_t hist_value(unsigned bucket)
+{
+  if(bucket < HIST_SUB)
+    return bucket;
+  return (uint64_t)(HIST_SUB + bucket%HIST_SUB) << (bucket/HIST_SUB - 1);
+}
+
+/**
+  * @brief  Latency below which a share of the requests were answered.
+  * @param  q: share, 0 to 1
+  * @retval double: microseconds
+  */
+static double percentile_us(double q)
+{
+  uint64_t rank = (uint64_t)(q*Stats.requests), seen = 0;
+  unsigned i;
+
+  for(i = 0; i < HIST_SIZE; i++){
+    seen += Stats.hist[i];
+    if(seen > rank)
+      return hist_value(i)*1e-3;
+  }
+  return Stats.max_ns*1e-3;
+}
+
+/**
+  * @brief  Format the counters as a stats line.
+  * @param  buf: output
+  * @param  size: size of buf
+  * @retval int: length
+  */
+static int format_stats(char *buf, size_t size)
+{
+  hp45pool_stats_t pool;
+  double span = (Stats.last_ns - Stats.first_ns)*1e-9;
+
+  hp45pool_stats(Pool, &pool);
+  return snprintf(buf, size, "stats requests=%llu errors=%llu rps=%.0f p50_us=%.1f p99_us=%.1f max_us=%.1f"
+                  " cycles=%llu workers=%u cache_hits=%llu cache_misses=%llu\n",
+                  (unsigned long long)Stats.requests, (unsigned long long)Stats.errors,
+                  span > 0 ? Stats.requests/span : 0.0, percentile_us(0.5), percentile_us(0.99), Stats.max_ns*1e-3,
+                  (unsigned long long)pool.cycles, pool.workers,
+                  (unsigned long long)pool.cache_hits, (unsigned long long)pool.cache_misses);
+}
+
+/**
+  * @brief  Set up a client.
+  * @param  c: client
+  * @param  in: file descriptor to read requests from
+  * @param  out: file descriptor to write answers to
+  * @retval int: 0 on success, -1 if out of memory.
+  */
+static int client_open(client_t *c, int in, int out)
+{
+  c->eof = c->skip = 0;
+  c->len = 0;
+  c->head = c->count = 0;
+  c->out_pos = c->out_len = 0;
+  c->in = in;
+  c->out = out;
+  c->slots = malloc(SLOTS*sizeof(slot_t));
+  c->out_buf = malloc(OUT_SIZE);
+  if(!c->slots || !c->out_buf){
+    free(c->slots);
+    free(c->out_buf);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Start a request for one line.
+  * @param  c: client, with a free slot
+  * @param  line: request, terminated
+  * @param  kind: KIND_JOB unless the line was too long
+  * @retval None
+  */
+static void request(client_t *c, const char *line, uint8_t kind)
+{
+  slot_t *slot = &c->slots[(c->head + c->count) & (SLOTS - 1)];
+  char *end;
+
+  c->count++;
+  while(*line == ' ' || *line == '\t')line++;
+  if(kind == KIND_JOB && !strcmp(line, "stats"))
+    kind = KIND_STATS;
+  slot->kind = kind;
+  atomic_store_explicit(&slot->ready, kind != KIND_JOB, memory_order_relaxed);
+  if(kind == KIND_STATS)
+    return;
+  slot->recv_ns = now_ns();
+  if(!Stats.first_ns)
+    Stats.first_ns = slot->recv_ns;
+  if(kind != KIND_JOB)
+    return;
+  strcpy(slot->script, line);
+  memset(&slot->job, 0, sizeof(hp45job_t));
+  slot->job.script = slot->script;
+  if(!strncmp(line, "x=", 2)){
+    // split off the input: "x=1.5 SIN" gives input "1.5" and script "SIN"
+    end = slot->script + strcspn(slot->script, " \t");
+    slot->job.input = slot->script + 2;
+    slot->job.script = *end ? end + 1 : end;
+    *end = 0;
+  }
+  slot->job.want = HP45_JOB_X | HP45_JOB_TEXT;
+  slot->job.done = job_done;
+  slot->job.user = slot;
+  if(hp45pool_submit(Pool, &slot->job)){
+    slot->job.status = HP45_JOB_STUCK;
+    atomic_store_explicit(&slot->ready, 1, memory_order_relaxed);
+  }
+}
+
+/**
+  * @brief  Start requests for the complete lines read so far, while there
+            are free slots.
+  * @param  c: client
+  * @retval None
+  */
+static void parse(client_t *c)
+{
+  char *line = c->buf, *end = c->buf + c->len, *nl;
+
+  while(c->count < SLOTS && line < end){
+    nl = memchr(line, '\n', end - line);
+    if(!nl){
+      if(c->eof && !c->skip){
+        // last line without a newline
+        *end = 0;
+        request(c, line, end - line > REQUEST_MAX ? KIND_TOO_LONG : KIND_JOB);
+        line = end;
+      }else if(end - line > REQUEST_MAX){
+        // answer now and drop the rest of the line as it arrives
+        if(!c->skip)
+          request(c, "", KIND_TOO_LONG);
+        c->skip = 1;
+        line = end;
+      }
+      break;
+    }
+    *nl = 0;
+    if(nl > line && nl[-1] == '\r')
+      nl[-1] = 0;
+    if(c->skip)
+      c->skip = 0;
+    else if(*line)
+      request(c, line, nl - line > REQUEST_MAX ? KIND_TOO_LONG : KIND_JOB);
+    line = nl + 1;
+  }
+  c->len = end - line;
+  memmove(c->buf, line, c->len);
+}
+
+/**
+  * @brief  Read what a client has sent.
+  * @param  c: client
+  * @retval None
+  */
+static void receive(client_t *c)
+{
+  ssize_t n;
+
+  if(c->len == sizeof(c->buf) - 1)
+    return;   // full until slots free up
+  n = read(c->in, c->buf + c->len, sizeof(c->buf) - 1 - c->len);
+  if(n > 0)
+    c->len += n;
+  else if(n == 0 || (errno != EAGAIN && errno != EINTR))
+    c->eof = 1;
+  parse(c);
+}
+
+/**
+  * @brief  Queue the answers of the finished requests, in arrival order.
+  * @param  c: client
+  * @retval None
+  */
+static void answer(client_t *c)
+{
+  static const char *const Errors[] = {"", "bad-script", "stuck", "math"};
+  slot_t *slot;
+  char *p, x[HP45_DECIMAL_MAX];
+  uint64_t t, lat;
+
+  while(c->count && OUT_SIZE - c->out_len >= ANSWER_MAX){
+    slot = &c->slots[c->head];
+    if(!atomic_load_explicit(&slot->ready, memory_order_acquire))
+      break;
+    t = now_ns();
+    p = c->out_buf + c->out_len;
+    if(slot->kind == KIND_STATS){
+      if(OUT_SIZE - c->out_len < 2*ANSWER_MAX)
+        break;
+      c->out_len += format_stats(p, 2*ANSWER_MAX);
+    }else{
+      Stats.requests++;
+      lat = t - slot->recv_ns;
+      Stats.hist[hist_bucket(lat)]++;
+      if(lat > Stats.max_ns)
+        Stats.max_ns = lat;
+      Stats.last_ns = t;
+      if(slot->kind == KIND_TOO_LONG){
+        Stats.errors++;
+        c->out_len += sprintf(p, "error too-long\n");
+      }else if(slot->job.status != HP45_JOB_OK){
+        Stats.errors++;
+        c->out_len += sprintf(p, "error %s\n", Errors[-slot->job.status]);
+      }else{
+        hp45_get_decimal(&slot->job.x, x);
+        c->out_len += sprintf(p, "ok %s %lu [%s]\n", x, (unsigned long)slot->job.cycles, slot->job.text);
+      }
+    }
+    c->head = (c->head + 1) & (SLOTS - 1);
+    c->count--;
+  }
+}
+
+/**
+  * @brief  Write queued answers, as much as the client takes.
+  * @param  c: client
+  * @retval None
+  */
+static void flush(client_t *c)
+{
+  ssize_t n;
+
+  while(c->out_pos < c->out_len){
+    n = write(c->out, c->out_buf + c->out_pos, c->out_len - c->out_pos);
+    if(n < 0){
+      if(errno == EINTR)
+        continue;
+      if(errno != EAGAIN){
+        // the client went away: drop its input and answers
+        c->eof = 1;
+        c->len = 0;
+        c->out_pos = c->out_len;
+      }
+      break;
+    }
+    c->out_pos += n;
+  }
+  if(c->out_pos == c->out_len)
+    c->out_pos = c->out_len = 0;
+}
+
+/**
+  * @brief  Tell whether a client can be closed: no more input, every job
+            finished and every answer written.
+  * @param  c: client
+  * @retval int: 1 if done.
+  */
+static int finished(const client_t *c)
+{
+  return c->eof && !c->len && !c->count && !c->out_len;
+}
+
+/**
+  * @brief  Free a client. Its jobs must have finished.
+  * @param  c: client
+  * @retval None
+  */
+static void client_close(client_t *c)
+{
+  if(c->in > 2)
+    close(c->in);
+  free(c->slots);
+  free(c->out_buf);
+}
+
+/**
+  * @brief  Open a listening Unix socket, replacing a stale one.
+  * @param  path: socket path
+  * @retval int: file descriptor, -1 on failure.
+  */
+static int listen_unix(const char *path)
+{
+  struct sockaddr_un addr;
+  int fd;
+
+  if(strlen(path) >= sizeof(addr.sun_path)){
+    fprintf(stderr, "%s: path too long\n", path);
+    return -1;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(fd < 0){
+    perror("socket");
+    return -1;
+  }
+  unlink(path);
+  if(bind(fd, (struct sockaddr*)&addr, sizeof(addr)) || listen(fd, 64)){
+    perror(path);
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  return fd;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static client_t clients[CLIENTS_MAX];
+  static struct pollfd fds[CLIENTS_MAX + 2];
+  const char *path = NULL;
+  unsigned threads = 0, cache = 0, nclients = 0, i, j, k;
+  struct sigaction sa;
+  char line[2*ANSWER_MAX];
+  int opt, fd, listener = -1;
+
+  while((opt = getopt(argc, argv, "s:t:c:")) != -1){
+    switch(opt){
+      case 's': path = optarg; break;
+      case 't': threads = strtoul(optarg, NULL, 0); break;
+      case 'c': cache = strtoul(optarg, NULL, 0); break;
+      default:
+        fprintf(stderr, "usage: %s [-s socket] [-t threads] [-c cache-entries]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = on_signal;
+  sigaction(SIGINT, &sa, NULL);
+  sigaction(SIGTERM, &sa, NULL);
+  signal(SIGPIPE, SIG_IGN);
+  if(pipe(WakeFd)){
+    perror("pipe");
+    return 2;
+  }
+  fcntl(WakeFd[0], F_SETFL, O_NONBLOCK);
+  fcntl(WakeFd[1], F_SETFL, O_NONBLOCK);
+  if(!(Pool = hp45pool_create(threads)) || (cache && hp45pool_set_cache(Pool, cache))){
+    fprintf(stderr, "cannot start the job pool\n");
+    return 2;
+  }
+  if(path){
+    if((listener = listen_unix(path)) < 0)
+      return 2;
+  }else{
+    if(client_open(&clients[0], 0, 1)){
+      fprintf(stderr, "out of memory\n");
+      return 2;
+    }
+    nclients = 1;
+  }
+
+  while(!Stop && (path || nclients)){
+    fds[0].fd = WakeFd[0];
+    fds[0].events = POLLIN;
+    fds[1].fd = nclients < CLIENTS_MAX ? listener : -1;
+    fds[1].events = POLLIN;
+    for(i = 0; i < nclients; i++){
+      fds[2 + i].events = (!clients[i].eof && clients[i].count < SLOTS ? POLLIN : 0)
+                        | (clients[i].out_len && clients[i].in == clients[i].out ? POLLOUT : 0);
+      // not polled while it waits for its jobs, else a hang-up would spin
+      fds[2 + i].fd = fds[2 + i].events ? clients[i].in : -1;
+    }
+    if(poll(fds, 2 + nclients, -1) < 0){
+      if(errno == EINTR)
+        continue;
+      perror("poll");
+      break;
+    }
+    if(fds[0].revents){
+      // clear first, so a job finishing from now on wakes the next poll
+      atomic_store(&WakePending, 0);
+      while(read(WakeFd[0], line, sizeof(line)) > 0);
+    }
+    for(i = 0; i < nclients; i++){
+      if(fds[2 + i].revents & (POLLIN | POLLHUP | POLLERR))
+        receive(&clients[i]);
+    }
+    if(fds[1].revents & POLLIN){
+      while(nclients < CLIENTS_MAX && (fd = accept(listener, NULL, NULL)) >= 0){
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        if(client_open(&clients[nclients], fd, fd))
+          close(fd);
+        else
+          nclients++;
+      }
+    }
+    for(i = 0, k = 0; i < nclients; i++){
+      answer(&clients[i]);
+      flush(&clients[i]);
+      parse(&clients[i]);   // slots may have been freed
+      if(finished(&clients[i])){
+        client_close(&clients[i]);
+        continue;
+      }
+      if(k != i)
+        memcpy(&clients[k], &clients[i], sizeof(client_t));
+      k++;
+    }
+    nclients = k;
+  }
+
+  // let the running jobs finish before their slots go away
+  hp45pool_wait(Pool);
+  for(j = 0; j < nclients; j++){
+    answer(&clients[j]);
+    flush(&clients[j]);
+    client_close(&clients[j]);
+  }
+  if(listener >= 0){
+    close(listener);
+    unlink(path);
+  }
+  format_stats(line, sizeof(line));
+  fputs(line, stderr);
+  hp45pool_destroy(Pool);
+  return 0;
+}
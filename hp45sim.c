@@ -17,110 +17,200 @@
  */
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #include "hp45sim.h"
+#if defined(HP45_PREDECODE) && defined(HP45_RECOMPILED)
+#error "HP45_PREDECODE and HP45_RECOMPILED are exclusive"
+#endif
+#if defined(HP45_PROFILE) && (defined(HP45_PREDECODE) || defined(HP45_RECOMPILED))
+#error "HP45_PROFILE needs the opcode switch engine"
+#endif
+#if defined(HP45_TRACE) && (defined(HP45_PREDECODE) || defined(HP45_RECOMPILED))
+#error "HP45_TRACE needs the opcode switch engine"
+#endif
+#if defined(HP45_REG_SWAR) && defined(HP45_REG_PACKED)
+#error "HP45_REG_SWAR and HP45_REG_PACKED are exclusive"
+#endif
+#if defined(HP45_PREDECODE) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#define HP45_ATOMICS
+#include <stdatomic.h>
+#endif
+
+/* Private types -------------------------------------------------------------*/
+/* Digits selected by the word-select field of an instruction */
+typedef struct{
+  uint8_t s, e;     // start and end digit index
+#ifdef HP45_REG_SWAR
+  uint64_t m;       // 0xF in every selected digit position
+#endif
+} field_t;
+
+/* Scratch register for the constant 1 of increment/decrement/compare.
+ * A field may end at digit 14 or 15 when P > 13, so it has room for
+ * 2 more nibbles, like the registers that follow each other in hp45inst_t.
+ */
+typedef struct{
+  reg_t r;
+  uint8_t spill[2];
+} scratch_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define EVENT_OF(result) ((result) < 0 ? HP45_EVENT_UNDEF : (result))
+
+/* Idle detection: the firmware waits for a key in a loop that polls flag 0
+ * ("if s0 = 1"). The loop is idle when one pass, starting anywhere in it,
+ * leaves the state unchanged.
+ */
+#define OPCODE_TEST_KEY   0x014 // if s0 = 1
+#define IDLE_PERIOD_MAX   16    // longest polling loop looked for, in word-cycles
+
+#ifdef HP45_DISPLAY_TRACKING
+#define DISPLAY_CHECK(instance) hp45_display_changed(instance)
+#else
+#define DISPLAY_CHECK(instance)
+#endif
+
+#ifdef HP45_PROFILE
+#define PROFILE_COUNT(instance) do{ if((instance)->profile)(instance)->profile->pc[(instance)->PC]++; }while(0)
+#else
+#define PROFILE_COUNT(instance)
+#endif
+
+#if defined(__GNUC__)
+#define ALWAYS_INLINE static inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE static inline
+#endif
+
+#ifdef HP45_REG_SWAR
+#define FIELD(s, e) {s, e, (~(uint64_t)0 >> (60 - 4*(e))) & (~(uint64_t)0 << (4*(s)))}
+#else
+#define FIELD(s, e) {s, e}
+#endif
+#define FIELD_ROW(s, e) { \
+    FIELD(s, e), FIELD(s, e), FIELD(s, e), FIELD(s, e), \
+    FIELD(s, e), FIELD(s, e), FIELD(s, e), FIELD(s, e), \
+    FIELD(s, e), FIELD(s, e), FIELD(s, e), FIELD(s, e), \
+    FIELD(s, e), FIELD(s, e), FIELD(s, e), FIELD(s, e)}
+
+/* Fields known at compile time, so that the kernels get constant loop bounds */
+#define FIELD_M     ((field_t)FIELD(3, 12))
+#define FIELD_X     ((field_t)FIELD(0, 2))
+#define FIELD_W     ((field_t)FIELD(0, 13))
+#define FIELD_MS    ((field_t)FIELD(3, 13))
+#define FIELD_XS    ((field_t)FIELD(2, 2))
+#define FIELD_S     ((field_t)FIELD(13, 13))
+#define FIELD_P(P)  (fields[0][(P) & 0x0F])
+#define FIELD_WP(P) (fields[4][(P) & 0x0F])
 
 /* Private variables ---------------------------------------------------------*/
 static const uint16_t ROM[2048] = {
   #include "hp45rom.c"
 };
+#ifdef HP45_REG_SWAR
+static const reg_t zero = {
+  .w = 0,
+};
+#elif defined(HP45_REG_PACKED)
+static const reg_t zero = {
+  .b = {0, 0, 0, 0, 0, 0, 0},
+};
+#else
 static const reg_t zero = {
   .nibble = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
 };
-static reg_t temp;
+#endif
+
+/* word-select field and P register -> selected digits */
+static const field_t fields[8][16] = {
+  { // 0 = p (The nibble indicated by P register)
+    FIELD(0, 0), FIELD(1, 1), FIELD(2, 2), FIELD(3, 3),
+    FIELD(4, 4), FIELD(5, 5), FIELD(6, 6), FIELD(7, 7),
+    FIELD(8, 8), FIELD(9, 9), FIELD(10, 10), FIELD(11, 11),
+    FIELD(12, 12), FIELD(13, 13), FIELD(14, 14), FIELD(15, 15)},
+  FIELD_ROW(3, 12),  // 1 = m (mantissa)
+  FIELD_ROW(0, 2),   // 2 = x (exponent)
+  FIELD_ROW(0, 13),  // 3 = w (word (entire register))
+  { // 4 = wp(word up to and including P register)
+    FIELD(0, 0), FIELD(0, 1), FIELD(0, 2), FIELD(0, 3),
+    FIELD(0, 4), FIELD(0, 5), FIELD(0, 6), FIELD(0, 7),
+    FIELD(0, 8), FIELD(0, 9), FIELD(0, 10), FIELD(0, 11),
+    FIELD(0, 12), FIELD(0, 13), FIELD(0, 14), FIELD(0, 15)},
+  FIELD_ROW(3, 13),  // 5 = ms(mantissa and sign)
+  FIELD_ROW(2, 2),   // 6 = xs(exponent sign)
+  FIELD_ROW(13, 13), // 7 = s ((mantissa) sign)
+};
 
 /* Private function prototypes -----------------------------------------------*/
-static void word_select(hp45inst_t* instance, uint8_t *s, uint8_t *e);
-static void mov(hp45inst_t* instance, reg_t *dst, const reg_t *src);
-static void exch(hp45inst_t* instance, reg_t *r1, reg_t *r2);
-static void shift(hp45inst_t* instance, reg_t *r, uint8_t left);
-static void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z);
-static void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z);
-static void set1(hp45inst_t* instance, reg_t *r);
-static void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2);
-static void ifeq0(hp45inst_t* instance, const reg_t *r);
+ALWAYS_INLINE void mov(reg_t *dst, const reg_t *src, field_t f);
+ALWAYS_INLINE void exch(reg_t *r1, reg_t *r2, field_t f);
+ALWAYS_INLINE void shift(reg_t *r, uint8_t left, field_t f);
+ALWAYS_INLINE void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f);
+ALWAYS_INLINE void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f);
+ALWAYS_INLINE void set1(reg_t *r, field_t f);
+ALWAYS_INLINE void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2, field_t f);
+ALWAYS_INLINE void ifeq0(hp45inst_t* instance, const reg_t *r, field_t f);
 
 /* Public functions  ---------------------------------------------------------*/
-/**
-  * @brief  Calculate start and end index according to word-select field.
-  * @param  instance: HP-45 memory object
-  * @param  s: pointer to store start index
-  * @param  e: pointer to store end index
-  * @retval None
-  */
-static void word_select(hp45inst_t* instance, uint8_t *s, uint8_t *e)
-{
-  switch(instance->ws & 7){
-    case 0: *s = *e = instance->P; break;    // 0 = p (The nibble indicated by P register)
-    case 1: *s = 3; *e = 12; break;          // 1 = m (mantissa)
-    case 2: *s = 0; *e = 2; break;           // 2 = x (exponent)
-    case 3: *s = 0; *e = 13; break;          // 3 = w (word (entire register))
-    case 4: *s = 0; *e = instance->P; break; // 4 = wp(word up to and including P register)
-    case 5: *s = 3; *e = 13; break;          // 5 = ms(mantissa and sign)
-    case 6: *s = 2; *e = 2; break;           // 6 = xs(exponent sign)
-    case 7: *s = 13; *e = 13; break;         // 7 = s ((mantissa) sign)
-  }
-}
-
+#ifndef HP45_REG_SWAR
+/* Digit loops, for the default and HP45_REG_PACKED layouts */
 /**
   * @brief  Move (copy) the specified field of a register to another.
-  * @param  instance: HP-45 memory object
   * @param  dst: pointer to destination register
   * @param  src: pointer to source register
+  * @param  f: selected digits
   * @retval None
   */
-static void mov(hp45inst_t* instance, reg_t *dst, const reg_t *src)
+ALWAYS_INLINE void mov(reg_t *dst, const reg_t *src, field_t f)
 {
-  uint8_t i, s, e;
+  uint8_t i;
 
-  word_select(instance, &s, &e);
-  for(i = s; i <= e; i++){
-    dst->nibble[i] = src->nibble[i];
+  for(i = f.s; i <= f.e; i++){
+    HP45_SET_DIGIT(dst, i, HP45_DIGIT(src, i));
   }
 }
 
 /**
   * @brief  Exhchange the specified field of 2 registers.
-  * @param  instance: HP-45 memory object
   * @param  r1: pointer to one register
   * @param  r2: pointer to the other register
+  * @param  f: selected digits
   * @retval None
   */
-static void exch(hp45inst_t* instance, reg_t *r1, reg_t *r2)
+ALWAYS_INLINE void exch(reg_t *r1, reg_t *r2, field_t f)
 {
-  uint8_t i, s, e, t;
+  uint8_t i, t;
 
-  word_select(instance, &s, &e);
-  for(i = s; i <= e; i++){
-    t = r1->nibble[i];
-    r1->nibble[i] = r2->nibble[i];
-    r2->nibble[i] = t;
+  for(i = f.s; i <= f.e; i++){
+    t = HP45_DIGIT(r1, i);
+    HP45_SET_DIGIT(r1, i, HP45_DIGIT(r2, i));
+    HP45_SET_DIGIT(r2, i, t);
   }
 }
 
 /**
   * @brief  Shift the specified field of a register.
-  * @param  instance: HP-45 memory object
   * @param  r: pointer to register
   * @param  left: direction. non-zero for left and 0 for right.
+  * @param  f: selected digits
   * @retval None
   */
-static void shift(hp45inst_t* instance, reg_t *r, uint8_t left)
+ALWAYS_INLINE void shift(reg_t *r, uint8_t left, field_t f)
 {
-  uint8_t i, s, e;
+  uint8_t i;
 
-  word_select(instance, &s, &e);
   if(left){
-    for(i = e; i > s; i--){
-      r->nibble[i] = r->nibble[i-1];
+    for(i = f.e; i > f.s; i--){
+      HP45_SET_DIGIT(r, i, HP45_DIGIT(r, i-1));
     }
-    r->nibble[s] = 0;
+    HP45_SET_DIGIT(r, f.s, 0);
   }else{
-    for(i = s; i < e; i++){
-      r->nibble[i] = r->nibble[i+1];
+    for(i = f.s; i < f.e; i++){
+      HP45_SET_DIGIT(r, i, HP45_DIGIT(r, i+1));
     }
-    r->nibble[e] = 0;
+    HP45_SET_DIGIT(r, f.e, 0);
   }
 }
 
@@ -129,16 +219,16 @@ static void shift(hp45inst_t* instance, reg_t *r, uint8_t left)
   * @param  instance: HP-45 memory object
   * @param  x, y: pointer to operand registers
   * @param  z: pointer to result register
+  * @param  f: selected digits
   * @retval None
   */
-static void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z)
+ALWAYS_INLINE void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f)
 {
-  uint8_t a, b, c, i, s, e, cy = 0;
+  uint8_t a, b, c, i, cy = 0;
 
-  word_select(instance, &s, &e);
-  for(i = s; i <= e; i++){
-    a = x->nibble[i];
-    b = y->nibble[i];
+  for(i = f.s; i <= f.e; i++){
+    a = HP45_DIGIT(x, i);
+    b = HP45_DIGIT(y, i);
     c = a+b+cy;
     if(c >= 10){
       cy = 1;
@@ -146,7 +236,7 @@ static void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z)
     }else{
       cy = 0;
     }
-    z->nibble[i] = c;
+    HP45_SET_DIGIT(z, i, c);
   }
   instance->CY = cy;
 }
@@ -156,16 +246,16 @@ static void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z)
   * @param  instance: HP-45 memory object
   * @param  x, y: pointer to operand registers
   * @param  z: pointer to result register
+  * @param  f: selected digits
   * @retval None
   */
-static void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z)
+ALWAYS_INLINE void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f)
 {
-  uint8_t a, b, c, i, s, e, cy = 0;
+  uint8_t a, b, c, i, cy = 0;
 
-  word_select(instance, &s, &e);
-  for(i = s; i <= e; i++){
-    a = x->nibble[i];
-    b = y->nibble[i];
+  for(i = f.s; i <= f.e; i++){
+    a = HP45_DIGIT(x, i);
+    b = HP45_DIGIT(y, i);
     c = a-b-cy;
     if(c & 0x80){
       cy = 1;
@@ -173,26 +263,35 @@ static void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z)
     }else{
       cy = 0;
     }
-    z->nibble[i] = c;
+    HP45_SET_DIGIT(z, i, c);
   }
   instance->CY = cy;
 }
 
 /**
   * @brief  Set value of 1 to the specified field of a register.
-  * @param  instance: HP-45 memory object
+            In the HP45_REG_PACKED layout, the other digit of the first and
+            last byte is cleared too, so the scratch register it is used on
+            need not be initialized.
   * @param  r: pointer to the register
+  * @param  f: selected digits
   * @retval None
   */
-static void set1(hp45inst_t* instance, reg_t *r)
+ALWAYS_INLINE void set1(reg_t *r, field_t f)
 {
-  uint8_t i, s, e;
+  uint8_t i;
 
-  word_select(instance, &s, &e);
-  r->nibble[s] = 1;
-  for(i = s+1; i <= e; i++){
-    r->nibble[i] = 0;
+#ifdef HP45_REG_PACKED
+  r->b[f.s>>1] = (f.s & 1) ? 0x10 : 0x01;
+  for(i = (f.s>>1) + 1; i <= f.e>>1; i++){
+    r->b[i] = 0;
+  }
+#else
+  HP45_SET_DIGIT(r, f.s, 1);
+  for(i = f.s+1; i <= f.e; i++){
+    HP45_SET_DIGIT(r, i, 0);
   }
+#endif
 }
 
 /**
@@ -200,23 +299,23 @@ static void set1(hp45inst_t* instance, reg_t *r)
             Carry flag is cleared if r1> = r2, or set if r1<r2.
   * @param  instance: HP-45 memory object
   * @param  r1, r2: pointer to operand registers
+  * @param  f: selected digits
   * @retval None
   */
-static void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2)
+ALWAYS_INLINE void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2, field_t f)
 {
-  uint8_t a, b, i, s, e;
+  uint8_t a, b, i;
 
-  word_select(instance, &s, &e);
-  for(i = e; ; i--){
-    a = r1->nibble[i];
-    b = r2->nibble[i];
+  for(i = f.e; ; i--){
+    a = HP45_DIGIT(r1, i);
+    b = HP45_DIGIT(r2, i);
     if(a > b){
       break;
     }else if(a < b){
       instance->CY = 1;
       break;
     }
-    if(i == s)break;
+    if(i == f.s)break;
   }
 }
 
@@ -225,20 +324,168 @@ static void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2)
             Carry flag is cleared if r =  = 0, or set if r! = 0.
   * @param  instance: HP-45 memory object
   * @param  r: pointer to operand register
+  * @param  f: selected digits
   * @retval None
   */
-static void ifeq0(hp45inst_t* instance, const reg_t *r)
+ALWAYS_INLINE void ifeq0(hp45inst_t* instance, const reg_t *r, field_t f)
 {
-  uint8_t i, s, e;
+  uint8_t i;
 
-  word_select(instance, &s, &e);
-  for(i = s; i<= e; i++){
-    if(r->nibble[i]){
+  for(i = f.s; i<= f.e; i++){
+    if(HP45_DIGIT(r, i)){
       instance->CY = 1;
       break;
     }
   }
 }
+#else /* HP45_REG_SWAR */
+#define DIGITS_1 UINT64_C(0x1111111111111111)
+#define DIGITS_9 UINT64_C(0x9999999999999999)
+
+/**
+  * @brief  Branch-free BCD addition of 2 fields with carry in and out.
+            Both operands must hold BCD digits inside the mask and 0 outside.
+            Every digit is biased by 6 so that decimal carries become binary ones,
+            then the bias is taken back from the digits that did not carry.
+  * @param  x, y: masked operands
+  * @param  m: digit mask of the field
+  * @param  cy: in: carry into the lowest digit. out: carry out of the highest digit.
+  * @retval uint64_t: masked sum
+  */
+ALWAYS_INLINE uint64_t bcd_add(uint64_t x, uint64_t y, uint64_t m, uint8_t *cy)
+{
+  const uint64_t ones = DIGITS_1 & m;
+  const uint64_t t1 = x + ones*6;
+  const uint64_t t2 = y + ((m & (0 - m)) & (0 - (uint64_t)*cy)); // carry in at the lowest digit
+  const uint64_t sum = t1 + t2;
+  uint64_t c;
+
+  c = (sum ^ t1 ^ t2) >> 4;           // carry out of each digit, at bit 0 of the digit
+  c |= (uint64_t)(sum < t1) << 60;    // carry out of digit 15 falls off the word
+  c &= ones;
+  *cy = (c & ~(ones >> 4)) != 0;
+  return (sum - (ones & ~c)*6) & m;
+}
+
+/**
+  * @brief  Move (copy) the specified field of a register to another.
+  * @param  dst: pointer to destination register
+  * @param  src: pointer to source register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void mov(reg_t *dst, const reg_t *src, field_t f)
+{
+  dst->w = (dst->w & ~f.m) | (src->w & f.m);
+}
+
+/**
+  * @brief  Exhchange the specified field of 2 registers.
+  * @param  r1: pointer to one register
+  * @param  r2: pointer to the other register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void exch(reg_t *r1, reg_t *r2, field_t f)
+{
+  const uint64_t t = (r1->w ^ r2->w) & f.m;
+
+  r1->w ^= t;
+  r2->w ^= t;
+}
+
+/**
+  * @brief  Shift the specified field of a register.
+  * @param  r: pointer to register
+  * @param  left: direction. non-zero for left and 0 for right.
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void shift(reg_t *r, uint8_t left, field_t f)
+{
+  const uint64_t v = r->w & f.m;
+
+  r->w = (r->w & ~f.m) | ((left ? v << 4 : v >> 4) & f.m);
+}
+
+/**
+  * @brief  Perform BCD addition z = x+y on the specified field of 3 registers.
+  * @param  instance: HP-45 memory object
+  * @param  x, y: pointer to operand registers
+  * @param  z: pointer to result register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void add(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f)
+{
+  uint8_t cy = 0;
+  const uint64_t sum = bcd_add(x->w & f.m, y->w & f.m, f.m, &cy);
+
+  z->w = (z->w & ~f.m) | sum;
+  instance->CY = cy;
+}
+
+/**
+  * @brief  Perform BCD subtraction z = x-y on the specified field of 3 registers.
+            Computed as x + (9's complement of y) + 1; no carry out means borrow.
+  * @param  instance: HP-45 memory object
+  * @param  x, y: pointer to operand registers
+  * @param  z: pointer to result register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void sub(hp45inst_t* instance, const reg_t *x, const reg_t *y, reg_t *z, field_t f)
+{
+  uint8_t cy = 1;
+  const uint64_t diff = bcd_add(x->w & f.m, (DIGITS_9 & f.m) - (y->w & f.m), f.m, &cy);
+
+  z->w = (z->w & ~f.m) | diff;
+  instance->CY = !cy;
+}
+
+/**
+  * @brief  Set value of 1 to the specified field of a scratch register.
+            Digits outside the field are cleared rather than kept.
+  * @param  r: pointer to the register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void set1(reg_t *r, field_t f)
+{
+  r->w = f.m & (0 - f.m) & DIGITS_1;
+}
+
+/**
+  * @brief  Perform r1> = r2 comparison on the specified field of 2 registers.
+            Carry flag is cleared if r1> = r2, or set if r1<r2.
+            Digits are packed most significant first, so this is an integer compare.
+  * @param  instance: HP-45 memory object
+  * @param  r1, r2: pointer to operand registers
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void ifge(hp45inst_t* instance, const reg_t *r1, const reg_t *r2, field_t f)
+{
+  if((r1->w & f.m) < (r2->w & f.m)){
+    instance->CY = 1;
+  }
+}
+
+/**
+  * @brief  Perform r =  = 0 comparison on the specified field of a register.
+            Carry flag is cleared if r =  = 0, or set if r! = 0.
+  * @param  instance: HP-45 memory object
+  * @param  r: pointer to operand register
+  * @param  f: selected digits
+  * @retval None
+  */
+ALWAYS_INLINE void ifeq0(hp45inst_t* instance, const reg_t *r, field_t f)
+{
+  if(r->w & f.m){
+    instance->CY = 1;
+  }
+}
+#endif /* HP45_REG_SWAR */
 
 /**
   * @brief  Decode type 2 (arithmatic/register) instructions (with opcode of xxxx_xxxx_10).
@@ -248,120 +495,123 @@ static void ifeq0(hp45inst_t* instance, const reg_t *r)
   */
 int opcode10(hp45inst_t* instance, uint8_t opcode)
 {
+  const field_t f = fields[opcode & 7][instance->P & 0x0F];
+  scratch_t temp;
+
   instance->ws = opcode & 7;
   switch(opcode>>3){
     /* === 1) clear === */
     case 23: // 0->A
-      mov(instance, &instance->A, &zero);
+      mov(&instance->A, &zero, f);
       break;
     case 1:  // 0->B
-      mov(instance, &instance->B, &zero);
+      mov(&instance->B, &zero, f);
       break;
     case 6:  // 0->C 
-      mov(instance, &instance->CX, &zero);
+      mov(&instance->CX, &zero, f);
       break;
     /* === 2) transfer/exchange === */
     case 9:  // A->B
-      mov(instance, &instance->B, &instance->A);
+      mov(&instance->B, &instance->A, f);
       break;
     case 4:  // B->C
-      mov(instance, &instance->CX, &instance->B);
+      mov(&instance->CX, &instance->B, f);
       break;
     case 12: // C->A
-      mov(instance, &instance->A, &instance->CX);
+      mov(&instance->A, &instance->CX, f);
       break;
     case 25: // A<->B
-      exch(instance, &instance->A, &instance->B);
+      exch(&instance->A, &instance->B, f);
       break;
     case 17: // B<->C
-      exch(instance, &instance->B, &instance->CX);
+      exch(&instance->B, &instance->CX, f);
       break;
     case 29: // C<->A
-      exch(instance, &instance->A, &instance->CX);
+      exch(&instance->A, &instance->CX, f);
       break;
     /* === 3) add/subtract === */
     case 14: // A+C->C
-      add(instance, &instance->A, &instance->CX, &instance->CX);
+      add(instance, &instance->A, &instance->CX, &instance->CX, f);
       break;
     case 10: // A-C->C
-      sub(instance, &instance->A, &instance->CX, &instance->CX);
+      sub(instance, &instance->A, &instance->CX, &instance->CX, f);
       break;
     case 28: // A+B->A
-      add(instance, &instance->A, &instance->B, &instance->A);
+      add(instance, &instance->A, &instance->B, &instance->A, f);
       break;
     case 24: // A-B->A
-      sub(instance, &instance->A, &instance->B, &instance->A);
+      sub(instance, &instance->A, &instance->B, &instance->A, f);
       break;
     case 30: // A+C->A
-      add(instance, &instance->A, &instance->CX, &instance->A);
+      add(instance, &instance->A, &instance->CX, &instance->A, f);
       break;
     case 26: // A-C->A
-      sub(instance, &instance->A, &instance->CX, &instance->A);
+      sub(instance, &instance->A, &instance->CX, &instance->A, f);
       break;
     case 21: // C+C->C
-      add(instance, &instance->CX, &instance->CX, &instance->CX);
+      add(instance, &instance->CX, &instance->CX, &instance->CX, f);
       break;
     /* === 4) compare === */
     case 0:  // 0-B
-      ifeq0(instance, &instance->B);
+      ifeq0(instance, &instance->B, f);
       break;
     case 13: // 0-C
-      ifeq0(instance, &instance->CX);
+      ifeq0(instance, &instance->CX, f);
       break;
     case 2:  // A-C
-      ifge(instance, &instance->A, &instance->CX);
+      ifge(instance, &instance->A, &instance->CX, f);
       break;
     case 16: // A-B
-      ifge(instance, &instance->A, &instance->B);
+      ifge(instance, &instance->A, &instance->B, f);
       break;
     case 19: // A-1
-      set1(instance, &temp);
-      ifge(instance, &instance->A, &temp);
+      set1(&temp.r, f);
+      ifge(instance, &instance->A, &temp.r, f);
       break;
     case 3:  // C-1
-      set1(instance, &temp);
-      ifge(instance, &instance->CX, &temp);
+      set1(&temp.r, f);
+      ifge(instance, &instance->CX, &temp.r, f);
       break;
     /* === 5) complement === */
     case 5: // 0-C->C
-      sub(instance, &zero, &instance->CX, &instance->CX);
+      sub(instance, &zero, &instance->CX, &instance->CX, f);
       break;
     case 7: // 0-C-1->C
-      sub(instance, &zero, &instance->CX, &instance->CX);
-      set1(instance, &temp);
-      sub(instance, &instance->CX, &temp, &instance->CX);
+      sub(instance, &zero, &instance->CX, &instance->CX, f);
+      set1(&temp.r, f);
+      sub(instance, &instance->CX, &temp.r, &instance->CX, f);
       instance->CY = 1;
       break;
     /* === 6) increment === */
     case 31: // A+1->A
-      set1(instance, &temp);
-      add(instance, &instance->A, &temp, &instance->A);
+      set1(&temp.r, f);
+      add(instance, &instance->A, &temp.r, &instance->A, f);
       break;
     case 15: // C+1->C
-      set1(instance, &temp);
-      add(instance, &instance->CX, &temp, &instance->CX);
+      set1(&temp.r, f);
+      add(instance, &instance->CX, &temp.r, &instance->CX, f);
       break;
     /* === 7) decrement === */
     case 27: // A-1->A
-      set1(instance, &temp);
-      sub(instance, &instance->A, &temp, &instance->A);
+      set1(&temp.r, f);
+      sub(instance, &instance->A, &temp.r, &instance->A, f);
       break;
     case 11: // C-1->C
-      set1(instance, &temp);
-      sub(instance, &instance->CX, &temp, &instance->CX);
+      set1(&temp.r, f);
+      sub(instance, &instance->CX, &temp.r, &instance->CX, f);
       break;
     /* === 8) shift === */
     case 22: // shift A right
-      shift(instance, &instance->A, 0);
+      shift(&instance->A, 0, f);
       break;
     case 20: // shift B right
-      shift(instance, &instance->B, 0);
+      shift(&instance->B, 0, f);
       break;
     case 18: // shift C right
-      shift(instance, &instance->CX, 0);
+      shift(&instance->CX, 0, f);
       break;
     case 8:  // shift A left
-      shift(instance, &instance->A, 1);
+      shift(&instance->A, 1, f);
       break;
   }
 
@@ -437,11 +687,13 @@ int opcode1100(hp45inst_t *instance, uint8_t opcode)
   * @brief  Decode type 5 (data entry/display) instructions (with opcode of xxxx_xx10_00).
   * @param  instance: HP-45 memory object
   * @param  opcode: bit 2 to 9 of opcode
-  * @retval int: negative value for undefined opcode.
+  * @retval int: negative value for undefined opcode,
+                 HP45_EVENT_DISPLAY if DispOn changed.
   */
 int opcode1000(hp45inst_t *instance, uint8_t opcode)
 {
   const uint8_t N = opcode>>4;
+  reg_t temp;
 
   switch((opcode>>2) & 0x03){
     case 0: // 16 available instructions
@@ -449,7 +701,7 @@ int opcode1000(hp45inst_t *instance, uint8_t opcode)
     case 1: // enter 4 bit code N into C at P (load constant)
       if(N >= 10)return -2;
       if(instance->P < 14)
-        instance->CX.nibble[instance->P] = N;
+        HP45_SET_DIGIT(&instance->CX, instance->P, N);
       instance->P = (instance->P - 1) & 0x0F;
       break;
     case 2:
@@ -457,7 +709,7 @@ int opcode1000(hp45inst_t *instance, uint8_t opcode)
       switch(N){
         case 0: // display toggle
           instance->DispOn = !instance->DispOn;
-          break;
+          return HP45_EVENT_DISPLAY;
         case 2: // exchange memory, C->M->C
           memcpy(&temp, &instance->CX, sizeof(reg_t));
           memcpy(&instance->CX, &instance->M, sizeof(reg_t));
@@ -474,7 +726,10 @@ int opcode1000(hp45inst_t *instance, uint8_t opcode)
           memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
           break;
         case 8: // display off
-          instance->DispOn = 0;
+          if(instance->DispOn){
+            instance->DispOn = 0;
+            return HP45_EVENT_DISPLAY;
+          }
           break;
         case 10: // recall memory, M->M->C
           memcpy(&instance->CX, &instance->M, sizeof(reg_t));
@@ -510,7 +765,8 @@ int opcode1000(hp45inst_t *instance, uint8_t opcode)
   * @brief  Decode type 6-10 (ROM select, misc, etc) instructions (with opcode of xxxx_xx00_00).
   * @param  instance: HP-45 memory object
   * @param  opcode: bit 2 to 9 of opcode
-  * @retval int: negative value for undefined opcode.
+  * @retval int: negative value for undefined opcode,
+                 HP45_EVENT_KEY for keyboard entry.
   */
 int opcode0000(hp45inst_t *instance, uint8_t opcode)
 {
@@ -527,13 +783,14 @@ int opcode0000(hp45inst_t *instance, uint8_t opcode)
       case 2:
         if(N & 1){ // keyboard entry
           instance->PC = (instance->PC & 0xF00) | instance->KeyCode;
+          return HP45_EVENT_KEY;
         }else{ // external key code entry
           return -1;
         }
         break;
       case 3:
         if((N & 0x5) == 0x4){ // send address from C to data storage circuit
-          instance->DataAddr = instance->CX.nibble[12];
+          instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
         }else if(N == 0x5){ // send data from C into auxiliary data storage circuit
           if(instance->DataAddr < 10)
             memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
@@ -557,51 +814,18 @@ int opcode0000(hp45inst_t *instance, uint8_t opcode)
   return 0;
 }
 
-/* Public functions  ---------------------------------------------------------*/
-/**
-  * @brief  Notice VM that a key is pressed.
-  * @param  instance: HP-45 memory object
-  * @param  keycode: HP-45 native key code.
-            Undefined key code may result in unexpected behavior.
-  * @retval None
-  */
-void key_down(hp45inst_t* instance, uint8_t keycode)
-{
-  instance->KeyCode = keycode;
-  instance->keydown = 1;
-}
-
-/**
-  * @brief  Notice VM that a key is released.
-  * @param  instance: HP-45 memory object
-  * @retval None
-  */
-void key_up(hp45inst_t* instance)
-{
-  instance->keydown = 0;
-}
-
-/**
-  * @brief  Initialize HP-45 memory to initial state (all-zero).
-  * @param  instance: HP-45 memory object
-  * @retval None
-  */
-void hp45_init(hp45inst_t *instance)
-{  
-  memset(instance, 0, sizeof(hp45inst_t));
-}
-
+#ifndef HP45_PREDECODE
 /**
-  * @brief  Perform simulation for 1 word-cycle (i.e. run 1 step)
-            To simulate the speed of a real HP-45 machine,
-            call this function every 286us (35 cycles per 10ms).
+  * @brief  Fetch, decode and execute 1 instruction with the opcode switch.
   * @param  instance: HP-45 memory object
-  * @retval None
+  * @retval int: negative value for undefined opcode,
+                 HP45_EVENT_* if the instruction caused an event, otherwise 0.
   */
-int hp45_run(hp45inst_t *instance)
+static int step(hp45inst_t *instance)
 {
   const uint16_t opcode = ROM[instance->PC];
 
+  PROFILE_COUNT(instance);
   instance->PC = (instance->PC & 0xF00) | ((instance->PC+1) & 0xFF);
   instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
   switch(opcode&0x003){
@@ -639,3 +863,1249 @@ int hp45_run(hp45inst_t *instance)
 
   return -1;
 }
+
+#ifdef HP45_TRACE
+/* Registers each instruction may write, as bits of the trace register
+ * number (A=bit 0 ... M=bit 6, RAM k=bit 7+k)
+ */
+#define TR_A  0x01
+#define TR_B  0x02
+#define TR_C  0x04
+#define TR_D  0x08
+#define TR_E  0x10
+#define TR_F  0x20
+#define TR_M  0x40
+
+/* type 2, indexed by opcode>>5 */
+static const uint8_t trace_type2[32] = {
+  0, TR_B, 0, 0, TR_C, TR_C, TR_C, TR_C,
+  TR_A, TR_B, TR_C, TR_C, TR_A, 0, TR_C, TR_C,
+  0, TR_B|TR_C, TR_C, 0, TR_B, TR_C, TR_A, TR_A,
+  TR_A, TR_A|TR_B, TR_A, TR_A, TR_A, TR_A|TR_C, TR_A, TR_A,
+};
+
+/* type 5 data entry/display, indexed by opcode>>6 */
+static const uint8_t trace_type5[16] = {
+  0, 0, TR_C|TR_M, 0, TR_D|TR_E|TR_F, 0, TR_A|TR_D|TR_E, 0,
+  0, 0, TR_C, TR_C, TR_C|TR_D|TR_E|TR_F, 0, 0x7F, 0,
+};
+
+/**
+  * @brief  Find the registers an instruction may write.
+  * @param  instance: HP-45 memory object, before the instruction
+  * @param  opcode: instruction
+  * @retval uint32_t: bit i set if register i of the trace numbering may change.
+  */
+static inline uint32_t trace_targets(const hp45inst_t *instance, uint16_t opcode)
+{
+  const uint8_t o = opcode>>2;
+  uint32_t mask;
+
+  switch(opcode & 0x003){
+    case 2:
+      mask = trace_type2[o>>3];
+#ifndef HP45_REG_SWAR
+      // fields past digit 13 spill into the next register
+      if(instance->P > 13)mask |= mask<<1;
+#endif
+      return mask;
+    case 0:
+      if((o & 0x03) == 2){
+        if(((o>>2) & 0x03) == 1)return TR_C;
+        if((o>>2) & 0x02)return trace_type5[o>>4];
+      }else if(o == 0xBC && instance->DataAddr < 10){ // c -> data
+        return 1u << (7 + instance->DataAddr);
+      }
+      return 0;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Difference of two registers in trace format.
+  * @param  a: register
+  * @param  b: register
+  * @retval uint64_t: a ^ b, digit i in bits 4i..4i+3
+  */
+static inline uint64_t trace_xor(const reg_t *a, const reg_t *b)
+{
+#ifdef HP45_REG_SWAR
+  return a->w ^ b->w;
+#else
+  uint64_t x = 0;
+  int i;
+
+  for(i = 13; i >= 0; i--){
+    x = (x << 4) | ((HP45_DIGIT(a, i) ^ HP45_DIGIT(b, i)) & 0x0F);
+  }
+  return x;
+#endif
+}
+
+/**
+  * @brief  Execute 1 instruction with step() and append its trace record.
+  * @param  instance: HP-45 memory object
+  * @param  done: cycles run by run_events so far, not yet added to instance->cycles
+  * @retval int: result of step()
+  */
+static int trace_step(hp45inst_t *instance, uint32_t done)
+{
+  hp45trace_t *const t = instance->trace;
+  const uint16_t pc = instance->PC;
+  const uint16_t opcode = ROM[pc];
+  const uint64_t cycle = (instance->cycles + done) & 0x7FFF;
+  uint32_t targets, mask;
+  reg_t before[7];
+  const reg_t *reg[7];
+  uint8_t index[7];
+  uint64_t x, h;
+  int i, n = 0, d = 0, result;
+
+  if(!t)
+    return step(instance);
+  mask = t->size - 1;
+  h = t->head;
+  for(targets = trace_targets(instance, opcode), i = 0; targets; targets >>= 1, i++){
+    if(targets & 1){
+      index[n] = i;
+      reg[n] = i < 7 ? &(&instance->A)[i] : &instance->RAM[i - 7];
+      before[n] = *reg[n];
+      n++;
+    }
+  }
+  result = step(instance);
+  // unchanged registers are written too, then overwritten by the next word
+  for(i = 0; i < n; i++){
+    x = trace_xor(&before[i], reg[i]);
+    t->buf[(h + 1 + d) & mask] = 0x8000000000000000ull | ((uint64_t)index[i] << 56) | x;
+    d += x != 0;
+  }
+  t->buf[h & mask] = pc | ((uint64_t)opcode << 11) | ((uint64_t)(instance->CY & 1) << 21)
+                   | ((uint64_t)(instance->P & 0x0F) << 22) | ((uint64_t)(instance->S & 0xFFF) << 26)
+                   | ((uint64_t)(instance->DataAddr & 0x0F) << 38) | ((uint64_t)(instance->DispOn & 1) << 42)
+                   | ((uint64_t)(instance->keydown & 1) << 43) | ((uint64_t)d << 44) | (cycle << 48);
+  t->head = h + 1 + d;
+  return result;
+}
+
+/**
+  * @brief  Append a sync record before cycles are skipped without running
+            them, unless the newest record already is one.
+  * @param  instance: HP-45 memory object, before the skip
+  * @retval None
+  */
+static void trace_sync(hp45inst_t *instance)
+{
+  hp45trace_t *const t = instance->trace;
+
+  if(!t)
+    return;
+  if(t->head > t->start && HP45_TRACE_IS_SYNC(t->buf[(t->head - 1) & (t->size - 1)])
+     && !HP45_TRACE_IS_DELTA(t->buf[(t->head - 1) & (t->size - 1)]))
+    return;
+  t->buf[t->head & (t->size - 1)] = HP45_TRACE_SYNC(instance->cycles);
+  t->head++;
+}
+#define STEP(instance, done) trace_step(instance, done)
+#else
+#define STEP(instance, done) step(instance)
+#endif /* HP45_TRACE */
+
+#endif /* !HP45_PREDECODE */
+
+#ifdef HP45_RECOMPILED
+/* Recompiled ROM ------------------------------------------------------------*/
+/* Block functions blocks[] and their lengths block_len[], generated by hp45recomp */
+#include "hp45blocks.c"
+#endif /* HP45_RECOMPILED */
+
+#ifndef HP45_NO_BOOT_IMAGE
+#include "hp45boot.c"
+#endif
+
+#ifdef HP45_PREDECODE
+/* Predecoded dispatch -------------------------------------------------------*/
+/* Every handler is listed once here; the list expands into the handler index
+ * enum, the function-pointer table and the computed-goto label table.
+ * Type 2 handlers come in 8 variants, one per word-select field, in ws order.
+ */
+#define FIELD_HANDLERS(X, name) \
+  X(name##_p) X(name##_m) X(name##_x) X(name##_w) X(name##_wp) X(name##_ms) X(name##_xs) X(name##_s)
+#define HANDLER_LIST(X) \
+  X(nop) X(jsb) X(branch) X(undef) \
+  FIELD_HANDLERS(X, clr) FIELD_HANDLERS(X, mov) FIELD_HANDLERS(X, exch) \
+  FIELD_HANDLERS(X, add) FIELD_HANDLERS(X, sub) FIELD_HANDLERS(X, neg) \
+  FIELD_HANDLERS(X, negm1) FIELD_HANDLERS(X, inc) FIELD_HANDLERS(X, dec) \
+  FIELD_HANDLERS(X, ifz) FIELD_HANDLERS(X, ifge) FIELD_HANDLERS(X, ifge1) \
+  FIELD_HANDLERS(X, shr) FIELD_HANDLERS(X, shl) \
+  X(setf) X(tstf) X(clrf) X(clrs) \
+  X(setp) X(tstp) X(decp) X(incp) \
+  X(ldc) X(disptgl) X(cxm) X(stup) X(stdn) X(dispoff) X(rclm) X(rddata) X(rotdn) X(clrregs) \
+  X(romsel) X(ret) X(keyjmp) X(setaddr) X(wrdata)
+
+/* Superinstructions: sequences of handlers run as one, without dispatch in
+ * between. Picked from HP45_PROFILE counts of the key press workload: a test
+ * and its conditional branch, the pointer and counter loops of the mantissa
+ * routines and constant loading. Every handler but the last must leave PC
+ * alone. Fused only with computed goto, unless HP45_NO_FUSION.
+ */
+#define FUSED2_LIST(X) \
+  X(tstp, branch) X(tstf, branch) X(ifz_p, branch) X(ifge1_p, branch) \
+  X(sub_ms, branch) X(sub_w, branch) X(dec_s, branch) X(dec_p, branch) \
+  X(shl_wp, incp) X(shl_w, incp) X(shr_w, incp) X(add_ms, shl_ms) X(ldc, ldc)
+#define FUSED3_LIST(X) \
+  X(decp, tstp, branch) X(incp, tstp, branch) X(ldc, tstp, branch) X(setf, tstf, branch) \
+  X(inc_p, sub_ms, branch) X(shr_wp, dec_s, branch) X(add_w, dec_p, branch)
+
+#define HANDLER_ENUM(name) H_##name,
+#define FUSED2_ENUM(a, b) H_##a##__##b,
+#define FUSED3_ENUM(a, b, c) H_##a##__##b##__##c,
+enum{
+  HANDLER_LIST(HANDLER_ENUM)
+  H_COUNT,
+  H_FUSED = H_COUNT - 1,  // superinstructions follow the single handlers
+  FUSED2_LIST(FUSED2_ENUM)
+  FUSED3_LIST(FUSED3_ENUM)
+  H_FUSED_END
+};
+
+#if defined(__GNUC__) && !defined(HP45_NO_COMPUTED_GOTO)
+#define HP45_THREADED 1
+#else
+#define HP45_THREADED 0
+#endif
+#if HP45_THREADED && !defined(HP45_NO_FUSION)
+#define HP45_FUSION 1
+#else
+#define HP45_FUSION 0
+#endif
+
+typedef struct hp45op_s hp45op_t;
+struct hp45op_s{
+#if HP45_THREADED
+  const void *handler;  // label address inside execute()
+#else
+  int (*handler)(hp45inst_t*, const hp45op_t*);
+#endif
+  uint8_t ws;           // word-select field of type 2 instructions
+  uint8_t n;            // N/P field, branch target or undefined-opcode result
+  uint8_t r1, r2, r3;   // byte offsets of operand registers in hp45inst_t
+};
+
+#define REG(instance, off) ((reg_t*)((uint8_t*)(instance) + (off)))
+#define RA offsetof(hp45inst_t, A)
+#define RB offsetof(hp45inst_t, B)
+#define RC offsetof(hp45inst_t, CX)
+
+/* opcode>>3 of type 2 instructions -> handler for field p and operand registers */
+static const struct{
+  uint8_t h, r1, r2, r3;
+} type2_table[32] = {
+  [0]  = {H_ifz_p, RB, 0, 0},    // 0-B
+  [1]  = {H_clr_p, RB, 0, 0},    // 0->B
+  [2]  = {H_ifge_p, RA, RC, 0},  // A-C
+  [3]  = {H_ifge1_p, RC, 0, 0},  // C-1
+  [4]  = {H_mov_p, RC, RB, 0},   // B->C
+  [5]  = {H_neg_p, RC, 0, 0},    // 0-C->C
+  [6]  = {H_clr_p, RC, 0, 0},    // 0->C
+  [7]  = {H_negm1_p, RC, 0, 0},  // 0-C-1->C
+  [8]  = {H_shl_p, RA, 0, 0},    // shift A left
+  [9]  = {H_mov_p, RB, RA, 0},   // A->B
+  [10] = {H_sub_p, RA, RC, RC},  // A-C->C
+  [11] = {H_dec_p, RC, 0, 0},    // C-1->C
+  [12] = {H_mov_p, RA, RC, 0},   // C->A
+  [13] = {H_ifz_p, RC, 0, 0},    // 0-C
+  [14] = {H_add_p, RA, RC, RC},  // A+C->C
+  [15] = {H_inc_p, RC, 0, 0},    // C+1->C
+  [16] = {H_ifge_p, RA, RB, 0},  // A-B
+  [17] = {H_exch_p, RB, RC, 0},  // B<->C
+  [18] = {H_shr_p, RC, 0, 0},    // shift C right
+  [19] = {H_ifge1_p, RA, 0, 0},  // A-1
+  [20] = {H_shr_p, RB, 0, 0},    // shift B right
+  [21] = {H_add_p, RC, RC, RC},  // C+C->C
+  [22] = {H_shr_p, RA, 0, 0},    // shift A right
+  [23] = {H_clr_p, RA, 0, 0},    // 0->A
+  [24] = {H_sub_p, RA, RB, RA},  // A-B->A
+  [25] = {H_exch_p, RA, RB, 0},  // A<->B
+  [26] = {H_sub_p, RA, RC, RA},  // A-C->A
+  [27] = {H_dec_p, RA, 0, 0},    // A-1->A
+  [28] = {H_add_p, RA, RB, RA},  // A+B->A
+  [29] = {H_exch_p, RA, RC, 0},  // C<->A
+  [30] = {H_add_p, RA, RC, RA},  // A+C->A
+  [31] = {H_inc_p, RA, 0, 0},    // A+1->A
+};
+
+/* The table is shared by all instances and written once by the first
+ * hp45_init. With C11 atomics concurrent first calls from several threads
+ * are serialized; otherwise initialize one instance before starting threads.
+ */
+static hp45op_t decoded[2048];
+#ifdef HP45_ATOMICS
+static atomic_flag decoding = ATOMIC_FLAG_INIT;
+static atomic_uchar decoded_ready;
+#define DECODE_LOCK()       while(atomic_flag_test_and_set_explicit(&decoding, memory_order_acquire))
+#define DECODE_UNLOCK()     atomic_flag_clear_explicit(&decoding, memory_order_release)
+#define DECODED_READY()     atomic_load_explicit(&decoded_ready, memory_order_acquire)
+#define SET_DECODED_READY() atomic_store_explicit(&decoded_ready, 1, memory_order_release)
+#else
+static uint8_t decoded_ready;
+#define DECODE_LOCK()
+#define DECODE_UNLOCK()
+#define DECODED_READY()     decoded_ready
+#define SET_DECODED_READY() (decoded_ready = 1)
+#endif
+
+/* Handlers. Each one performs the same work as the matching case of the
+ * opcode switch in step(), including clearing of the carry flag, and returns
+ * the same value: negative for undefined opcode, HP45_EVENT_* or 0.
+ */
+static int op_nop(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  return 0;
+}
+
+static int op_jsb(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->LR = instance->PC;
+  instance->PC = (instance->PC & 0xF00) | op->n;
+  instance->CY = 0;
+  return 0;
+}
+
+static int op_branch(hp45inst_t *instance, const hp45op_t *op)
+{
+  if(!instance->CY){
+    instance->PC = (instance->PC & 0xF00) | op->n;
+  }
+  instance->CY = 0;
+  return 0;
+}
+
+static int op_undef(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  return (int8_t)op->n;
+}
+
+ALWAYS_INLINE int clr_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  mov(REG(instance, op->r1), &zero, f);
+  return 0;
+}
+
+ALWAYS_INLINE int mov_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  mov(REG(instance, op->r1), REG(instance, op->r2), f);
+  return 0;
+}
+
+ALWAYS_INLINE int exch_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  exch(REG(instance, op->r1), REG(instance, op->r2), f);
+  return 0;
+}
+
+ALWAYS_INLINE int add_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  add(instance, REG(instance, op->r1), REG(instance, op->r2), REG(instance, op->r3), f);
+  return 0;
+}
+
+ALWAYS_INLINE int sub_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  sub(instance, REG(instance, op->r1), REG(instance, op->r2), REG(instance, op->r3), f);
+  return 0;
+}
+
+ALWAYS_INLINE int neg_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  sub(instance, &zero, REG(instance, op->r1), REG(instance, op->r1), f);
+  return 0;
+}
+
+ALWAYS_INLINE int negm1_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  scratch_t temp;
+
+  instance->CY = 0;
+  instance->ws = op->ws;
+  sub(instance, &zero, REG(instance, op->r1), REG(instance, op->r1), f);
+  set1(&temp.r, f);
+  sub(instance, REG(instance, op->r1), &temp.r, REG(instance, op->r1), f);
+  instance->CY = 1;
+  return 0;
+}
+
+ALWAYS_INLINE int inc_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  scratch_t temp;
+
+  instance->CY = 0;
+  instance->ws = op->ws;
+  set1(&temp.r, f);
+  add(instance, REG(instance, op->r1), &temp.r, REG(instance, op->r1), f);
+  return 0;
+}
+
+ALWAYS_INLINE int dec_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  scratch_t temp;
+
+  instance->CY = 0;
+  instance->ws = op->ws;
+  set1(&temp.r, f);
+  sub(instance, REG(instance, op->r1), &temp.r, REG(instance, op->r1), f);
+  return 0;
+}
+
+ALWAYS_INLINE int ifz_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  ifeq0(instance, REG(instance, op->r1), f);
+  return 0;
+}
+
+ALWAYS_INLINE int ifge_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  ifge(instance, REG(instance, op->r1), REG(instance, op->r2), f);
+  return 0;
+}
+
+ALWAYS_INLINE int ifge1_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  scratch_t temp;
+
+  instance->CY = 0;
+  instance->ws = op->ws;
+  set1(&temp.r, f);
+  ifge(instance, REG(instance, op->r1), &temp.r, f);
+  return 0;
+}
+
+ALWAYS_INLINE int shr_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  shift(REG(instance, op->r1), 0, f);
+  return 0;
+}
+
+ALWAYS_INLINE int shl_f(hp45inst_t *instance, const hp45op_t *op, field_t f)
+{
+  instance->CY = 0;
+  instance->ws = op->ws;
+  shift(REG(instance, op->r1), 1, f);
+  return 0;
+}
+
+/* Word-select variants of the type 2 handlers. Fixed fields are passed as
+ * constants so the kernels are specialized for them; p and wp look P up
+ * in the field table. Inlined also into the superinstructions.
+ */
+#define FIELD_VARIANTS(name) \
+  ALWAYS_INLINE int op_##name##_p(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_P(instance->P)); } \
+  ALWAYS_INLINE int op_##name##_m(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_M); } \
+  ALWAYS_INLINE int op_##name##_x(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_X); } \
+  ALWAYS_INLINE int op_##name##_w(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_W); } \
+  ALWAYS_INLINE int op_##name##_wp(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_WP(instance->P)); } \
+  ALWAYS_INLINE int op_##name##_ms(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_MS); } \
+  ALWAYS_INLINE int op_##name##_xs(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_XS); } \
+  ALWAYS_INLINE int op_##name##_s(hp45inst_t *instance, const hp45op_t *op){ return name##_f(instance, op, FIELD_S); }
+FIELD_VARIANTS(clr)
+FIELD_VARIANTS(mov)
+FIELD_VARIANTS(exch)
+FIELD_VARIANTS(add)
+FIELD_VARIANTS(sub)
+FIELD_VARIANTS(neg)
+FIELD_VARIANTS(negm1)
+FIELD_VARIANTS(inc)
+FIELD_VARIANTS(dec)
+FIELD_VARIANTS(ifz)
+FIELD_VARIANTS(ifge)
+FIELD_VARIANTS(ifge1)
+FIELD_VARIANTS(shr)
+FIELD_VARIANTS(shl)
+
+static int op_setf(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  instance->S |= 1<<op->n;
+  return 0;
+}
+
+static int op_tstf(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = (instance->S >> op->n) & 1;
+  return 0;
+}
+
+static int op_clrf(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  instance->S &= ~(1<<op->n);
+  return 0;
+}
+
+static int op_clrs(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->S = 0;
+  return 0;
+}
+
+static int op_setp(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  instance->P = op->n;
+  return 0;
+}
+
+static int op_tstp(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = (instance->P == op->n);
+  return 0;
+}
+
+static int op_decp(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->P = (instance->P - 1) & 0x0F;
+  return 0;
+}
+
+static int op_incp(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->P = (instance->P + 1) & 0x0F;
+  return 0;
+}
+
+static int op_ldc(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  if(instance->P < 14)
+    HP45_SET_DIGIT(&instance->CX, instance->P, op->n);
+  instance->P = (instance->P - 1) & 0x0F;
+  return 0;
+}
+
+static int op_disptgl(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->DispOn = !instance->DispOn;
+  return HP45_EVENT_DISPLAY;
+}
+
+static int op_cxm(hp45inst_t *instance, const hp45op_t *op)
+{
+  reg_t temp;
+
+  (void)op;
+  instance->CY = 0;
+  memcpy(&temp, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  memcpy(&instance->M, &temp, sizeof(reg_t));
+  return 0;
+}
+
+static int op_stup(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  memcpy(&instance->FT, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->CX, sizeof(reg_t));
+  return 0;
+}
+
+static int op_stdn(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  memcpy(&instance->A, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  return 0;
+}
+
+static int op_dispoff(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  if(instance->DispOn){
+    instance->DispOn = 0;
+    return HP45_EVENT_DISPLAY;
+  }
+  return 0;
+}
+
+static int op_rclm(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  memcpy(&instance->CX, &instance->M, sizeof(reg_t));
+  return 0;
+}
+
+static int op_rddata(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->CX, &instance->RAM[instance->DataAddr], sizeof(reg_t));
+  return 0;
+}
+
+static int op_rotdn(hp45inst_t *instance, const hp45op_t *op)
+{
+  reg_t temp;
+
+  (void)op;
+  instance->CY = 0;
+  memcpy(&temp, &instance->CX, sizeof(reg_t));
+  memcpy(&instance->CX, &instance->DY, sizeof(reg_t));
+  memcpy(&instance->DY, &instance->EZ, sizeof(reg_t));
+  memcpy(&instance->EZ, &instance->FT, sizeof(reg_t));
+  memcpy(&instance->FT, &temp, sizeof(reg_t));
+  return 0;
+}
+
+static int op_clrregs(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  memset(instance, 0, sizeof(reg_t)*7);
+  return 0;
+}
+
+static int op_romsel(hp45inst_t *instance, const hp45op_t *op)
+{
+  instance->CY = 0;
+  instance->PC = (instance->PC & 0x0FF) | ((uint16_t)op->n<<8);
+  return 0;
+}
+
+static int op_ret(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->PC = (instance->PC & 0xF00) | instance->LR;
+  return 0;
+}
+
+static int op_keyjmp(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->PC = (instance->PC & 0xF00) | instance->KeyCode;
+  return HP45_EVENT_KEY;
+}
+
+static int op_setaddr(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  instance->DataAddr = HP45_DIGIT(&instance->CX, 12);
+  return 0;
+}
+
+static int op_wrdata(hp45inst_t *instance, const hp45op_t *op)
+{
+  (void)op;
+  instance->CY = 0;
+  if(instance->DataAddr < 10)
+    memcpy(&instance->RAM[instance->DataAddr], &instance->CX, sizeof(reg_t));
+  return 0;
+}
+
+#if HP45_THREADED
+static const void *const *handler_table;
+#else
+#define HANDLER_FN(name) op_##name,
+static int (*const handler_table[H_COUNT])(hp45inst_t*, const hp45op_t*) = {
+  HANDLER_LIST(HANDLER_FN)
+};
+#endif
+
+/**
+  * @brief  Run predecoded instructions until the cycle budget is used up
+            or an instruction reports one of the requested events.
+            Each cycle does the same PC increment and key flag merge as step(),
+            also inside superinstructions, which stop after any word once the
+            budget is used up.
+  * @param  instance: HP-45 memory object, or NULL to publish the label table
+  * @param  events: HP45_EVENT_* mask of events that stop execution
+  * @param  cycles: in: cycle budget. out: cycles left unexecuted.
+  * @retval int: result of the stopping instruction (negative value for
+                 undefined opcode, or HP45_EVENT_*), 0 if the budget ran out.
+  */
+static int execute(hp45inst_t *instance, uint8_t events, uint32_t *cycles)
+{
+  const hp45op_t *op;
+  uint32_t n;
+  int result;
+
+#if HP45_THREADED
+  #define HANDLER_LABEL(name) &&L_##name,
+  #define FUSED2_LABEL(a, b) &&L_##a##__##b,
+  #define FUSED3_LABEL(a, b, c) &&L_##a##__##b##__##c,
+  static const void *const labels[H_FUSED_END] = {
+    HANDLER_LIST(HANDLER_LABEL)
+#if HP45_FUSION
+    FUSED2_LIST(FUSED2_LABEL)
+    FUSED3_LIST(FUSED3_LABEL)
+#endif
+  };
+  #define DISPATCH() do{ \
+      if(!n){ \
+        result = 0; \
+        goto done; \
+      } \
+      n--; \
+      op = &decoded[instance->PC]; \
+      instance->PC = (instance->PC & 0xF00) | ((instance->PC+1) & 0xFF); \
+      instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown; \
+      goto *op->handler; \
+    }while(0)
+  // next word of a superinstruction: the per-cycle work of DISPATCH() without the table lookup
+  #define NEXT_WORD() do{ \
+      if(!n){ \
+        result = 0; \
+        goto done; \
+      } \
+      n--; \
+      op++; \
+      instance->PC = (instance->PC & 0xF00) | ((instance->PC+1) & 0xFF); \
+      instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown; \
+    }while(0)
+  #define RUN(name) \
+      if((result = op_##name(instance, op)) != 0 && (EVENT_OF(result) & events))goto done;
+  #define HANDLER_BODY(name) \
+    L_##name: \
+      RUN(name) \
+      DISPATCH();
+  #define FUSED2_BODY(a, b) \
+    L_##a##__##b: \
+      RUN(a) NEXT_WORD(); \
+      RUN(b) \
+      DISPATCH();
+  #define FUSED3_BODY(a, b, c) \
+    L_##a##__##b##__##c: \
+      RUN(a) NEXT_WORD(); \
+      RUN(b) NEXT_WORD(); \
+      RUN(c) \
+      DISPATCH();
+
+  if(instance == NULL){
+    handler_table = labels;
+    return 0;
+  }
+  n = *cycles;
+  DISPATCH();
+  HANDLER_LIST(HANDLER_BODY)
+#if HP45_FUSION
+  FUSED2_LIST(FUSED2_BODY)
+  FUSED3_LIST(FUSED3_BODY)
+#endif
+done:
+  #undef DISPATCH
+  #undef NEXT_WORD
+  #undef RUN
+  #undef HANDLER_BODY
+  #undef FUSED2_BODY
+  #undef FUSED3_BODY
+#else
+  n = *cycles;
+  result = 0;
+  while(n){
+    n--;
+    op = &decoded[instance->PC];
+    instance->PC = (instance->PC & 0xF00) | ((instance->PC+1) & 0xFF);
+    instance->S = (instance->S & 0xFFFE) | (uint16_t)instance->keydown;
+    if((result = op->handler(instance, op)) != 0 && (EVENT_OF(result) & events))break;
+    result = 0;
+  }
+#endif
+  instance->cycles += *cycles - n;
+  *cycles = n;
+  return result;
+}
+
+/**
+  * @brief  Decode one ROM word into handler and operands.
+            Mirrors the decoding of hp45_run and opcode* functions.
+  * @param  op: predecoded instruction to fill
+  * @param  opcode: 10-bit ROM word
+  * @retval uint8_t: handler index, H_*
+  */
+static uint8_t decode(hp45op_t *op, uint16_t opcode)
+{
+  const uint8_t o = opcode>>2;
+  const uint8_t N = o>>4;
+  uint8_t h = H_undef;
+
+  op->ws = op->n = op->r1 = op->r2 = op->r3 = 0;
+  switch(opcode & 0x003){
+    case 0:
+      switch(o & 0x03){
+        case 0: // type 6-10
+          if(o & 0x04){
+            switch((o>>3) & 0x03){
+              case 0: h = H_romsel; op->n = o>>5; break;
+              case 1: h = H_ret; break;
+              case 2:
+                if((o>>5) & 1){
+                  h = H_keyjmp;
+                }else{
+                  op->n = (uint8_t)-1;
+                }
+                break;
+              case 3:
+                if(((o>>5) & 0x5) == 0x4){
+                  h = H_setaddr;
+                }else if((o>>5) == 0x5){
+                  h = H_wrdata;
+                }else{
+                  op->n = (uint8_t)-2;
+                }
+                break;
+            }
+          }else if(o & 0x08){
+            op->n = (uint8_t)-3;
+          }else if(o & 0x10){
+            op->n = (uint8_t)-4;
+          }else if(o){
+            op->n = (uint8_t)-5;
+          }else{
+            h = H_nop;
+          }
+          break;
+        case 1: // type 3
+          switch((o>>2) & 0x03){
+            case 0: if(N >= 12){op->n = (uint8_t)-2;}else{h = H_setf; op->n = N;} break;
+            case 1: if(N >= 12){op->n = (uint8_t)-4;}else{h = H_tstf; op->n = N;} break;
+            case 2: if(N >= 12){op->n = (uint8_t)-7;}else{h = H_clrf; op->n = N;} break;
+            case 3: if(N){op->n = (uint8_t)-10;}else{h = H_clrs;} break;
+          }
+          break;
+        case 2: // type 5
+          switch((o>>2) & 0x03){
+            case 0: op->n = (uint8_t)-1; break;
+            case 1: if(N >= 10){op->n = (uint8_t)-2;}else{h = H_ldc; op->n = N;} break;
+            default:
+              switch(N){
+                case 0: h = H_disptgl; break;
+                case 2: h = H_cxm; break;
+                case 4: h = H_stup; break;
+                case 6: h = H_stdn; break;
+                case 8: h = H_dispoff; break;
+                case 10: h = H_rclm; break;
+                case 11: h = H_rddata; break;
+                case 12: h = H_rotdn; break;
+                case 14: h = H_clrregs; break;
+                case 1: case 5: case 9: case 13: op->n = (uint8_t)-3; break;
+                default: op->n = (uint8_t)-4; break;
+              }
+          }
+          break;
+        case 3: // type 4
+          switch((o>>2) & 0x03){
+            case 0: h = H_setp; op->n = N; break;
+            case 1: h = H_decp; break;
+            case 2: h = H_tstp; op->n = N; break;
+            case 3: h = H_incp; break;
+          }
+          break;
+      }
+      break;
+    case 1: // type 1: jump subroutine
+      h = H_jsb;
+      op->n = o;
+      break;
+    case 2: // type 2: arithmetic/register
+      h = type2_table[o>>3].h + (o & 7);
+      op->ws = o & 7;
+      op->r1 = type2_table[o>>3].r1;
+      op->r2 = type2_table[o>>3].r2;
+      op->r3 = type2_table[o>>3].r3;
+      break;
+    case 3: // type 1: conditional branch
+      h = H_branch;
+      op->n = o;
+      break;
+  }
+  op->handler = handler_table[h];
+  return h;
+}
+
+#if HP45_FUSION
+/**
+  * @brief  Replace the handler of a word by a superinstruction when it
+            starts one of the sequences of FUSED3_LIST or FUSED2_LIST,
+            longest first. The following words keep their own handlers,
+            which run when a branch enters the sequence after its start.
+  * @param  pc: ROM address
+  * @param  h: handler index of every ROM word
+  * @retval None
+  */
+static void fuse(uint16_t pc, const uint8_t *h)
+{
+  const uint8_t left = 0xFF - (pc & 0xFF);  // words after pc in its ROM page
+
+  #define FUSE3(a, b, c) \
+    if(left >= 2 && h[pc] == H_##a && h[pc+1] == H_##b && h[pc+2] == H_##c){ \
+      decoded[pc].handler = handler_table[H_##a##__##b##__##c]; \
+      return; \
+    }
+  #define FUSE2(a, b) \
+    if(left >= 1 && h[pc] == H_##a && h[pc+1] == H_##b){ \
+      decoded[pc].handler = handler_table[H_##a##__##b]; \
+      return; \
+    }
+  FUSED3_LIST(FUSE3)
+  FUSED2_LIST(FUSE2)
+  #undef FUSE3
+  #undef FUSE2
+}
+#endif
+
+/**
+  * @brief  Build the predecoded ROM table. Only the first call does the work.
+            Safe to call from several threads at once when C11 atomics are available.
+  * @param  None
+  * @retval None
+  */
+static void predecode(void)
+{
+#if HP45_FUSION
+  uint8_t h[2048];  // handler index of every word
+#endif
+  uint16_t pc;
+
+  if(DECODED_READY())
+    return;
+  DECODE_LOCK();
+  if(!DECODED_READY()){
+#if HP45_THREADED
+    execute(NULL, 0, NULL);
+#endif
+#if HP45_FUSION
+    for(pc = 0; pc < 2048; pc++){
+      h[pc] = decode(&decoded[pc], ROM[pc]);
+    }
+    for(pc = 0; pc < 2048; pc++){
+      fuse(pc, h);
+    }
+#else
+    for(pc = 0; pc < 2048; pc++){
+      decode(&decoded[pc], ROM[pc]);
+    }
+#endif
+    SET_DECODED_READY();
+  }
+  DECODE_UNLOCK();
+}
+#endif /* HP45_PREDECODE */
+
+/**
+  * @brief  Run instructions until the cycle budget is used up
+            or an instruction reports one of the requested events.
+  * @param  instance: HP-45 memory object
+  * @param  events: HP45_EVENT_* mask of events that stop execution
+  * @param  cycles: in: cycle budget. out: cycles left unexecuted.
+  * @retval int: result of the stopping instruction, 0 if the budget ran out.
+  */
+static int run_events(hp45inst_t *instance, uint8_t events, uint32_t *cycles)
+{
+#ifdef HP45_PREDECODE
+  return execute(instance, events, cycles);
+#else
+  uint32_t n = *cycles;
+  int result = 0;
+
+  while(n){
+#ifdef HP45_RECOMPILED
+    const uint8_t len = block_len[instance->PC];
+
+    if(len && len <= n){
+      n -= len;
+      result = blocks[instance->PC](instance);
+    }else{
+      result = STEP(instance, *cycles - n);
+      n--;
+    }
+#else
+    result = STEP(instance, *cycles - n);
+    n--;
+#endif
+    if(result != 0 && (EVENT_OF(result) & events))break;
+    result = 0;
+  }
+  instance->cycles += *cycles - n;
+  *cycles = n;
+  return result;
+#endif
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Notice VM that a key is pressed.
+  * @param  instance: HP-45 memory object
+  * @param  keycode: HP-45 native key code.
+            Undefined key code may result in unexpected behavior.
+  * @retval None
+  */
+void key_down(hp45inst_t* instance, uint8_t keycode)
+{
+  instance->KeyCode = keycode;
+  instance->keydown = 1;
+}
+
+/**
+  * @brief  Notice VM that a key is released.
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+void key_up(hp45inst_t* instance)
+{
+  instance->keydown = 0;
+}
+
+/**
+  * @brief  Initialize HP-45 memory to initial state (all-zero).
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+void hp45_init(hp45inst_t *instance)
+{  
+  memset(instance, 0, sizeof(hp45inst_t));
+#ifdef HP45_PREDECODE
+  predecode();
+#endif
+}
+
+/**
+  * @brief  Initialize HP-45 memory to the state the firmware reaches after
+            power-on, when it first waits for a key. Same as hp45_init
+            followed by running until hp45_idle_period is nonzero, but a
+            single copy of the image generated by hp45bootgen.
+  * @param  instance: HP-45 memory object
+  * @retval None
+  */
+void hp45_init_ready(hp45inst_t *instance)
+{
+#ifdef HP45_NO_BOOT_IMAGE
+  uint32_t cycles;
+
+  hp45_init(instance);
+  while(!hp45_idle_period(instance)){
+    cycles = 1;
+    run_events(instance, HP45_EVENT_NONE, &cycles);
+  }
+#else
+  *instance = BootImage;
+#ifdef HP45_PREDECODE
+  predecode();
+#endif
+#endif
+}
+
+/**
+  * @brief  Perform simulation for 1 word-cycle (i.e. run 1 step)
+            To simulate the speed of a real HP-45 machine,
+            call this function every 286us (35 cycles per 10ms).
+  * @param  instance: HP-45 memory object
+  * @retval int: negative value for undefined opcode.
+  */
+int hp45_run(hp45inst_t *instance)
+{
+#ifdef HP45_PREDECODE
+  uint32_t cycles = 1;
+  const int result = execute(instance, HP45_EVENT_UNDEF, &cycles);
+#else
+  // one instruction needs none of the budget and event bookkeeping of
+  // run_events; a one-word recompiled block does the same as step()
+  const int result = STEP(instance, 0);
+
+  instance->cycles++;
+#endif
+  DISPLAY_CHECK(instance);
+  return result < 0 ? result : 0;
+}
+
+/**
+  * @brief  Perform simulation for up to the given number of word-cycles.
+            Stops early after an instruction that toggles the display,
+            reads the key code or is undefined.
+  * @param  instance: HP-45 memory object
+  * @param  cycles: maximum number of word-cycles to run
+  * @param  stop_reason: pointer to store HP45_EVENT_* that stopped the run,
+            HP45_EVENT_NONE if the budget ran out. May be NULL.
+  * @retval uint32_t: number of word-cycles executed.
+  */
+uint32_t hp45_run_cycles(hp45inst_t *instance, uint32_t cycles, uint8_t *stop_reason)
+{
+  uint32_t left = cycles;
+  const int result = run_events(instance, HP45_EVENT_ALL, &left);
+
+  DISPLAY_CHECK(instance);
+  if(stop_reason)
+    *stop_reason = EVENT_OF(result);
+  return cycles - left;
+}
+
+/**
+  * @brief  Perform simulation until one of the selected events happens.
+            Events not in the mask are ignored.
+            Use instance->cycles to find out how many cycles were executed.
+  * @param  instance: HP-45 memory object
+  * @param  events: HP45_EVENT_* mask
+  * @param  max_cycles: maximum number of word-cycles to run
+  * @retval uint8_t: HP45_EVENT_* that stopped the run,
+                     HP45_EVENT_NONE if max_cycles ran out.
+  */
+uint8_t hp45_run_until(hp45inst_t *instance, uint8_t events, uint32_t max_cycles)
+{
+  const int result = run_events(instance, events, &max_cycles);
+
+  DISPLAY_CHECK(instance);
+  return EVENT_OF(result);
+}
+
+/**
+  * @brief  Check whether the firmware is idle, i.e. waiting for a key in a
+            polling loop that comes back to exactly the same state.
+            While no key is pressed, running any number of whole periods
+            leaves the instance unchanged except for the cycle counter,
+            so a host may sleep until the next key_down.
+  * @param  instance: HP-45 memory object
+  * @retval uint8_t: length of the loop in word-cycles, 0 if not idle.
+  */
+uint8_t hp45_idle_period(const hp45inst_t *instance)
+{
+  hp45inst_t probe;
+  uint32_t cycles;
+  uint8_t period, polled = 0;
+  int i;
+
+  if(instance->keydown)
+    return 0;
+  // cheap filter: a key poll must be close by within the ROM page
+  for(i = -IDLE_PERIOD_MAX; i <= IDLE_PERIOD_MAX; i++){
+    if(ROM[(instance->PC & 0xF00) | ((instance->PC + i) & 0xFF)] == OPCODE_TEST_KEY)
+      break;
+  }
+  if(i > IDLE_PERIOD_MAX)
+    return 0;
+  memcpy(&probe, instance, sizeof(hp45inst_t));
+#ifdef HP45_PROFILE
+  probe.profile = NULL; // probing is not execution
+#endif
+#ifdef HP45_TRACE
+  probe.trace = NULL;
+#endif
+  for(period = 1; period <= IDLE_PERIOD_MAX; period++){
+    polled |= (ROM[probe.PC] == OPCODE_TEST_KEY);
+    cycles = 1;
+    if(run_events(&probe, HP45_EVENT_ALL, &cycles) != 0)
+      return 0;
+    if(!memcmp(&probe, instance, offsetof(hp45inst_t, cycles)))
+      return polled ? period : 0;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Fast-forward an idle instance in constant time.
+            Skips as many whole idle loop periods as fit in the budget and
+            adds them to the cycle counter; the state is the same as if they
+            had been executed. Run the remaining cycles with hp45_run_cycles.
+            Example for a 10ms tick:
+              skipped = hp45_fast_forward(instance, 35);
+              hp45_run_cycles(instance, 35 - skipped, NULL);
+  * @param  instance: HP-45 memory object
+  * @param  cycles: maximum number of word-cycles to skip
+  * @retval uint32_t: number of word-cycles skipped, 0 if not idle.
+  */
+uint32_t hp45_fast_forward(hp45inst_t *instance, uint32_t cycles)
+{
+  const uint8_t period = hp45_idle_period(instance);
+
+  if(!period)
+    return 0;
+  cycles -= cycles % period;
+#ifdef HP45_TRACE
+  if(cycles)trace_sync(instance);
+#endif
+  instance->cycles += cycles;
+  return cycles;
+}
+
+/**
+  * @brief  Fingerprint of the ROM image compiled in (FNV-1a over all words).
+            Results recorded with one ROM are only valid for that ROM; hosts
+            that keep them, like hp45cache, tag them with this value.
+  * @param  None
+  * @retval uint32_t: fingerprint
+  */
+uint32_t hp45_rom_fingerprint(void)
+{
+  uint32_t hash = 2166136261u;
+  int i;
+
+  for(i = 0; i < 2048; i++){
+    hash = (hash ^ (ROM[i] & 0xFF)) * 16777619u;
+    hash = (hash ^ (ROM[i] >> 8)) * 16777619u;
+  }
+  return hash;
+}
+
+#ifdef HP45_DISPLAY_TRACKING
+/**
+  * @brief  Check whether what the display shows changed since the last check:
+            turned on or off, or A or B changed while it is on. If so, advance
+            instance->display_gen and call instance->display_fn.
+            hp45_run, hp45_run_cycles and hp45_run_until check after running;
+            call it after changing registers directly.
+  * @param  instance: HP-45 memory object
+  * @retval int: 1 if the display changed, 0 if not.
+  */
+int hp45_display_changed(hp45inst_t *instance)
+{
+  if(instance->DispOn == instance->shown_on && (!instance->DispOn ||
+     (!memcmp(&instance->A, &instance->shown_A, sizeof(reg_t)) && !memcmp(&instance->B, &instance->shown_B, sizeof(reg_t)))))
+    return 0;
+  instance->shown_on = instance->DispOn;
+  if(instance->DispOn){
+    instance->shown_A = instance->A;
+    instance->shown_B = instance->B;
+  }
+  if(++instance->display_gen == 0)
+    instance->display_gen = 1;
+  if(instance->display_fn)
+    instance->display_fn(instance->display_arg);
+  return 1;
+}
+#endif
@@ -1,3 +1,98 @@
+#ifndef __HP45SIM_H
+#define __HP45SIM_H
+
+#include <stdint.h>
+
+/* Configuration -------------------------------------------------------------*/
+/* HP45_PREDECODE: decode the whole ROM once in hp45_init into a table of
+ * handler pointers and pre-extracted operands (about 32KB of RAM), and execute
+ * it with a threaded loop instead of the nested opcode switch.
+ * Computed goto is used on GCC/Clang; define HP45_NO_COMPUTED_GOTO to force the
+ * portable function-pointer table instead.
+ * With computed goto, common sequences of two or three words are also fused
+ * into superinstructions, with the same cycle counts and events; define
+ * HP45_NO_FUSION to dispatch every word on its own.
+ */
+//#define HP45_PREDECODE
+
+/* HP45_RECOMPILED: execute the ROM as native C functions, one per basic
+ * block, generated ahead of time by hp45recomp into hp45blocks.c.
+ * Addresses where no block starts, and budgets shorter than a block, fall
+ * back to the opcode switch, so cycle counts and events stay exact.
+ * Cannot be combined with HP45_PREDECODE.
+ */
+//#define HP45_RECOMPILED
+
+/* HP45_REG_SWAR: pack each register into one uint64_t, 4 bits per digit,
+ * and do field moves, BCD add/subtract, compares and shifts with
+ * word-wide mask arithmetic instead of digit loops. Halves the register
+ * footprint; meant for 64-bit hosts.
+ */
+//#define HP45_REG_SWAR
+
+/* HP45_REG_PACKED: store two digits per byte, 7 bytes per register instead
+ * of 14, for microcontrollers short of RAM. Digits are read and written
+ * with HP45_DIGIT/HP45_SET_DIGIT, which cost a shift and mask each, so it is
+ * slower than the default layout. Cannot be combined with HP45_REG_SWAR.
+ */
+//#define HP45_REG_PACKED
+
+/* HP45_PROFILE: count executed instructions per ROM address in the
+ * hp45profile_t attached to an instance (instance->profile, set it after
+ * hp45_init; NULL counts nothing). hp45prof.c derives the counts per
+ * instruction type, operation and word select, and prints reports.
+ * Needs the opcode switch engine: cannot be combined with HP45_PREDECODE
+ * or HP45_RECOMPILED.
+ */
+//#define HP45_PROFILE
+
+/* HP45_TRACE: record every executed instruction in the hp45trace_t ring
+ * attached to an instance (instance->trace, set up with hp45trace_init and
+ * attached after hp45_init; NULL records nothing): address, opcode, carry,
+ * pointer, status and the change of every register it wrote. hp45trace.c
+ * saves traces to files and hp45tracedump prints and compares them. Needs
+ * the opcode switch engine, like HP45_PROFILE. An attached trace roughly
+ * doubles the time per instruction (about 10ns more per word-cycle on an
+ * x86-64 host, against 10-13ns untraced); with trace NULL the cost is one
+ * test per instruction.
+ */
+//#define HP45_TRACE
+
+/* HP45_NO_BOOT_IMAGE: leave out the generated boot image (hp45boot.c);
+ * hp45_init_ready then runs the power-on path instead of copying it.
+ * hp45bootgen is built this way to generate hp45boot.c.
+ */
+//#define HP45_NO_BOOT_IMAGE
+
+/* HP45_DISPLAY_TRACKING: track display changes (display_gen, display_fn
+ * and hp45_display_changed). Adds 56 bytes per instance (hp45inst_t grows
+ * from 256 to 312 bytes on x86-64) and a compare of A and B after every run
+ * call, which makes hp45_run about 25% slower.
+ */
+//#define HP45_DISPLAY_TRACKING
+
+/* Events reported by hp45_run_cycles and hp45_run_until ---------------------*/
+#define HP45_EVENT_NONE     0x00  // cycle budget ran out
+#define HP45_EVENT_DISPLAY  0x01  // display turned on or off (DispOn changed)
+#define HP45_EVENT_KEY      0x02  // keyboard entry: firmware jumped to KeyCode
+#define HP45_EVENT_UNDEF    0x04  // undefined opcode executed
+#define HP45_EVENT_ALL      0x07
+
+#ifdef HP45_REG_SWAR
+typedef struct{
+  uint64_t w;      // digit i in bits 4i..4i+3: exponent 0-1, exponent sign 2, mantissa 3-12, sign 13
+} reg_t;
+
+#define HP45_DIGIT(r, i)        ((uint8_t)(((r)->w >> ((i)*4)) & 0x0F))
+#define HP45_SET_DIGIT(r, i, v) ((r)->w = ((r)->w & ~((uint64_t)0x0F << ((i)*4))) | ((uint64_t)(v) << ((i)*4)))
+#elif defined(HP45_REG_PACKED)
+typedef struct{
+  uint8_t b[7];    // digit 2i in the low nibble of b[i], digit 2i+1 in the high nibble
+} reg_t;
+
+#define HP45_DIGIT(r, i)        ((uint8_t)(((r)->b[(i)>>1] >> (((i) & 1)*4)) & 0x0F))
+#define HP45_SET_DIGIT(r, i, v) ((r)->b[(i)>>1] = (uint8_t)(((r)->b[(i)>>1] & (0xF0 >> (((i) & 1)*4))) | (((v) & 0x0F) << (((i) & 1)*4))))
+#else
 typedef union{
   struct{
     uint8_t X[2];  // 2 digit exponent
@@ -8,6 +103,55 @@ typedef union{
   uint8_t nibble[14], padding[2];
 } reg_t;
 
+#define HP45_DIGIT(r, i)        ((r)->nibble[i])
+#define HP45_SET_DIGIT(r, i, v) ((r)->nibble[i] = (v))
+#endif
+
+#ifdef HP45_PROFILE
+typedef struct{
+  uint64_t pc[2048];  // executions per ROM address
+} hp45profile_t;
+#endif
+
+#ifdef HP45_TRACE
+/* Ring of trace records, 64-bit words. A record is a header word followed
+ * by HP45_TRACE_NDELTA delta words; the oldest records are overwritten.
+ */
+typedef struct{
+  uint64_t *buf;    // size words
+  uint64_t head;    // index of the next word to write (free running)
+  uint64_t start;   // index of the first record kept by hp45trace_clear
+  uint32_t size;    // power of 2, at least 2*HP45_TRACE_AHEAD
+} hp45trace_t;
+
+/* Header word: state after the instruction */
+#define HP45_TRACE_PC(w)        ((uint16_t)((w) & 0x7FF))           // address of the instruction
+#define HP45_TRACE_OPCODE(w)    ((uint16_t)(((w) >> 11) & 0x3FF))
+#define HP45_TRACE_CY(w)        ((uint8_t)(((w) >> 21) & 1))
+#define HP45_TRACE_P(w)         ((uint8_t)(((w) >> 22) & 0x0F))
+#define HP45_TRACE_S(w)         ((uint16_t)(((w) >> 26) & 0xFFF))
+#define HP45_TRACE_DATAADDR(w)  ((uint8_t)(((w) >> 38) & 0x0F))
+#define HP45_TRACE_DISPON(w)    ((uint8_t)(((w) >> 42) & 1))
+#define HP45_TRACE_KEYDOWN(w)   ((uint8_t)(((w) >> 43) & 1))
+#define HP45_TRACE_NDELTA(w)    ((uint8_t)(((w) >> 44) & 0x07))     // number of delta words
+#define HP45_TRACE_CYCLE(w)     ((uint16_t)(((w) >> 48) & 0x7FFF))  // low bits of the cycle counter before it
+/* Sync record: a header word with no delta words, written by
+ * hp45_fast_forward before it skips cycles, so the full cycle count can be
+ * rebuilt across gaps longer than HP45_TRACE_CYCLE can span
+ */
+#define HP45_TRACE_IS_SYNC(w)   ((uint8_t)(((w) >> 47) & 1))
+#define HP45_TRACE_SYNC(cycles) (0x0000800000000000ull | (uint32_t)(cycles))
+#define HP45_TRACE_SYNC_AT(w)   ((uint32_t)(w))                     // cycle counter before the skip
+/* Delta word: register changed by the instruction */
+#define HP45_TRACE_IS_DELTA(w)  ((uint8_t)((w) >> 63))
+#define HP45_TRACE_REG(d)       ((uint8_t)(((d) >> 56) & 0x7F))     // 0-6: A, B, C, D, E, F, M; 7-16: RAM 0-9
+#define HP45_TRACE_XOR(d)       ((d) & 0x00FFFFFFFFFFFFFFull)       // old ^ new, digit i in bits 4i..4i+3
+/* Recording scribbles on up to this many words from head on, so the oldest
+ * words of a full ring are not valid
+ */
+#define HP45_TRACE_AHEAD        8
+#endif
+
 typedef struct{
   reg_t A, B;       // General purpose registers for math and scratchpad use
   reg_t CX;         // Like A and B but also dedicated to memory reads and writes andtransfers to M
@@ -26,9 +170,37 @@ typedef struct{
   uint8_t CY;       // carry flag
   uint8_t keydown;  // Store key state that keyboard scanning circuit generated
   uint8_t DispOn;   // LED display ON/OFF control bit
+  uint32_t cycles;  // word-cycles executed since hp45_init (wraps around). not an actual part in HP-45.
+#ifdef HP45_PROFILE
+  hp45profile_t *profile; // execution counters, see HP45_PROFILE. not an actual part in HP-45.
+#endif
+#ifdef HP45_TRACE
+  hp45trace_t *trace;     // execution trace, see HP45_TRACE. not an actual part in HP-45.
+#endif
+#ifdef HP45_DISPLAY_TRACKING
+  /* Display change tracking, see hp45_display_changed. Set display_fn
+   * after hp45_init, hp45_init_ready, hp45_restore or hp45_fork. not an actual part in HP-45.
+   */
+  uint32_t display_gen;       // changes whenever what the display shows changes; never 0 once it has
+  void (*display_fn)(void*);  // called with display_arg when the display changed, may be NULL
+  void *display_arg;
+  reg_t shown_A, shown_B;     // A and B when the display was last seen on
+  uint8_t shown_on;           // DispOn when last checked
+#endif
 } hp45inst_t;
 
 void key_down(hp45inst_t*, uint8_t);
 void key_up(hp45inst_t*);
 void hp45_init(hp45inst_t*);
+void hp45_init_ready(hp45inst_t*);
 int hp45_run(hp45inst_t*);
+uint32_t hp45_run_cycles(hp45inst_t*, uint32_t, uint8_t*);
+uint8_t hp45_run_until(hp45inst_t*, uint8_t, uint32_t);
+uint8_t hp45_idle_period(const hp45inst_t*);
+uint32_t hp45_fast_forward(hp45inst_t*, uint32_t);
+uint32_t hp45_rom_fingerprint(void);
+#ifdef HP45_DISPLAY_TRACKING
+int hp45_display_changed(hp45inst_t*);
+#endif
+
+#endif /* __HP45SIM_H */
@@ -0,0 +1,207 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Snapshots: save a calculator to a compact, versioned byte string and back,
+ * and fork one calculator into many.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  uint8_t *buf;
+  uint32_t acc;   // bits not yet written
+  uint8_t n;      // number of bits in acc
+} bitwriter_t;
+
+typedef struct{
+  const uint8_t *buf;
+  uint32_t acc;   // bits not yet consumed
+  uint8_t n;      // number of bits in acc
+} bitreader_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define REG_COUNT     17  // A, B, C, D, E, F, M and RAM[10]
+#define REG_BYTES     7   // 14 digits, two per byte
+#define HEADER_SIZE   4
+
+/* register i of the snapshot order: A-M, then RAM[0-9] */
+#define REG_AT(inst, i) ((i) < 7 ? &(&(inst)->A)[i] : &(inst)->RAM[(i) - 7])
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t Magic[3] = {'H', '4', '5'};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Append the low bits of a value to the bit stream.
+  * @param  w: bit writer
+  * @param  value: value
+  * @param  bits: number of bits, at most 24
+  * @retval None
+  */
+static void put_bits(bitwriter_t *w, uint32_t value, uint8_t bits)
+{
+  w->acc |= (value & ((1u << bits) - 1)) << w->n;
+  w->n += bits;
+  while(w->n >= 8){
+    *w->buf++ = (uint8_t)w->acc;
+    w->acc >>= 8;
+    w->n -= 8;
+  }
+}
+
+/**
+  * @brief  Take bits from the bit stream.
+  * @param  r: bit reader
+  * @param  bits: number of bits, at most 24
+  * @retval uint32_t: value
+  */
+static uint32_t get_bits(bitreader_t *r, uint8_t bits)
+{
+  uint32_t value;
+
+  while(r->n < bits){
+    r->acc |= (uint32_t)*r->buf++ << r->n;
+    r->n += 8;
+  }
+  value = r->acc & ((1u << bits) - 1);
+  r->acc >>= bits;
+  r->n -= bits;
+  return value;
+}
+
+/* Public functions  ---------------------------------------------------------*/
+/**
+  * @brief  Encode the state of a calculator, see hp45snap.h for the format.
+  * @param  instance: HP-45 memory object
+  * @param  buf: output, at least HP45_SNAPSHOT_SIZE bytes
+  * @retval size_t: HP45_SNAPSHOT_SIZE
+  */
+size_t hp45_snapshot(const hp45inst_t *instance, uint8_t *buf)
+{
+  bitwriter_t w = {0};
+  const reg_t *r;
+  int i, d;
+
+  memcpy(buf, Magic, sizeof(Magic));
+  buf[3] = HP45_SNAPSHOT_VERSION;
+  buf += HEADER_SIZE;
+  for(i = 0; i < REG_COUNT; i++){
+    r = REG_AT(instance, i);
+    for(d = 0; d < 2*REG_BYTES; d += 2){
+      *buf++ = (HP45_DIGIT(r, d) & 0x0F) | (HP45_DIGIT(r, d + 1) << 4);
+    }
+  }
+  w.buf = buf;
+  put_bits(&w, instance->PC, 11);
+  put_bits(&w, instance->S, 12);
+  put_bits(&w, instance->LR, 8);
+  put_bits(&w, instance->KeyCode, 8);
+  put_bits(&w, instance->P, 4);
+  put_bits(&w, instance->DataAddr, 4);
+  put_bits(&w, instance->ws, 3);
+  put_bits(&w, instance->CY, 1);
+  put_bits(&w, instance->keydown, 1);
+  put_bits(&w, instance->DispOn, 1);
+  put_bits(&w, instance->cycles & 0xFFFF, 16);
+  put_bits(&w, instance->cycles >> 16, 16);
+  put_bits(&w, 0, (8 - w.n) & 7); // flush the last partial byte
+
+  return HP45_SNAPSHOT_SIZE;
+}
+
+/**
+  * @brief  Decode a snapshot into a calculator.
+  * @param  instance: HP-45 memory object, left unchanged on error
+  * @param  buf: snapshot
+  * @param  len: length of buf
+  * @retval int: 0 on success, -1 if buf is short or not a snapshot of this version.
+  */
+int hp45_restore(hp45inst_t *instance, const uint8_t *buf, size_t len)
+{
+  hp45inst_t state;
+  bitreader_t r = {0};
+  reg_t *reg;
+  int i, d;
+
+  if(len < HP45_SNAPSHOT_SIZE || memcmp(buf, Magic, sizeof(Magic)) || buf[3] != HP45_SNAPSHOT_VERSION)
+    return -1;
+  memset(&state, 0, sizeof(hp45inst_t));
+  buf += HEADER_SIZE;
+  for(i = 0; i < REG_COUNT; i++){
+    reg = REG_AT(&state, i);
+    for(d = 0; d < 2*REG_BYTES; d += 2){
+      HP45_SET_DIGIT(reg, d, *buf & 0x0F);
+      HP45_SET_DIGIT(reg, d + 1, *buf >> 4);
+      buf++;
+    }
+  }
+  r.buf = buf;
+  state.PC = get_bits(&r, 11);
+  state.S = get_bits(&r, 12);
+  state.LR = get_bits(&r, 8);
+  state.KeyCode = get_bits(&r, 8);
+  state.P = get_bits(&r, 4);
+  state.DataAddr = get_bits(&r, 4);
+  state.ws = get_bits(&r, 3);
+  state.CY = get_bits(&r, 1);
+  state.keydown = get_bits(&r, 1);
+  state.DispOn = get_bits(&r, 1);
+  state.cycles = get_bits(&r, 16);
+  state.cycles |= get_bits(&r, 16) << 16;
+  *instance = state;
+
+  return 0;
+}
+
+/**
+  * @brief  Branch one calculator into many identical continuations, e.g. to
+            try different keys after a common key sequence without replaying it.
+            The only shared state a calculator may hold is its profile, trace
+            and display callback: children start without profile, trace,
+            display_fn and display_arg, as after hp45_restore, so set them on
+            each child as needed. Each child is then an independent copy that
+            may run on any thread.
+  * @param  parent: HP-45 memory object to copy
+  * @param  children: array of n HP-45 memory objects
+  * @param  n: number of children
+  * @retval None
+  */
+void hp45_fork(const hp45inst_t *parent, hp45inst_t *children, unsigned n)
+{
+  unsigned i;
+
+  for(i = 0; i < n; i++){
+    children[i] = *parent;
+#ifdef HP45_PROFILE
+    children[i].profile = NULL;
+#endif
+#ifdef HP45_TRACE
+    children[i].trace = NULL;
+#endif
+#ifdef HP45_DISPLAY_TRACKING
+    children[i].display_fn = NULL;
+    children[i].display_arg = NULL;
+#endif
+  }
+}
@@ -0,0 +1,24 @@
+#ifndef __HP45SNAP_H
+#define __HP45SNAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "hp45sim.h"
+
+/* Snapshot encoding ---------------------------------------------------------*/
+/* "H45", version, then 17 registers (A, B, C, D, E, F, M, RAM 0-9) as 7 bytes
+ * of packed digits each (digit 2i in the low nibble of byte i), then the
+ * scalar state as a little-endian bit stream:
+ * PC 11, S 12, LR 8, KeyCode 8, P 4, DataAddr 4, ws 3, CY 1, keydown 1,
+ * DispOn 1, cycles 32 bits, padded to whole bytes.
+ * The encoding is the same for the nibble, HP45_REG_SWAR and HP45_REG_PACKED
+ * layouts.
+ */
+#define HP45_SNAPSHOT_VERSION 1
+#define HP45_SNAPSHOT_SIZE    134
+
+size_t hp45_snapshot(const hp45inst_t*, uint8_t*);
+int hp45_restore(hp45inst_t*, const uint8_t*, size_t);
+void hp45_fork(const hp45inst_t*, hp45inst_t*, unsigned);
+
+#endif /* __HP45SNAP_H */
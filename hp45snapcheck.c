@@ -0,0 +1,175 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Snapshot check: runs a calculator on random keys and budgets from power-on
+ * and, after every call, saves it with hp45_snapshot and restores the bytes
+ * into a second calculator. The copy must have the same state, encode to the
+ * same bytes and, after a random run of both, still match. Then checks that
+ * hp45_restore rejects other versions, a wrong magic and short buffers without
+ * touching the calculator. Exits 1 on the first failure.
+ *   cc -O2 -o hp45snapcheck hp45snapcheck.c hp45snap.c hp45sim.c
+ *   ./hp45snapcheck [calls] [seed]
+ * The hash printed at the end covers every snapshot taken; builds with
+ * HP45_REG_SWAR or HP45_REG_PACKED must print the same one, as the encoding
+ * does not depend on the register layout.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define KEY_COUNT     35
+#define BUDGET_MAX    3000    // word-cycles per call, at most
+
+/* Private variables ---------------------------------------------------------*/
+/* native codes of all keys */
+static const uint8_t Keys[KEY_COUNT] = {
+  006, 004, 003, 002, 000, 056, 054, 053, 052, 050, 016, 014,
+  013, 012, 010, 076, 073, 072, 070, 066, 064, 063, 062, 026,
+  024, 023, 022, 036, 034, 033, 032, 046, 044, 043, 042,
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Next number of a xorshift32 sequence.
+  * @param  x: state, not 0
+  * @retval uint32_t: next number
+  */
+static uint32_t next_random(uint32_t *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 17;
+  *x ^= *x << 5;
+  return *x;
+}
+
+/**
+  * @brief  Compare the state of two calculators.
+  * @param  a: HP-45 memory object
+  * @param  b: HP-45 memory object
+  * @retval int: 1 if registers, flags and cycle counts are the same.
+  */
+static int same_state(const hp45inst_t *a, const hp45inst_t *b)
+{
+  return !memcmp(a, b, offsetof(hp45inst_t, PC))   // registers
+      && a->PC == b->PC && a->S == b->S && a->LR == b->LR && a->KeyCode == b->KeyCode
+      && a->P == b->P && a->DataAddr == b->DataAddr && a->ws == b->ws && a->CY == b->CY
+      && a->keydown == b->keydown && a->DispOn == b->DispOn && a->cycles == b->cycles;
+}
+
+/**
+  * @brief  Check that hp45_restore refuses a buffer and leaves the calculator as it was.
+  * @param  what: description of the buffer
+  * @param  calc: HP-45 memory object to restore into
+  * @param  buf: buffer
+  * @param  len: length of buf
+  * @retval int: 0 if refused, 1 if not.
+  */
+static int check_rejected(const char *what, hp45inst_t *calc, const uint8_t *buf, size_t len)
+{
+  hp45inst_t before = *calc;
+
+  if(hp45_restore(calc, buf, len) != -1 || memcmp(&before, calc, sizeof(hp45inst_t))){
+    printf("FAIL: hp45_restore accepted %s, or changed the calculator\n", what);
+    return 1;
+  }
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static hp45inst_t calc, copy;
+  uint8_t a[HP45_SNAPSHOT_SIZE], b[HP45_SNAPSHOT_SIZE], bad[HP45_SNAPSHOT_SIZE];
+  unsigned long calls = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000, n;
+  uint32_t x = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : 1, budget, hash = 2166136261u;
+  int i, failed = 0;
+
+  if(!x)x = 1;
+  hp45_init(&calc);
+  for(n = 0; n < calls; n++){
+    budget = next_random(&x) % BUDGET_MAX + 1;
+    switch(next_random(&x) % 8){
+      case 0: // press a key
+        key_down(&calc, Keys[next_random(&x) % KEY_COUNT]);
+        break;
+      case 1:
+        key_up(&calc);
+        break;
+      case 2:
+        hp45_fast_forward(&calc, budget);
+        break;
+      default:
+        hp45_run_cycles(&calc, budget, NULL);
+        break;
+    }
+    if(hp45_snapshot(&calc, a) != HP45_SNAPSHOT_SIZE){
+      printf("FAIL: call %lu, hp45_snapshot did not return HP45_SNAPSHOT_SIZE\n", n);
+      return 1;
+    }
+    for(i = 0; i < HP45_SNAPSHOT_SIZE; i++){
+      hash = (hash ^ a[i]) * 16777619u;
+    }
+    memset(&copy, 0x5A, sizeof(hp45inst_t));
+    if(hp45_restore(&copy, a, HP45_SNAPSHOT_SIZE) || !same_state(&calc, &copy)){
+      printf("FAIL: call %lu, the restored calculator differs (pc %03x cycles %lu, restored pc %03x cycles %lu)\n",
+             n, calc.PC, (unsigned long)calc.cycles, copy.PC, (unsigned long)copy.cycles);
+      return 1;
+    }
+    hp45_snapshot(&copy, b);
+    if(memcmp(a, b, HP45_SNAPSHOT_SIZE)){
+      printf("FAIL: call %lu, the restored calculator encodes to other bytes\n", n);
+      return 1;
+    }
+    // the copy must also run the same as the original
+    if(n % 16 == 0){
+      hp45inst_t ahead = calc;
+
+      hp45_run_cycles(&ahead, budget, NULL);
+      hp45_run_cycles(&copy, budget, NULL);
+      if(!same_state(&ahead, &copy)){
+        printf("FAIL: call %lu, the restored calculator ran differently\n", n);
+        return 1;
+      }
+    }
+  }
+
+  hp45_snapshot(&calc, a);
+  hp45_init(&copy);
+  memcpy(bad, a, HP45_SNAPSHOT_SIZE);
+  bad[3] = HP45_SNAPSHOT_VERSION + 1;
+  failed |= check_rejected("a newer version", &copy, bad, HP45_SNAPSHOT_SIZE);
+  bad[3] = HP45_SNAPSHOT_VERSION - 1;
+  failed |= check_rejected("an older version", &copy, bad, HP45_SNAPSHOT_SIZE);
+  memcpy(bad, a, HP45_SNAPSHOT_SIZE);
+  bad[0] = 'X';
+  failed |= check_rejected("a wrong magic", &copy, bad, HP45_SNAPSHOT_SIZE);
+  failed |= check_rejected("a short buffer", &copy, a, HP45_SNAPSHOT_SIZE - 1);
+  failed |= check_rejected("an empty buffer", &copy, a, 0);
+  if(failed)
+    return 1;
+  printf("ok: %lu calls, %lu word-cycles, snapshot hash %08lx\n", calls, (unsigned long)calc.cycles,
+         (unsigned long)hash);
+  return 0;
+}
@@ -0,0 +1,354 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Function sweep: evaluates a key sequence over evenly spaced inputs on all
+ * cores. Each input is written into register C (the X register) of an idle
+ * calculator with hp45_set_number instead of being typed, the keys are pressed and the result is
+ * read back from C. Inputs are dealt in chunks to worker threads and the
+ * results written in input order from a fixed ring of chunks, so memory
+ * stays bounded however long the sweep. Needs POSIX threads.
+ *   cc -O2 -pthread -o hp45sweep hp45sweep.c hp45num.c hp45snap.c hp45utils.c hp45sim.c -lm
+ *   ./hp45sweep [-t threads] [-p prefix] [-y y] [-o out.bin] [-c out.csv] keys start stop count
+ *   ./hp45sweep -c sin.csv SIN 0 90 1000001
+ *   ./hp45sweep -p RAD -o sin.bin SIN -3.2 3.2 10000000
+ *   ./hp45sweep -y 2 -c pow.csv Y^X -10 10 2001
+ * Without -o or -c, CSV goes to stdout.
+ * Options must come before the keys, so that start and stop may be negative.
+ * CSV columns: index, input, result, word-cycles. The result is "error" when
+ * the display flashes an error (e.g. ln 0) or register C does not hold a
+ * number, "stuck" if a key was not read or the firmware did not become idle.
+ * Binary file: RECORD_SIZE bytes per input, in order: input and result
+ * registers as 7 bytes of packed digits each (digit 2i in the low nibble of
+ * byte i, as in snapshots), status (0 ok, 1 error, 2 stuck), a zero byte,
+ * word-cycles as 32 bits little-endian.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45snap.h"
+#include "hp45num.h"
+
+/* Private macros ------------------------------------------------------------*/
+#define CHUNK           4096      // inputs per chunk
+#define CHUNKS_PER_THREAD 4       // chunks in the ring per worker
+#define KEYS_MAX        64
+#define RECORD_SIZE     20
+
+#define STATUS_OK       0
+#define STATUS_ERROR    1         // the display flashes an error, or register C is not a number
+#define STATUS_STUCK    2         // a key was not read or the firmware did not settle
+
+#define SLOT_FREE       0
+#define SLOT_BUSY       1
+#define SLOT_DONE       2
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  reg_t in, out;
+  uint32_t cycles;
+  uint8_t status;
+} result_t;
+
+typedef struct{
+  uint64_t chunk;         // chunk held
+  int state;              // SLOT_FREE, SLOT_BUSY or SLOT_DONE
+  result_t *res;          // CHUNK results
+} slot_t;
+
+/* Private variables ---------------------------------------------------------*/
+static hp45inst_t Base;             // idle calculator after the prefix, with Y set
+static uint8_t Keys[KEYS_MAX];
+static int NKeys;
+static double Start, Step;
+static uint64_t Count, Chunks, Next;
+static slot_t *Ring;
+static unsigned RingSize;
+static pthread_mutex_t Lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t Changed = PTHREAD_COND_INITIALIZER;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Read the monotonic clock.
+  * @param  None
+  * @retval double: seconds
+  */
+static double now_s(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+/**
+  * @brief  Evaluate one chunk of inputs.
+  * @param  calc: scratch calculator
+  * @param  chunk: chunk number
+  * @param  res: results
+  * @retval None
+  */
+static void run_chunk(hp45inst_t *calc, uint64_t chunk, result_t *res)
+{
+  uint64_t i, end = (chunk + 1)*CHUNK < Count ? (chunk + 1)*CHUNK : Count;
+  uint32_t start;
+  int32_t taken;
+  int k;
+
+  for(i = chunk*CHUNK; i < end; i++, res++){
+    hp45_fork(&Base, calc, 1);
+    res->status = STATUS_ERROR;
+    res->cycles = 0;
+    if(hp45_set_number(&res->in, Start + Step*i)){
+      // out of range: mark it as not a number, see hp45_is_number
+      for(k = 0; k < 14; k++)HP45_SET_DIGIT(&res->in, k, 0x0F);
+      res->out = res->in;
+      continue;
+    }
+    calc->CX = res->in;
+    start = calc->cycles;
+    for(k = 0, taken = 0; k < NKeys && taken != -1; k++){
+      taken = hp45_press_key(calc, Keys[k]);
+    }
+    res->out = calc->CX;
+    res->cycles = calc->cycles - start;
+    res->status = taken == -1 ? STATUS_STUCK : taken == -2 || !hp45_is_number(&calc->CX) ? STATUS_ERROR : STATUS_OK;
+  }
+}
+
+/**
+  * @brief  Worker thread: take the next chunk as soon as its ring slot is
+            free, evaluate it and hand it to the writer.
+  * @param  arg: unused
+  * @retval void*: NULL
+  */
+static void *worker_main(void *arg)
+{
+  hp45inst_t calc;
+  slot_t *slot;
+
+  (void)arg;
+  for(;;){
+    pthread_mutex_lock(&Lock);
+    for(;;){
+      if(Next >= Chunks){
+        pthread_mutex_unlock(&Lock);
+        return NULL;
+      }
+      slot = &Ring[Next % RingSize];
+      if(slot->state == SLOT_FREE)
+        break;
+      pthread_cond_wait(&Changed, &Lock);
+    }
+    slot->chunk = Next++;
+    slot->state = SLOT_BUSY;
+    pthread_mutex_unlock(&Lock);
+
+    run_chunk(&calc, slot->chunk, slot->res);
+
+    pthread_mutex_lock(&Lock);
+    slot->state = SLOT_DONE;
+    pthread_cond_broadcast(&Changed);
+    pthread_mutex_unlock(&Lock);
+  }
+}
+
+/**
+  * @brief  Pack a register into 7 bytes, digit 2i in the low nibble of byte i.
+  * @param  reg: register
+  * @param  buf: output
+  * @retval None
+  */
+static void pack(const reg_t *reg, uint8_t *buf)
+{
+  int i;
+
+  for(i = 0; i < 7; i++)buf[i] = HP45_DIGIT(reg, 2*i) | HP45_DIGIT(reg, 2*i + 1) << 4;
+}
+
+/**
+  * @brief  Write the results of a chunk.
+  * @param  bin: binary file, or NULL
+  * @param  csv: CSV file, or NULL
+  * @param  chunk: chunk number
+  * @param  res: results
+  * @retval int: 0 on success, -1 on write error.
+  */
+static int write_chunk(FILE *bin, FILE *csv, uint64_t chunk, const result_t *res)
+{
+  static const char *const Status[] = {"", "error", "stuck"};
+  uint64_t i, end = (chunk + 1)*CHUNK < Count ? (chunk + 1)*CHUNK : Count;
+  uint8_t rec[RECORD_SIZE];
+  char line[96], *p;
+
+  for(i = chunk*CHUNK; i < end; i++, res++){
+    if(bin){
+      pack(&res->in, rec);
+      pack(&res->out, rec + 7);
+      rec[14] = res->status;
+      rec[15] = 0;
+      rec[16] = res->cycles;
+      rec[17] = res->cycles >> 8;
+      rec[18] = res->cycles >> 16;
+      rec[19] = res->cycles >> 24;
+      if(fwrite(rec, RECORD_SIZE, 1, bin) != 1)
+        return -1;
+    }
+    if(csv){
+      p = line + sprintf(line, "%llu,", (unsigned long long)i);
+      p += hp45_is_number(&res->in) ? hp45_get_decimal(&res->in, p) : sprintf(p, "error");
+      *p++ = ',';
+      p += res->status == STATUS_OK ? hp45_get_decimal(&res->out, p) : sprintf(p, "%s", Status[res->status]);
+      p += sprintf(p, ",%lu\n", (unsigned long)res->cycles);
+      if(fwrite(line, p - line, 1, csv) != 1)
+        return -1;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  Open an output file, "-" for stdout, with a large buffer.
+  * @param  path: file name
+  * @param  mode: fopen mode
+  * @retval FILE*: file, NULL on failure.
+  */
+static FILE *open_out(const char *path, const char *mode)
+{
+  FILE *f = strcmp(path, "-") ? fopen(path, mode) : stdout;
+
+  if(!f)
+    perror(path);
+  else
+    setvbuf(f, NULL, _IOFBF, 1 << 20);
+  return f;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  const char *prefix = NULL, *bin_path = NULL, *csv_path = NULL, *y = NULL;
+  static uint8_t codes[KEYS_MAX];
+  unsigned threads = 0, i;
+  pthread_t *tid;
+  FILE *bin = NULL, *csv = NULL;
+  double stop, t;
+  uint64_t c;
+  int opt, n, status = 0;
+
+  while((opt = getopt(argc, argv, "+t:p:y:o:c:")) != -1){
+    switch(opt){
+      case 't': threads = strtoul(optarg, NULL, 0); break;
+      case 'p': prefix = optarg; break;
+      case 'y': y = optarg; break;
+      case 'o': bin_path = optarg; break;
+      case 'c': csv_path = optarg; break;
+      default: argc = 0;
+    }
+  }
+  if(argc - optind != 4){
+    fprintf(stderr, "usage: %s [-t threads] [-p prefix] [-y y] [-o out.bin] [-c out.csv] keys start stop count\n", argv[0]);
+    return 2;
+  }
+  NKeys = hp45_parse_keys(argv[optind], Keys, KEYS_MAX);
+  Start = strtod(argv[optind + 1], NULL);
+  stop = strtod(argv[optind + 2], NULL);
+  Count = strtoull(argv[optind + 3], NULL, 0);
+  Step = Count > 1 ? (stop - Start)/(Count - 1) : 0;
+  if(NKeys <= 0 || !Count){
+    fprintf(stderr, "bad keys or count\n");
+    return 2;
+  }
+
+  // the calculator every input starts from
+  hp45_init_ready(&Base);
+  n = prefix ? hp45_parse_keys(prefix, codes, KEYS_MAX) : 0;
+  for(i = 0; (int)i < n; i++){
+    if(hp45_press_key(&Base, codes[i]) < 0)
+      n = -1;
+  }
+  if(n < 0 || (y && hp45_set_decimal(HP45_Y(&Base), y))){
+    fprintf(stderr, "bad prefix or y\n");
+    return 2;
+  }
+
+  if(!threads){
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cpus > 0 ? cpus : 1;
+  }
+  if(!bin_path && !csv_path)
+    csv_path = "-";
+  if((bin_path && !(bin = open_out(bin_path, "wb"))) || (csv_path && !(csv = open_out(csv_path, "w"))))
+    return 2;
+  if(csv)
+    fprintf(csv, "index,input,result,cycles\n");
+
+  Chunks = (Count + CHUNK - 1)/CHUNK;
+  RingSize = CHUNKS_PER_THREAD*threads;
+  Ring = calloc(RingSize, sizeof(slot_t));
+  tid = malloc(threads*sizeof(pthread_t));
+  for(i = 0; Ring && i < RingSize; i++){
+    if(!(Ring[i].res = malloc(CHUNK*sizeof(result_t))))
+      break;
+  }
+  if(!tid || !Ring || i < RingSize){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+  t = now_s();
+  for(i = 0; i < threads; i++){
+    if(pthread_create(&tid[i], NULL, worker_main, NULL)){
+      fprintf(stderr, "cannot start thread\n");
+      return 2;
+    }
+  }
+
+  // write the chunks in order as they complete
+  for(c = 0; c < Chunks; c++){
+    slot_t *slot = &Ring[c % RingSize];
+
+    pthread_mutex_lock(&Lock);
+    while(slot->state != SLOT_DONE || slot->chunk != c)
+      pthread_cond_wait(&Changed, &Lock);
+    pthread_mutex_unlock(&Lock);
+    if(!status && write_chunk(bin, csv, c, slot->res)){
+      fprintf(stderr, "write error\n");
+      status = 2;
+    }
+    pthread_mutex_lock(&Lock);
+    slot->state = SLOT_FREE;
+    pthread_cond_broadcast(&Changed);
+    pthread_mutex_unlock(&Lock);
+  }
+  for(i = 0; i < threads; i++){
+    pthread_join(tid[i], NULL);
+  }
+  if((bin && fclose(bin)) || (csv && csv != stdout && fclose(csv)) || (csv == stdout && fflush(csv)))
+    status = 2;
+  t = now_s() - t;
+  fprintf(stderr, "%llu inputs in %.3f s, %.0f inputs/s on %u threads\n",
+          (unsigned long long)Count, t, Count/t, threads);
+  return status;
+}
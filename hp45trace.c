@@ -0,0 +1,223 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Execution traces for HP45_TRACE builds: set up the ring attached to an
+ * instance and save it to a file or load it back for hp45tracedump.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45snap.h"
+#include "hp45trace.h"
+
+#ifdef HP45_TRACE
+/* Private macros ------------------------------------------------------------*/
+#define HEADER_SIZE   12
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t Magic[4] = {'H', '4', '5', 'T'};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Check that a loaded ring holds whole records from 0 to head.
+  * @param  t: trace ring
+  * @retval int: 0 if consistent, -1 if not.
+  */
+static int check_records(const hp45trace_t *t)
+{
+  uint64_t i = 0, d;
+
+  while(i != t->head){
+    if(HP45_TRACE_IS_DELTA(t->buf[i]) || t->head - i < 1u + HP45_TRACE_NDELTA(t->buf[i]))
+      return -1;
+    for(d = i + 1; d <= i + HP45_TRACE_NDELTA(t->buf[i]); d++){
+      if(!HP45_TRACE_IS_DELTA(t->buf[d]))
+        return -1;
+    }
+    i = d;
+  }
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+/**
+  * @brief  Set up an empty trace ring on a buffer; attach it with instance->trace = t.
+  * @param  t: trace ring
+  * @param  buf: buffer of words, owned by the caller
+  * @param  words: size of buf, a power of 2 of at least 2*HP45_TRACE_AHEAD
+  * @retval int: 0 on success, -1 if words is not usable.
+  */
+int hp45trace_init(hp45trace_t *t, uint64_t *buf, uint32_t words)
+{
+  if(words < 2*HP45_TRACE_AHEAD || (words & (words - 1)))
+    return -1;
+  t->buf = buf;
+  t->size = words;
+  t->head = 0;
+  t->start = 0;
+  return 0;
+}
+
+/**
+  * @brief  Drop all records.
+  * @param  t: trace ring
+  * @retval None
+  */
+void hp45trace_clear(hp45trace_t *t)
+{
+  t->start = t->head;
+}
+
+/**
+  * @brief  Find the oldest whole record.
+  * @param  t: trace ring
+  * @retval uint64_t: word index of its header, head if the ring is empty;
+                      the records run from there to head.
+  */
+uint64_t hp45trace_oldest(const hp45trace_t *t)
+{
+  uint64_t i = t->head + HP45_TRACE_AHEAD > t->size ? t->head + HP45_TRACE_AHEAD - t->size : 0;
+
+  if(i < t->start)
+    i = t->start;
+  // the record at i may have lost its header
+  while(i < t->head && HP45_TRACE_IS_DELTA(t->buf[i & (t->size - 1)])){
+    i++;
+  }
+  return i;
+}
+
+/**
+  * @brief  Write a trace file.
+  * @param  t: trace ring
+  * @param  instance: the calculator it was recorded from, in its state after the newest record
+  * @param  out: output file, opened in binary mode
+  * @retval int: 0 on success, -1 on write error.
+  */
+int hp45trace_save(const hp45trace_t *t, const hp45inst_t *instance, FILE *out)
+{
+  uint8_t header[HEADER_SIZE + HP45_SNAPSHOT_SIZE] = {0};
+  uint8_t word[8];
+  const uint64_t oldest = hp45trace_oldest(t);
+  const uint32_t words = (uint32_t)(t->head - oldest);
+  uint64_t i;
+  int b;
+
+  memcpy(header, Magic, sizeof(Magic));
+  header[4] = HP45_TRACE_VERSION;
+  for(b = 0; b < 4; b++){
+    header[8 + b] = (uint8_t)(words >> (8*b));
+  }
+  hp45_snapshot(instance, header + HEADER_SIZE);
+  if(fwrite(header, sizeof(header), 1, out) != 1)
+    return -1;
+  for(i = oldest; i != t->head; i++){
+    const uint64_t w = t->buf[i & (t->size - 1)];
+
+    for(b = 0; b < 8; b++){
+      word[b] = (uint8_t)(w >> (8*b));
+    }
+    if(fwrite(word, sizeof(word), 1, out) != 1)
+      return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Read a trace file into a new ring allocated with malloc; free(t->buf) when done.
+  * @param  t: trace ring to fill, records from buf[0]
+  * @param  instance: receives the calculator after the newest record
+  * @param  in: input file, opened in binary mode
+  * @retval int: 0 on success, -1 if the file is not a valid trace or memory ran out.
+  */
+int hp45trace_load(hp45trace_t *t, hp45inst_t *instance, FILE *in)
+{
+  uint8_t header[HEADER_SIZE + HP45_SNAPSHOT_SIZE];
+  uint8_t word[8];
+  uint32_t words = 0, size = 1, i;
+  int b;
+
+  if(fread(header, sizeof(header), 1, in) != 1 || memcmp(header, Magic, sizeof(Magic))
+     || header[4] < 1 || header[4] > HP45_TRACE_VERSION)
+    return -1;
+  for(b = 0; b < 4; b++){
+    words |= (uint32_t)header[8 + b] << (8*b);
+  }
+  if(words > 0x40000000u || hp45_restore(instance, header + HEADER_SIZE, HP45_SNAPSHOT_SIZE))
+    return -1;
+  while(size < words + HP45_TRACE_AHEAD || size < 2*HP45_TRACE_AHEAD){
+    size <<= 1;
+  }
+  if(hp45trace_init(t, malloc(sizeof(uint64_t)*size), size) || !t->buf)
+    return -1;
+  for(i = 0; i < words; i++){
+    if(fread(word, sizeof(word), 1, in) != 1)
+      break;
+    t->buf[i] = 0;
+    for(b = 0; b < 8; b++){
+      t->buf[i] |= (uint64_t)word[b] << (8*b);
+    }
+  }
+  t->head = i;
+  if(i != words || check_records(t)){
+    free(t->buf);
+    t->buf = NULL;
+    return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Index the records of a loaded trace and rebuild their full cycle
+            numbers, walking back from the calculator after the newest record.
+            Each record holds only the low bits of its cycle number, enough
+            for gaps between records of up to 32767 cycles; sync records mark
+            the longer gaps of hp45_fast_forward and are left out of the index.
+  * @param  t: trace ring loaded by hp45trace_load, records from buf[0]
+  * @param  cycles: cycle counter of the calculator after the newest record
+  * @param  start: receives the word index of each record, NULL to only count them
+  * @param  cycle: receives the cycle counter before each record
+  * @retval uint32_t: number of records
+  */
+uint32_t hp45trace_index(const hp45trace_t *t, uint32_t cycles, uint32_t *start, uint32_t *cycle)
+{
+  uint32_t count = 0, i, k, end;
+
+  for(i = 0; i < t->head; i += 1 + HP45_TRACE_NDELTA(t->buf[i])){
+    if(HP45_TRACE_IS_SYNC(t->buf[i]))
+      continue;
+    if(start)start[count] = i;
+    count++;
+  }
+  if(!start)
+    return count;
+  for(end = (uint32_t)t->head, k = count; k-- > 0; end = start[k]){
+    // a sync record right after record k holds the cycle counter after it
+    i = start[k] + 1 + HP45_TRACE_NDELTA(t->buf[start[k]]);
+    if(i < end)
+      cycles = HP45_TRACE_SYNC_AT(t->buf[i]);
+    cycles = cycles - 1 - ((cycles - 1 - HP45_TRACE_CYCLE(t->buf[start[k]])) & 0x7FFF);
+    cycle[k] = cycles;
+  }
+  return count;
+}
+#endif /* HP45_TRACE */
@@ -0,0 +1,25 @@
+#ifndef __HP45TRACE_H
+#define __HP45TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "hp45sim.h"
+
+#ifdef HP45_TRACE
+/* Trace file ----------------------------------------------------------------*/
+/* "H45T", version, 3 zero bytes, number of words (32-bit little-endian),
+ * hp45_snapshot of the calculator after the newest record, then the words of
+ * the ring oldest first (64-bit little-endian). Version 1 files have no sync
+ * records and are still read.
+ */
+#define HP45_TRACE_VERSION 2
+
+int hp45trace_init(hp45trace_t*, uint64_t*, uint32_t);
+void hp45trace_clear(hp45trace_t*);
+uint64_t hp45trace_oldest(const hp45trace_t*);
+int hp45trace_save(const hp45trace_t*, const hp45inst_t*, FILE*);
+int hp45trace_load(hp45trace_t*, hp45inst_t*, FILE*);
+uint32_t hp45trace_index(const hp45trace_t*, uint32_t, uint32_t*, uint32_t*);
+#endif
+
+#endif /* __HP45TRACE_H */
@@ -0,0 +1,276 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Trace check for HP45_TRACE builds: presses keys one instruction at a time,
+ * noting the cycle count and address of each, with idle fast-forwards of up
+ * to 110000 cycles in between, then saves the trace, loads it back and checks
+ * that hp45trace_index rebuilds every cycle number. Then presses the same keys
+ * through a key press cache warmed by an untraced twin, and checks that the
+ * traced calculator still recorded one record per cycle run, with contiguous
+ * cycle numbers, and that undoing their register changes gives back the
+ * registers it started with. Exits 1 on the first mismatch.
+ *   cc -DHP45_TRACE -o hp45tracecheck hp45tracecheck.c hp45trace.c hp45cache.c hp45snap.c hp45utils.c hp45sim.c
+ *   ./hp45tracecheck
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45trace.h"
+#include "hp45cache.h"
+
+#ifndef HP45_TRACE
+#error "build hp45tracecheck with -DHP45_TRACE"
+#endif
+
+/* Private macros ------------------------------------------------------------*/
+#define RING_WORDS  (1u << 22)
+#define STEPS_MAX   (1u << 21)
+#define KEY_HOLD    2000      // instructions run with the key down
+#define SETTLE_MAX  200000    // instructions to become idle after a key
+#define IDLE_STEPS  300       // instructions run after each fast-forward
+#define REG_COUNT   17        // registers in trace order: A-F, M, RAM 0-9
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const Keys = "5 ENTER 3 SIN * 7 LN 1/X F FIX 2 CLX";
+/* fast-forward after each key; 0 ends a run of fast-forwards */
+static const uint32_t Gaps[] = {100000, 0, 35, 0, 40000, 70000, 0, 32768, 0, 32767, 0};
+
+static uint32_t Steps;
+static uint32_t *Cycle;   // cycle counter before each instruction run
+static uint16_t *Pc;      // its address
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Run one instruction and note where and when it ran.
+  * @param  instance: HP-45 memory object
+  * @retval int: 0, -1 if there is no room left to note it.
+  */
+static int step(hp45inst_t *instance)
+{
+  if(Steps == STEPS_MAX)
+    return -1;
+  Cycle[Steps] = instance->cycles;
+  Pc[Steps] = instance->PC;
+  Steps++;
+  hp45_run(instance);
+  return 0;
+}
+
+/**
+  * @brief  Press and release a key one instruction at a time, then run until idle.
+  * @param  instance: HP-45 memory object, idle
+  * @param  keycode: HP-45 native key code
+  * @retval int: 0, -1 if the firmware did not become idle.
+  */
+static int press(hp45inst_t *instance, uint8_t keycode)
+{
+  uint32_t i;
+
+  key_down(instance, keycode);
+  for(i = 0; i < KEY_HOLD; i++){
+    if(step(instance))return -1;
+  }
+  key_up(instance);
+  for(i = 0; !hp45_idle_period(instance); i++){
+    if(i == SETTLE_MAX || step(instance))return -1;
+  }
+  return 0;
+}
+
+/**
+  * @brief  Pack the registers of a calculator in trace order.
+  * @param  instance: HP-45 memory object
+  * @param  regs: receives 17 registers, digit i in bits 4i
+  * @retval None
+  */
+static void pack_regs(const hp45inst_t *instance, uint64_t *regs)
+{
+  const reg_t *r;
+  int i, d;
+
+  for(i = 0; i < REG_COUNT; i++){
+    r = i < 7 ? &(&instance->A)[i] : &instance->RAM[i - 7];
+    regs[i] = 0;
+    for(d = 13; d >= 0; d--){
+      regs[i] = (regs[i] << 4) | HP45_DIGIT(r, d);
+    }
+  }
+}
+
+/**
+  * @brief  Press keys through a key press cache on a traced calculator, after
+            an untraced twin pressed them through the same cache, and check
+            the trace: hits must not skip any records.
+  * @param  codes: HP-45 native key codes
+  * @param  keys: number of keys
+  * @retval int: 0 on success, 1 on a mismatch, 2 on a setup error.
+  */
+static int check_cache(const uint8_t *codes, int keys)
+{
+  static hp45inst_t calc, twin, loaded;
+  hp45cache_t *cache = hp45cache_create(64);
+  hp45cache_stats_t stats;
+  hp45trace_t ring, back;
+  uint64_t first[REG_COUNT], regs[REG_COUNT];
+  uint32_t *start, *cycle, count, k, from;
+  const uint64_t *w;
+  int i, d;
+  FILE *file = tmpfile();
+
+  if(!cache || !file || hp45trace_init(&ring, malloc(sizeof(uint64_t)*RING_WORDS), RING_WORDS) || !ring.buf){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+  hp45_init_ready(&twin);
+  hp45_settle(&twin);
+  calc = twin;
+  for(i = 0; i < keys; i++){
+    hp45cache_press_key(cache, &twin, codes[i]);
+  }
+  pack_regs(&calc, first);
+  from = calc.cycles;
+  calc.trace = &ring;
+  for(i = 0; i < keys; i++){
+    hp45cache_press_key(cache, &calc, codes[i]);
+  }
+  calc.trace = NULL;
+  hp45cache_stats(cache, &stats);
+  hp45cache_destroy(cache);
+
+  if(hp45trace_save(&ring, &calc, file) || fseek(file, 0, SEEK_SET) || hp45trace_load(&back, &loaded, file)){
+    fprintf(stderr, "trace save/load failed\n");
+    return 1;
+  }
+  count = hp45trace_index(&back, loaded.cycles, NULL, NULL);
+  start = malloc(sizeof(uint32_t)*(count + 1));
+  cycle = malloc(sizeof(uint32_t)*(count + 1));
+  if(!start || !cycle)
+    return 2;
+  hp45trace_index(&back, loaded.cycles, start, cycle);
+  if(count != loaded.cycles - from){
+    printf("FAIL: cached presses left %lu records for %lu cycles run\n", (unsigned long)count,
+           (unsigned long)(loaded.cycles - from));
+    return 1;
+  }
+  for(k = 0; k < count; k++){
+    if(cycle[k] != from + k){
+      printf("FAIL: cached presses, record %lu at cycle %lu, expected %lu\n", (unsigned long)k,
+             (unsigned long)cycle[k], (unsigned long)(from + k));
+      return 1;
+    }
+  }
+  // the registers before the first record, from the newest record back
+  pack_regs(&loaded, regs);
+  for(k = count; k-- > 0;){
+    w = &back.buf[start[k]];
+    for(d = 1; d <= HP45_TRACE_NDELTA(w[0]); d++){
+      regs[HP45_TRACE_REG(w[d]) % REG_COUNT] ^= HP45_TRACE_XOR(w[d]);
+    }
+  }
+  for(i = 0; i < REG_COUNT; i++){
+    if(regs[i] != first[i]){
+      printf("FAIL: cached presses, register %d rebuilt as %014llx, was %014llx\n", i,
+             (unsigned long long)regs[i], (unsigned long long)first[i]);
+      return 1;
+    }
+  }
+  printf("ok: %d presses with %lu cache entries warmed, %lu records\n", keys, (unsigned long)stats.entries,
+         (unsigned long)count);
+  free(start);
+  free(cycle);
+  free(back.buf);
+  free(ring.buf);
+  fclose(file);
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(void)
+{
+  static hp45inst_t calc, loaded;
+  hp45trace_t ring, back;
+  uint8_t codes[16];
+  uint32_t *start, *cycle, count, k, g = 0, skipped = 0, longest = 0, gap;
+  int keys, i;
+  FILE *file = tmpfile();
+
+  Cycle = malloc(sizeof(uint32_t)*STEPS_MAX);
+  Pc = malloc(sizeof(uint16_t)*STEPS_MAX);
+  keys = hp45_parse_keys(Keys, codes, 16);
+  if(!file || !Cycle || !Pc || hp45trace_init(&ring, malloc(sizeof(uint64_t)*RING_WORDS), RING_WORDS) || !ring.buf){
+    fprintf(stderr, "out of memory\n");
+    return 2;
+  }
+  hp45_init_ready(&calc);
+  hp45_settle(&calc);
+  calc.trace = &ring;
+  for(i = 0; i < keys; i++){
+    if(press(&calc, codes[i])){
+      fprintf(stderr, "key %d: no room or not idle\n", i);
+      return 2;
+    }
+    for(gap = 0; Gaps[g % (sizeof(Gaps)/sizeof(Gaps[0]))]; g++){
+      gap += hp45_fast_forward(&calc, Gaps[g % (sizeof(Gaps)/sizeof(Gaps[0]))]);
+    }
+    g++;
+    skipped += gap;
+    if(gap > longest)longest = gap;
+    for(k = 0; k < IDLE_STEPS; k++){
+      if(step(&calc))return 2;
+    }
+  }
+  // a trailing skip with no record after it
+  skipped += hp45_fast_forward(&calc, 50000);
+  calc.trace = NULL;
+
+  if(hp45trace_save(&ring, &calc, file) || fseek(file, 0, SEEK_SET) || hp45trace_load(&back, &loaded, file)){
+    fprintf(stderr, "trace save/load failed\n");
+    return 1;
+  }
+  count = hp45trace_index(&back, loaded.cycles, NULL, NULL);
+  start = malloc(sizeof(uint32_t)*(count + 1));
+  cycle = malloc(sizeof(uint32_t)*(count + 1));
+  if(!start || !cycle)
+    return 2;
+  hp45trace_index(&back, loaded.cycles, start, cycle);
+  if(count != Steps){
+    printf("FAIL: %lu records, %lu instructions run\n", (unsigned long)count, (unsigned long)Steps);
+    return 1;
+  }
+  for(k = 0; k < count; k++){
+    if(cycle[k] != Cycle[k] || HP45_TRACE_PC(back.buf[start[k]]) != Pc[k]){
+      printf("FAIL: record %lu at %03x cycle %lu, ran at %03x cycle %lu\n", (unsigned long)k,
+             HP45_TRACE_PC(back.buf[start[k]]), (unsigned long)cycle[k], Pc[k], (unsigned long)Cycle[k]);
+      return 1;
+    }
+  }
+  printf("ok: %lu records, cycles %lu to %lu, %lu skipped, longest gap %lu\n", (unsigned long)count,
+         (unsigned long)Cycle[0], (unsigned long)loaded.cycles, (unsigned long)skipped, (unsigned long)longest);
+  free(start);
+  free(cycle);
+  free(back.buf);
+  free(ring.buf);
+  free(Pc);
+  free(Cycle);
+  fclose(file);
+  return check_cache(codes, keys);
+}
@@ -0,0 +1,261 @@
+/* hp45sim - emulator of HP-45 scientific calculator.
+ * Copyright (C) 2022 reiyawea
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Trace decoder for HP45_TRACE builds: prints a trace file saved by
+ * hp45trace_save, or compares two and shows where they first diverge.
+ *   cc -DHP45_TRACE -o hp45tracedump hp45tracedump.c hp45trace.c hp45snap.c hp45utils.c hp45sim.c
+ *   ./hp45tracedump run.trace
+ *   ./hp45tracedump good.trace bad.trace
+ * Registers are shown with digit 13 first. Cycles skipped by the idle
+ * fast-forward leave gaps in a trace, shown as cycles not traced.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hp45sim.h"
+#include "hp45utils.h"
+#include "hp45trace.h"
+
+#ifndef HP45_TRACE
+#error "build hp45tracedump with -DHP45_TRACE"
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct{
+  hp45trace_t t;
+  hp45inst_t last;    // calculator after the newest record
+  uint32_t count;     // number of records
+  uint32_t *start;    // word index of each record
+  uint32_t *cycle;    // cycle counter before each record
+  uint64_t first[17]; // registers before the oldest record, digit i in bits 4i
+} tracefile_t;
+
+typedef struct{
+  uint32_t k;
+  uint64_t regs[17];
+} context_t;
+
+/* Private macros ------------------------------------------------------------*/
+#define REG_COUNT 17
+#define CONTEXT   4
+
+/* Private variables ---------------------------------------------------------*/
+static const char *const RegName[REG_COUNT] = {
+  "A", "B", "C", "D", "E", "F", "M",
+  "R0", "R1", "R2", "R3", "R4", "R5", "R6", "R7", "R8", "R9",
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Pack the registers of a calculator in trace order.
+  * @param  instance: HP-45 memory object
+  * @param  regs: receives 17 registers, digit i in bits 4i
+  * @retval None
+  */
+static void pack_regs(const hp45inst_t *instance, uint64_t *regs)
+{
+  const reg_t *r;
+  int i, d;
+
+  for(i = 0; i < REG_COUNT; i++){
+    r = i < 7 ? &(&instance->A)[i] : &instance->RAM[i - 7];
+    regs[i] = 0;
+    for(d = 13; d >= 0; d--){
+      regs[i] = (regs[i] << 4) | HP45_DIGIT(r, d);
+    }
+  }
+}
+
+/**
+  * @brief  Apply the register changes of a record.
+  * @param  f: trace
+  * @param  k: record number
+  * @param  regs: registers before the record, updated to after
+  * @retval None
+  */
+static void apply(const tracefile_t *f, uint32_t k, uint64_t *regs)
+{
+  const uint64_t *w = &f->t.buf[f->start[k]];
+  int d;
+
+  for(d = 1; d <= HP45_TRACE_NDELTA(w[0]); d++){
+    regs[HP45_TRACE_REG(w[d]) % REG_COUNT] ^= HP45_TRACE_XOR(w[d]);
+  }
+}
+
+/**
+  * @brief  Load and index a trace file.
+  * @param  path: file name
+  * @param  f: receives the trace
+  * @retval int: 0 on success, -1 on error (reported on stderr).
+  */
+static int load(const char *path, tracefile_t *f)
+{
+  FILE *in = fopen(path, "rb");
+  uint32_t k;
+
+  if(!in || hp45trace_load(&f->t, &f->last, in)){
+    fprintf(stderr, "%s: not a readable trace file\n", path);
+    if(in)fclose(in);
+    return -1;
+  }
+  fclose(in);
+  f->count = hp45trace_index(&f->t, f->last.cycles, NULL, NULL);
+  f->start = malloc(sizeof(uint32_t)*(f->count + 1));
+  f->cycle = malloc(sizeof(uint32_t)*(f->count + 1));
+  if(!f->start || !f->cycle){
+    fprintf(stderr, "%s: out of memory\n", path);
+    return -1;
+  }
+  hp45trace_index(&f->t, f->last.cycles, f->start, f->cycle);
+  // the oldest register state, from the newest record back
+  pack_regs(&f->last, f->first);
+  for(k = f->count; k-- > 0; ){
+    apply(f, k, f->first);
+  }
+  return 0;
+}
+
+/**
+  * @brief  Print one record.
+  * @param  f: trace
+  * @param  k: record number
+  * @param  regs: registers after the record
+  * @param  mark: first character of the line
+  * @retval None
+  */
+static void print_record(const tracefile_t *f, uint32_t k, const uint64_t *regs, char mark)
+{
+  const uint64_t *w = &f->t.buf[f->start[k]];
+  char text[24];
+  int d;
+
+  hp45_disasm(HP45_TRACE_OPCODE(w[0]), text);
+  printf("%c%10lu  %03x  %03x  %-20s %u %2u %03x", mark, (unsigned long)f->cycle[k],
+         HP45_TRACE_PC(w[0]), HP45_TRACE_OPCODE(w[0]), text,
+         HP45_TRACE_CY(w[0]), HP45_TRACE_P(w[0]), HP45_TRACE_S(w[0]));
+  for(d = 1; d <= HP45_TRACE_NDELTA(w[0]); d++){
+    const uint8_t r = HP45_TRACE_REG(w[d]) % REG_COUNT;
+
+    printf(" %s=%014llx", RegName[r], (unsigned long long)regs[r]);
+  }
+  printf("\n");
+}
+
+/**
+  * @brief  Print the column titles.
+  * @param  None
+  * @retval None
+  */
+static void print_title(void)
+{
+  printf(" %10s  %-3s  %-3s  %-20s %-2s%2s %-3s %s\n", "cycle", "pc", "op", "instruction", "cy", "p", "s", "registers written");
+}
+
+/**
+  * @brief  Print a whole trace.
+  * @param  f: trace
+  * @retval None
+  */
+static void dump(const tracefile_t *f)
+{
+  uint64_t regs[REG_COUNT];
+  uint32_t k;
+
+  memcpy(regs, f->first, sizeof(regs));
+  print_title();
+  for(k = 0; k < f->count; k++){
+    if(k && f->cycle[k] != f->cycle[k - 1] + 1)
+      printf("  ... %lu cycles not traced\n", (unsigned long)(f->cycle[k] - f->cycle[k - 1] - 1));
+    apply(f, k, regs);
+    print_record(f, k, regs, ' ');
+  }
+  printf("%lu records, cycles %lu to %lu\n", (unsigned long)f->count,
+         (unsigned long)(f->count ? f->cycle[0] : f->last.cycles), (unsigned long)f->last.cycles);
+}
+
+/**
+  * @brief  Compare two traces from their first common cycle.
+  * @param  a: trace
+  * @param  b: trace
+  * @retval int: 0 if they agree where both have records, 1 if they diverge.
+  */
+static int diff(const tracefile_t *a, const tracefile_t *b)
+{
+  uint64_t ra[REG_COUNT], rb[REG_COUNT];
+  context_t context[CONTEXT];
+  uint32_t ka = 0, kb = 0, same = 0, from, i;
+  int r;
+
+  memcpy(ra, a->first, sizeof(ra));
+  memcpy(rb, b->first, sizeof(rb));
+  if(!a->count || !b->count){
+    printf("nothing to compare\n");
+    return 0;
+  }
+  from = (int32_t)(a->cycle[0] - b->cycle[0]) > 0 ? a->cycle[0] : b->cycle[0];
+  for(; ka < a->count && (int32_t)(a->cycle[ka] - from) < 0; ka++)apply(a, ka, ra);
+  for(; kb < b->count && (int32_t)(b->cycle[kb] - from) < 0; kb++)apply(b, kb, rb);
+  for(; ka < a->count && kb < b->count; ka++, kb++, same++){
+    apply(a, ka, ra);
+    apply(b, kb, rb);
+    if(a->cycle[ka] != b->cycle[kb] || a->t.buf[a->start[ka]] != b->t.buf[b->start[kb]]
+       || memcmp(ra, rb, sizeof(ra))){
+      printf("traces diverge at cycle %lu (record %lu of the first, %lu of the second)\n",
+             (unsigned long)a->cycle[ka], (unsigned long)ka, (unsigned long)kb);
+      print_title();
+      for(i = same > CONTEXT ? same - CONTEXT : 0; i < same; i++){
+        print_record(a, context[i % CONTEXT].k, context[i % CONTEXT].regs, ' ');
+      }
+      print_record(a, ka, ra, '<');
+      print_record(b, kb, rb, '>');
+      for(r = 0; r < REG_COUNT; r++){
+        if(ra[r] != rb[r])
+          printf("  %-2s %014llx <> %014llx\n", RegName[r], (unsigned long long)ra[r], (unsigned long long)rb[r]);
+      }
+      return 1;
+    }
+    context[same % CONTEXT].k = ka;
+    memcpy(context[same % CONTEXT].regs, ra, sizeof(ra));
+  }
+  printf("traces agree over %lu records from cycle %lu\n", (unsigned long)same, (unsigned long)from);
+  return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int main(int argc, char **argv)
+{
+  static tracefile_t a, b;
+
+  if(argc < 2 || argc > 3){
+    fprintf(stderr, "usage: %s trace [other-trace]\n", argv[0]);
+    return 2;
+  }
+  if(load(argv[1], &a))
+    return 2;
+  if(argc == 2){
+    dump(&a);
+    return 0;
+  }
+  if(load(argv[2], &b))
+    return 2;
+  return diff(&a, &b);
+}
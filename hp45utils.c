@@ -18,6 +18,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stddef.h>
 #include "hp45sim.h"
 #include "hp45utils.h"
 
@@ -31,6 +32,10 @@
 #define BIT_G 0x40
 #define BIT_H 0x80
 
+#define KEY_ACCEPT_MAX  20000     // word-cycles to wait for the firmware to read a key
+#define SETTLE_MAX      4000000   // word-cycles to wait for the firmware to become idle
+#define SETTLE_STEP     64        // word-cycles run between idle checks
+
 const uint8_t SevenSegmentTable[] = {
   BIT_F | BIT_E | BIT_D | BIT_C | BIT_B | BIT_A,
   BIT_C | BIT_B,
@@ -42,6 +47,131 @@ const uint8_t SevenSegmentTable[] = {
   BIT_C | BIT_B | BIT_A,
   BIT_G | BIT_F | BIT_E | BIT_D | BIT_C | BIT_B | BIT_A,
   BIT_G | BIT_F | BIT_D | BIT_C | BIT_B | BIT_A,
+};
+
+/* Key names, as printed on the keyboard. Codes are those generated by the
+ * keyboard scanning circuit; "F" is the gold shift key.
+ */
+static const struct{
+  const char *name;
+  uint8_t code;
+} KeyTable[] = {
+  {"1/X", 006}, {"LN", 004}, {"E^X", 003}, {"FIX", 002}, {"F", 000},
+  {"X^2", 056}, {"->P", 054}, {"SIN", 053}, {"COS", 052}, {"TAN", 050},
+  {"X<>Y", 016}, {"RDN", 014}, {"STO", 013}, {"RCL", 012}, {"%", 010},
+  {"ENTER", 076}, {"CHS", 073}, {"EEX", 072}, {"CLX", 070},
+  {"-", 066}, {"7", 064}, {"8", 063}, {"9", 062},
+  {"+", 026}, {"4", 024}, {"5", 023}, {"6", 022},
+  {"*", 036}, {"1", 034}, {"2", 033}, {"3", 032},
+  {"/", 046}, {"0", 044}, {".", 043}, {"S+", 042},
+};
+
+/* Gold-shifted functions, typed as "F" followed by the key printed below them */
+static const struct{
+  const char *name;
+  uint8_t code;
+} ShiftTable[] = {
+  {"Y^X", 006}, {"LOG", 004}, {"10^X", 003}, {"SCI", 002},
+  {"SQRT", 056}, {"->R", 054}, {"ASIN", 053}, {"ACOS", 052}, {"ATAN", 050},
+  {"N!", 016}, {"->H.MS", 013}, {"->H", 012}, {"D%", 010},
+  {"DEG", 076}, {"RAD", 073}, {"GRD", 072}, {"PI", 043}, {"S-", 042},
+};
+
+/* Mnemonics of type 2 instructions, indexed by opcode>>5 */
+static const char *const Type2Name[32] = {
+  "0-B", "0->B", "A-C", "C-1", "B->C", "0-C->C", "0->C", "0-C-1->C",
+  "shift A left", "A->B", "A-C->C", "C-1->C", "C->A", "0-C", "A+C->C", "C+1->C",
+  "A-B", "B<->C", "shift C right", "A-1", "shift B right", "C+C->C", "shift A right", "0->A",
+  "A-B->A", "A<->B", "A-C->A", "A-1->A", "A+B->A", "C<->A", "A+C->A", "A+1->A",
+};
+
+/* Word-select field names, indexed by opcode>>2 & 7 */
+static const char *const FieldName[8] = {"p", "m", "x", "w", "wp", "ms", "xs", "s"};
+
+/* Type 5 data entry/display operations, indexed by opcode>>6 */
+static const char *const Type5Name[16] = {
+  "display toggle", NULL, "c <-> m", NULL, "c -> stack", NULL, "stack -> a", NULL,
+  "display off", NULL, "m -> c", "data -> c", "down rotate", NULL, "clear registers", NULL,
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief  Compare a key name with a table entry, case insensitive.
+ * @param  name: key name, not terminated
+ * @param  len: length of name
+ * @param  entry: name in the table
+ * @retval int: 1 if they match.
+ */
+static int same_name(const char *name, size_t len, const char *entry)
+{
+  size_t i;
+  char c;
+
+  for (i = 0; i < len; i++){
+    c = name[i];
+    if (c >= 'a' && c <= 'z')c -= 'a' - 'A';
+    if (entry[i] != c)return 0;
+  }
+  return !entry[i];
+}
+
+/**
+ * @brief  Look up one key name.
+ * @param  name: key name, not terminated
+ * @param  len: length of name
+ * @retval int: key code, -1 if unknown.
+ */
+static int key_code(const char *name, size_t len)
+{
+  size_t k;
+
+  for (k = 0; k < sizeof(KeyTable)/sizeof(KeyTable[0]); k++){
+    if (same_name(name, len, KeyTable[k].name))return KeyTable[k].code;
+  }
+  return -1;
+}
+
+/**
+ * @brief  Look up one gold-shifted function name.
+ * @param  name: function name, not terminated
+ * @param  len: length of name
+ * @retval int: code of the key to press after "F", -1 if unknown.
+ */
+static int shift_code(const char *name, size_t len)
+{
+  size_t k;
+
+  for (k = 0; k < sizeof(ShiftTable)/sizeof(ShiftTable[0]); k++){
+    if (same_name(name, len, ShiftTable[k].name))return ShiftTable[k].code;
+  }
+  return -1;
+}
+
+/**
+ * @brief  Append a string.
+ * @param  p: output position
+ * @param  s: string
+ * @retval char*: end of output, on the terminating zero.
+ */
+static char *copy_str(char *p, const char *s)
+{
+  while (*s)*p++ = *s++;
+  *p = 0;
+  return p;
+}
+
+/**
+ * @brief  Append a small decimal number.
+ * @param  p: output position
+ * @param  n: number, less than 100
+ * @retval char*: end of output, on the terminating zero.
+ */
+static char *copy_dec(char *p, uint8_t n)
+{
+  if (n >= 10)*p++ = '0' + n/10;
+  *p++ = '0' + n%10;
+  *p = 0;
+  return p;
 }
 
 /* Public functions  ---------------------------------------------------------*/
@@ -60,18 +190,273 @@ void make_display(hp45inst_t *instance, uint8_t *disp_buf)
   uint8_t digit;
 
   for (i = 13; i >= 0; i--){
-    if (instance->B.nibble[i] == 9){
+    if (HP45_DIGIT(&instance->B, i) == 9){
       *disp_buf++ = BIT_NONE;
       continue;
     }
     if (i == 13 || i == 2){
-      digit = (instance->A.nibble[i] == 9) ? BIT_G : BIT_NONE;
+      digit = (HP45_DIGIT(&instance->A, i) == 9) ? BIT_G : BIT_NONE;
     }else{
-      digit = SevenSegmentTable[instance->A.nibble[i]];
+      digit = SevenSegmentTable[HP45_DIGIT(&instance->A, i)];
     }
-    if (instance->B.nibble[i] == 2){
+    if (HP45_DIGIT(&instance->B, i) == 2){
       digit |= BIT_H;
     }
     *disp_buf++ = digit;
   }
 }
+
+#ifdef HP45_DISPLAY_TRACKING
+/**
+ * @brief  Convert HP-45 registers into LED scan buffer only if the display changed.
+ * Each consumer keeps its own buffer and seen counter, initially 0.
+ * @param  instance: HP-45 memory object
+ * @param  disp_buf: LED scan buffer from the last call, whose length should be at least 14.
+ * @param  seen: display_gen the buffer was made from, updated
+ * @retval int: 1 if disp_buf was rebuilt, 0 if it is still valid.
+ */
+int hp45_display_update(hp45inst_t *instance, uint8_t *disp_buf, uint32_t *seen)
+{
+  if (*seen && *seen == instance->display_gen)return 0;
+  make_display(instance, disp_buf);
+  *seen = instance->display_gen;
+  return 1;
+}
+#endif
+
+/**
+ * @brief  Convert HP-45 registers into the text shown, e.g. "-1.234567890-05".
+ * One character per digit position, blank positions as spaces, then '.'
+ * after a digit with its decimal point on; trailing blanks are removed.
+ * Like make_display, this ignores DispOn.
+ * @param  instance: HP-45 memory object
+ * @param  text: buffer, whose length should be at least 29.
+ * @retval None
+ */
+void hp45_display_text(const hp45inst_t *instance, char *text)
+{
+  char *end = text;
+  uint8_t a;
+  int i;
+
+  for (i = 13; i >= 0; i--){
+    if (HP45_DIGIT(&instance->B, i) == 9){
+      *text++ = ' ';
+      continue;
+    }
+    a = HP45_DIGIT(&instance->A, i);
+    if (i == 13 || i == 2){
+      *text++ = (a == 9) ? '-' : ' ';
+    }else{
+      *text++ = (a <= 9) ? '0' + a : ' ';
+    }
+    if (HP45_DIGIT(&instance->B, i) == 2){
+      *text++ = '.';
+    }
+    if (text[-1] != ' ')end = text;
+  }
+  *end = 0;
+}
+
+/**
+ * @brief  Translate a keystroke script into key codes.
+ * The script is a list of key names (see KeyTable, case insensitive) separated by
+ * white space, e.g. "12.5 ENTER 3 / F LN". A word made only of digits and
+ * decimal points is typed one key per character. Gold-shifted functions may
+ * also be named (see ShiftTable), e.g. "2 ENTER 3 Y^X" types "F 1/X".
+ * @param  script: keystroke script
+ * @param  codes: buffer for key codes
+ * @param  max_codes: length of codes
+ * @retval int: number of key codes, -1 on unknown key name or full buffer.
+ */
+int hp45_parse_keys(const char *script, uint8_t *codes, int max_codes)
+{
+  const char *word;
+  size_t len, i;
+  int n = 0, code;
+
+  for (;;){
+    while (*script == ' ' || *script == '\t' || *script == '\n' || *script == '\r')script++;
+    if (!*script)return n;
+    word = script;
+    while (*script && *script != ' ' && *script != '\t' && *script != '\n' && *script != '\r')script++;
+    len = script - word;
+    for (i = 0; i < len; i++){
+      if ((word[i] < '0' || word[i] > '9') && word[i] != '.')break;
+    }
+    if (i < len){ // key name
+      code = key_code(word, len);
+      if (code >= 0){
+        if (n >= max_codes)return -1;
+        codes[n++] = code;
+        continue;
+      }
+      code = shift_code(word, len);
+      if (code < 0 || n + 1 >= max_codes)return -1;
+      codes[n++] = 000;
+      codes[n++] = code;
+    }else{ // number
+      for (i = 0; i < len; i++){
+        if (n >= max_codes)return -1;
+        codes[n++] = key_code(&word[i], 1);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  Run until the firmware is idle, waiting for a key.
+ * On an error (e.g. 1/x of 0) the firmware flashes the display until the next
+ * key instead, which is never idle; it is recognized when the display has
+ * been turned on for the second time.
+ * @param  instance: HP-45 memory object
+ * @retval int32_t: word-cycles run, -1 if still busy after SETTLE_MAX cycles,
+ *                  -2 if the display flashes an error.
+ */
+int32_t hp45_settle(hp45inst_t *instance)
+{
+  int32_t cycles = 0;
+  uint8_t on = instance->DispOn, flashes = 0;
+
+  while (!hp45_idle_period(instance)){
+    if (cycles >= SETTLE_MAX)return -1;
+    cycles += hp45_run_cycles(instance, SETTLE_STEP, NULL);
+    if (!on && instance->DispOn && ++flashes == 2)return -2;
+    on = instance->DispOn;
+  }
+  return cycles;
+}
+
+/**
+ * @brief  Press and release one key, then run until the firmware is idle again.
+ * The key is held until the firmware reads it, like a finger that waits for
+ * the calculator to respond.
+ * @param  instance: HP-45 memory object, idle
+ * @param  keycode: HP-45 native key code
+ * @retval int32_t: word-cycles run, -1 if the key was not read or the
+ *                  firmware did not become idle, -2 if the display flashes
+ *                  an error (see hp45_settle).
+ */
+int32_t hp45_press_key(hp45inst_t *instance, uint8_t keycode)
+{
+  const uint32_t start = instance->cycles;
+  int32_t settle;
+  uint8_t event;
+
+  key_down(instance, keycode);
+  event = hp45_run_until(instance, HP45_EVENT_KEY, KEY_ACCEPT_MAX);
+  key_up(instance);
+  if (event != HP45_EVENT_KEY)return -1;
+  settle = hp45_settle(instance);
+  if (settle < 0)return settle;
+  return instance->cycles - start;
+}
+
+/**
+ * @brief  Classify an instruction into the types 1-10 decoded by hp45_run:
+ * 1 jump subroutine/conditional branch, 2 arithmetic/register, 3 status,
+ * 4 pointer, 5 data entry/display, 6 ROM select/misc, 7 and 8 unused,
+ * 9 unused with opcode bits set, 10 nop.
+ * @param  opcode: 10-bit instruction word
+ * @retval uint8_t: instruction type, 1 to 10
+ */
+uint8_t hp45_opcode_type(uint16_t opcode)
+{
+  const uint8_t o = opcode>>2;
+
+  switch (opcode & 0x003){
+    case 1: case 3: return 1;
+    case 2: return 2;
+  }
+  switch (o & 0x03){
+    case 1: return 3;
+    case 2: return 5;
+    case 3: return 4;
+  }
+  if (o & 0x04)return 6;
+  if (o & 0x08)return 7;
+  if (o & 0x10)return 8;
+  return o ? 9 : 10;
+}
+
+/**
+ * @brief  Disassemble one instruction, in the notation of the HP patent listing.
+ * @param  opcode: 10-bit instruction word
+ * @param  buf: output, at least 24 characters
+ * @retval None
+ */
+void hp45_disasm(uint16_t opcode, char *buf)
+{
+  static const char Hex[] = "0123456789abcdef";
+  const uint8_t o = opcode>>2;
+  const uint8_t N = o>>4;
+  const char *name = NULL;
+  char *p = buf;
+
+  switch (hp45_opcode_type(opcode)){
+    case 1:
+      p = copy_str(p, (opcode & 0x003) == 1 ? "jsb " : "then go to ");
+      *p++ = Hex[o>>4];
+      *p++ = Hex[o & 0x0F];
+      *p = 0;
+      return;
+    case 2:
+      p = copy_str(p, Type2Name[o>>3]);
+      p = copy_str(p, " [");
+      p = copy_str(p, FieldName[o & 7]);
+      copy_str(p, "]");
+      return;
+    case 3:
+      switch ((o>>2) & 0x03){
+        case 0: name = "1 -> s"; break;
+        case 1: name = "if s"; break;
+        case 2: name = "0 -> s"; break;
+        case 3: name = N ? NULL : "clear status"; break;
+      }
+      if (!name || N >= 12)break;
+      if (!N && ((o>>2) & 0x03) == 3){
+        copy_str(p, name);
+        return;
+      }
+      p = copy_str(p, name);
+      p = copy_dec(p, N);
+      if (((o>>2) & 0x03) == 1)p = copy_str(p, " = 1");
+      *p = 0;
+      return;
+    case 4:
+      switch ((o>>2) & 0x03){
+        case 0: copy_str(copy_dec(p, N), " -> p"); return;
+        case 1: copy_str(p, "p - 1 -> p"); return;
+        case 2: copy_dec(copy_str(p, "if p # "), N); return;
+        case 3: copy_str(p, "p + 1 -> p"); return;
+      }
+      break;
+    case 5:
+      if (((o>>2) & 0x03) == 1){
+        if (N < 10){
+          copy_str(copy_dec(p, N), " -> c[p]");
+          return;
+        }
+      }else if ((o>>2) & 0x02){
+        name = Type5Name[N];
+      }
+      if (!name)break;
+      copy_str(p, name);
+      return;
+    case 6:
+      switch ((o>>3) & 0x03){
+        case 0: copy_dec(copy_str(p, "rom "), o>>5); return;
+        case 1: copy_str(p, "return"); return;
+        case 2: if ((o>>5) & 1){ copy_str(p, "keys -> rom address"); return; } break;
+        case 3:
+          if (((o>>5) & 0x5) == 0x4){ copy_str(p, "c -> data address"); return; }
+          if ((o>>5) == 0x5){ copy_str(p, "c -> data"); return; }
+          break;
+      }
+      break;
+    case 10:
+      copy_str(p, "nop");
+      return;
+  }
+  copy_str(p, "undefined");
+}
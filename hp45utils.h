@@ -1 +1,10 @@
 void make_display(hp45inst_t*, uint8_t*);
+#ifdef HP45_DISPLAY_TRACKING
+int hp45_display_update(hp45inst_t*, uint8_t*, uint32_t*);
+#endif
+void hp45_display_text(const hp45inst_t*, char*);
+int hp45_parse_keys(const char*, uint8_t*, int);
+int32_t hp45_settle(hp45inst_t*);
+int32_t hp45_press_key(hp45inst_t*, uint8_t);
+uint8_t hp45_opcode_type(uint16_t);
+void hp45_disasm(uint16_t, char*);